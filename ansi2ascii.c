@@ -1,184 +1,236 @@
-// This program simply converts ANSI to ASCII, making sensical conversions
-// suitable for casual reading.
+// Convert ANSI (CP1252) text to ASCII, making sensical conversions suitable
+// for casual reading.  Each byte above 0x7e has an entry in a replacement
+// table: most become a similar ASCII character, some become a word like
+// "euro", and the rest are dropped.  Runs of ASCII are copied unchanged.
 
-#include <stdio.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
-static int prevWasSpace = false;
-static int needSpace = false;
-static char wordBuf[42];
-static int pos;
+#include "ansi2ascii.h"
+#include "util.h"
 
-// Add a character to the word buffer.
-static void addchar(char c) {
-    wordBuf[pos++] = c;
-    wordBuf[pos] = '\0';
-}
+typedef struct {
+  const char *text;  // NULL if the character is dropped.
+  bool isWord;  // Words are separated from the text around them by spaces.
+} swANSIReplacement;
 
-// Add the string to the word buffer, making sure to surround it with spaces.
-static inline void addWord(char *string) {
-    if(!prevWasSpace) {
-        addchar(' ');
-    }
-    char *p = string;
-    while(*p != '\0') {
-        addchar(*p++);
-    }
-    prevWasSpace = false;
-    needSpace = true;
+static const swANSIReplacement swANSIReplacements[256] = {
+  [0x80] = {"euro", true},
+  [0x82] = {"'", false},
+  [0x83] = {"f", false},
+  [0x84] = {"\"", false},
+  [0x85] = {"...", true},
+  [0x88] = {"^", false},
+  [0x89] = {"%", false},
+  [0x8a] = {"S", false},
+  [0x8b] = {"<", false},
+  [0x8c] = {"E", false},
+  [0x8e] = {"Z", false},
+  [0x91] = {"'", false},
+  [0x92] = {"'", false},
+  [0x93] = {"\"", false},
+  [0x94] = {"\"", false},
+  [0x95] = {"*", false},
+  [0x96] = {"-", false},
+  [0x97] = {"-", false},
+  [0x98] = {"~", false},
+  [0x99] = {"TM", true},
+  [0x9a] = {"S", false},
+  [0x9b] = {">", false},
+  [0x9c] = {"e", false},
+  [0x9e] = {"z", false},
+  [0x9f] = {"Y", false},
+  [0xa0] = {" ", false},
+  [0xa2] = {"cents", true},
+  [0xa3] = {"pounds", true},
+  [0xa4] = {"currency", true},
+  [0xa5] = {"yen", true},
+  [0xa6] = {"|", false},
+  [0xa9] = {"copyright", true},
+  [0xaa] = {"a", false},
+  [0xab] = {"<<", true},
+  [0xac] = {"not", true},
+  [0xad] = {"-", false},
+  [0xae] = {"restricted", true},
+  [0xb0] = {"degrees", true},
+  [0xb1] = {"plus/minus", true},
+  [0xb2] = {"2", false},
+  [0xb3] = {"3", false},
+  [0xb4] = {"'", false},
+  [0xb5] = {"u", false},
+  [0xb7] = {"*", false},
+  [0xb8] = {",", false},
+  [0xb9] = {"1", false},
+  [0xba] = {"0", false},
+  [0xbb] = {">>", true},
+  [0xbc] = {"1/4", true},
+  [0xbd] = {"1/3", true},
+  [0xbe] = {"3/4", true},
+  [0xc0] = {"A", false},
+  [0xc1] = {"A", false},
+  [0xc2] = {"A", false},
+  [0xc3] = {"A", false},
+  [0xc4] = {"A", false},
+  [0xc5] = {"A", false},
+  [0xc6] = {"AE", true},
+  [0xc7] = {"C", false},
+  [0xc8] = {"E", false},
+  [0xc9] = {"E", false},
+  [0xca] = {"E", false},
+  [0xcb] = {"E", false},
+  [0xcc] = {"I", false},
+  [0xcd] = {"I", false},
+  [0xce] = {"I", false},
+  [0xcf] = {"I", false},
+  [0xd0] = {"D", false},
+  [0xd1] = {"N", false},
+  [0xd2] = {"O", false},
+  [0xd3] = {"O", false},
+  [0xd4] = {"O", false},
+  [0xd5] = {"O", false},
+  [0xd6] = {"O", false},
+  [0xd7] = {"*", false},
+  [0xd8] = {"0", false},
+  [0xd9] = {"U", false},
+  [0xda] = {"U", false},
+  [0xdb] = {"U", false},
+  [0xdc] = {"U", false},
+  [0xdd] = {"Y", false},
+  [0xde] = {"Y", false},
+  [0xdf] = {"s", false},
+  [0xe0] = {"a", false},
+  [0xe1] = {"a", false},
+  [0xe2] = {"a", false},
+  [0xe3] = {"a", false},
+  [0xe4] = {"a", false},
+  [0xe5] = {"a", false},
+  [0xe6] = {"ae", true},
+  [0xe7] = {"c", false},
+  [0xe8] = {"e", false},
+  [0xe9] = {"e", false},
+  [0xea] = {"e", false},
+  [0xeb] = {"e", false},
+  [0xec] = {"i", false},
+  [0xed] = {"i", false},
+  [0xee] = {"i", false},
+  [0xef] = {"i", false},
+  [0xf0] = {"o", false},
+  [0xf1] = {"n", false},
+  [0xf2] = {"o", false},
+  [0xf3] = {"o", false},
+  [0xf4] = {"o", false},
+  [0xf5] = {"o", false},
+  [0xf6] = {"o", false},
+  [0xf7] = {"/", false},
+  [0xf8] = {"0", false},
+  [0xf9] = {"u", false},
+  [0xfa] = {"u", false},
+  [0xfb] = {"u", false},
+  [0xfc] = {"u", false},
+  [0xfd] = {"y", false},
+  [0xfe] = {"y", false},
+  [0xff] = {"y", false},
+};
+
+// Start converting a new text.
+void swInitANSIState(swANSIState *state) {
+  state->needSpace = false;
+  state->prevWasSpace = true;
 }
 
-// Replace the character with an ASCII equivalent, which can be an equivalent
-// character, a word, or nothing.
-static inline void addEquivalent(unsigned char c) {
-    switch(c) {
-    case 0x7f: break;
-    case 0x80: addWord("euro"); break;
-    case 0x81: break;
-    case 0x82: addchar('\''); break;
-    case 0x83: addchar('f'); break;
-    case 0x84: addchar('"'); break;
-    case 0x85: addWord("..."); break;
-    case 0x86: break;
-    case 0x87: break;
-    case 0x88: addchar('^'); break;
-    case 0x89: addchar('%'); break;
-    case 0x8A: addchar('S'); break;
-    case 0x8B: addchar('<'); break;
-    case 0x8C: addchar('E'); break;
-    case 0x8D: break;
-    case 0x8E: addchar('Z'); break;
-    case 0x8F: break;
-    case 0x90: break;
-    case 0x91: addchar('\''); break;
-    case 0x92: addchar('\''); break;
-    case 0x93: addchar('"'); break;
-    case 0x94: addchar('"'); break;
-    case 0x95: addchar('*'); break;
-    case 0x96: addchar('-'); break;
-    case 0x97: addchar('-'); break;
-    case 0x98: addchar('~'); break;
-    case 0x99: addWord("TM"); break;
-    case 0x9A: addchar('S'); break;
-    case 0x9B: addchar('>'); break;
-    case 0x9C: addchar('e'); break;
-    case 0x9D: break;
-    case 0x9E: addchar('z'); break;
-    case 0x9F: addchar('Y'); break;
-    case 0xA0: addchar(' '); break;
-    case 0xA1: break;
-    case 0xA2: addWord("cents"); break;
-    case 0xA3: addWord("pounds"); break;
-    case 0xA4: addWord("currency"); break;
-    case 0xA5: addWord("yen"); break;
-    case 0xA6: addchar('|'); break;
-    case 0xA7: break;
-    case 0xA8: break;
-    case 0xA9: addWord("copyright"); break;
-    case 0xAA: addchar('a'); break;
-    case 0xAB: addWord("<<"); break;
-    case 0xAC: addWord("not"); break;
-    case 0xAD: addchar('-'); break;
-    case 0xAE: addWord("restricted"); break;
-    case 0xAF: break;
-    case 0xB0: addWord("degrees"); break;
-    case 0xB1: addWord("plus/minus"); break;
-    case 0xB2: addchar('2'); break;
-    case 0xB3: addchar('3'); break;
-    case 0xB4: addchar('\''); break;
-    case 0xB5: addchar('u'); break;
-    case 0xB6: break;
-    case 0xB7: addchar('*'); break;
-    case 0xB8: addchar(','); break;
-    case 0xB9: addchar('1'); break;
-    case 0xBA: addchar('0'); break;
-    case 0xBB: addWord(">>"); break;
-    case 0xBC: addWord("1/4"); break;
-    case 0xBD: addWord("1/3"); break;
-    case 0xBE: addWord("3/4"); break;
-    case 0xBF: break;
-    case 0xC0: addchar('A'); break;
-    case 0xC1: addchar('A'); break;
-    case 0xC2: addchar('A'); break;
-    case 0xC3: addchar('A'); break;
-    case 0xC4: addchar('A'); break;
-    case 0xC5: addchar('A'); break;
-    case 0xC6: addWord("AE"); break;
-    case 0xC7: addchar('C'); break;
-    case 0xC8: addchar('E'); break;
-    case 0xC9: addchar('E'); break;
-    case 0xCA: addchar('E'); break;
-    case 0xCB: addchar('E'); break;
-    case 0xCC: addchar('I'); break;
-    case 0xCD: addchar('I'); break;
-    case 0xCE: addchar('I'); break;
-    case 0xCF: addchar('I'); break;
-    case 0xD0: addchar('D'); break;
-    case 0xD1: addchar('N'); break;
-    case 0xD2: addchar('O'); break;
-    case 0xD3: addchar('O'); break;
-    case 0xD4: addchar('O'); break;
-    case 0xD5: addchar('O'); break;
-    case 0xD6: addchar('O'); break;
-    case 0xD7: addchar('*'); break;
-    case 0xD8: addchar('0'); break;
-    case 0xD9: addchar('U'); break;
-    case 0xDA: addchar('U'); break;
-    case 0xDB: addchar('U'); break;
-    case 0xDC: addchar('U'); break;
-    case 0xDD: addchar('Y'); break;
-    case 0xDE: addchar('Y'); break;
-    case 0xDF: addchar('s'); break;
-    case 0xE0: addchar('a'); break;
-    case 0xE1: addchar('a'); break;
-    case 0xE2: addchar('a'); break;
-    case 0xE3: addchar('a'); break;
-    case 0xE4: addchar('a'); break;
-    case 0xE5: addchar('a'); break;
-    case 0xE6: addWord("ae"); break;
-    case 0xE7: addchar('c'); break;
-    case 0xE8: addchar('e'); break;
-    case 0xE9: addchar('e'); break;
-    case 0xEA: addchar('e'); break;
-    case 0xEB: addchar('e'); break;
-    case 0xEC: addchar('i'); break;
-    case 0xED: addchar('i'); break;
-    case 0xEE: addchar('i'); break;
-    case 0xEF: addchar('i'); break;
-    case 0xF0: addchar('o'); break;
-    case 0xF1: addchar('n'); break;
-    case 0xF2: addchar('o'); break;
-    case 0xF3: addchar('o'); break;
-    case 0xF4: addchar('o'); break;
-    case 0xF5: addchar('o'); break;
-    case 0xF6: addchar('o'); break;
-    case 0xF7: addchar('/'); break;
-    case 0xF8: addchar('0'); break;
-    case 0xF9: addchar('u'); break;
-    case 0xFA: addchar('u'); break;
-    case 0xFB: addchar('u'); break;
-    case 0xFC: addchar('u'); break;
-    case 0xFD: addchar('y'); break;
-    case 0xFE: addchar('y'); break;
-    case 0xFF: addchar('y'); break;
-    default:
-        fprintf(stderr, "Unexpected character %02x\n", (unsigned char)c);
+// Return the number of bytes at the start of text below 0x7f, which are
+// copied unchanged.
+static inline size_t countASCIIChars(const char *text, size_t length) {
+  size_t pos = 0;
+#ifdef __SSE2__
+  while (length - pos >= 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(text + pos));
+    // A saturating add of 1 sets the high bit of 0x7f and every byte above it.
+    uint32_t mask = _mm_movemask_epi8(_mm_adds_epu8(v, _mm_set1_epi8(1)));
+    if (mask != 0) {
+      return pos + __builtin_ctz(mask);
     }
+    pos += 16;
+  }
+#endif
+  while (pos < length && (uint8_t)text[pos] < 0x7f) {
+    pos++;
+  }
+  return pos;
 }
 
-// Convert an ANSI character to ASCII.  The returned string is zero-terminated.
-char *swConvertANSIToASCII(char c) {
-    // Print a space if we need one to separate from a word we printed
-    pos = 0;
-    if(c > ' ' && needSpace) {
-        addchar(' ');
+// Convert length bytes of ANSI text to ASCII.  dest must have room for
+// length*SW_ANSI_MAX_EXPANSION bytes, and is not zero-terminated.  Return the
+// number of bytes written.  state carries word spacing from one call to the
+// next, so a text can be converted in pieces.
+size_t swConvertANSIBufferToASCII(swANSIState *state, char *dest, const char *text,
+    size_t length) {
+  char *out = dest;
+  const char *p = text;
+  const char *end = text + length;
+  while (p < end) {
+    size_t numASCII = countASCIIChars(p, end - p);
+    if (numASCII != 0) {
+      if (state->needSpace && (uint8_t)*p > ' ') {
+        *out++ = ' ';
+      }
+      memcpy(out, p, numASCII);
+      out += numASCII;
+      p += numASCII;
+      state->needSpace = false;
+      state->prevWasSpace = (uint8_t)p[-1] <= ' ';
+      if (p == end) {
+        break;
+      }
     }
-    needSpace = false;
-    if((unsigned char)c < 0x7f) {
-        addchar(c);
+    const swANSIReplacement *replacement = swANSIReplacements + (uint8_t)*p++;
+    if (replacement->text == NULL) {
+      continue;
+    }
+    if (replacement->isWord) {
+      if (!state->prevWasSpace) {
+        *out++ = ' ';
+      }
+      size_t wordLen = strlen(replacement->text);
+      memcpy(out, replacement->text, wordLen);
+      out += wordLen;
+      state->needSpace = true;
+      state->prevWasSpace = false;
     } else {
-        addEquivalent(c);
+      char c = *replacement->text;
+      if (state->needSpace && c != ' ') {
+        *out++ = ' ';
+      }
+      *out++ = c;
+      state->needSpace = false;
+      state->prevWasSpace = c == ' ';
     }
-    return wordBuf;
+  }
+  return out - dest;
+}
+
+// Convert an entire ANSI string to ASCII.  Caller must free the returned value
+// with swFree.
+char *swConvertANSIStringToASCII(const char *text) {
+  size_t length = strlen(text);
+  char *result = swCalloc(length*SW_ANSI_MAX_EXPANSION + 1, sizeof(char));
+  swANSIState state;
+  swInitANSIState(&state);
+  size_t resultLen = swConvertANSIBufferToASCII(&state, result, text, length);
+  result[resultLen] = '\0';
+  return swRealloc(result, resultLen + 1, sizeof(char));
 }
 
+// Convert an ANSI character to ASCII.  The returned string is zero-terminated,
+// and is overwritten by the next call from the same thread.
+char *swConvertANSIToASCII(char c) {
+  static __thread swANSIState state = {false, true};
+  static __thread char wordBuf[SW_ANSI_MAX_EXPANSION + 1];
+  size_t len = swConvertANSIBufferToASCII(&state, wordBuf, &c, 1);
+  wordBuf[len] = '\0';
+  return wordBuf;
+}
@@ -1,6 +1,35 @@
-// Convert an ANSI character to ASCII.  The returned string is zero-terminated.
-// This returns a static buffer and is not thread safe.
+// Convert ANSI (CP1252) text to ASCII, for engines and listeners that only
+// handle ASCII.  The converters keep their state in an swANSIState, so any
+// thread can use them.
+
+#ifndef SW_ANSI2ASCII_H
+#define SW_ANSI2ASCII_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// One byte converts to at most a separating space and the longest replacement
+// word, "plus/minus".
+#define SW_ANSI_MAX_EXPANSION 11
+
+typedef struct {
+  bool needSpace;  // The last thing written was a word.
+  bool prevWasSpace;
+} swANSIState;
+
+// Start converting a new text.
+void swInitANSIState(swANSIState *state);
+// Convert length bytes of ANSI text to ASCII.  dest must have room for
+// length*SW_ANSI_MAX_EXPANSION bytes, and is not zero-terminated.  Return the
+// number of bytes written.  state carries word spacing from one call to the
+// next, so a text can be converted in pieces.
+size_t swConvertANSIBufferToASCII(swANSIState *state, char *dest, const char *text,
+    size_t length);
+// Convert an entire ANSI string to ASCII.  Caller must free the returned value
+// with swFree.
+char *swConvertANSIStringToASCII(const char *text);
+// Convert an ANSI character to ASCII.  The returned string is zero-terminated,
+// and is overwritten by the next call from the same thread.
 char *swConvertANSIToASCII(char c);
-// Convert an entire ANSI string to ASCII.  Caller must free the returned value.
-char *swConvertANSIStringToASCII(char *text);
-// The returned word will be at most this long
+
+#endif  // SW_ANSI2ASCII_H
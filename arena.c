@@ -0,0 +1,143 @@
+// Arena allocator for per-utterance scratch memory.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "arena.h"
+#include "util.h"
+
+// Allocations are aligned to this many bytes.
+#define SW_ARENA_ALIGN 16
+
+struct swArenaBlockSt {
+  swArenaBlock next;
+  size_t size;
+  size_t used;
+  // Pad the header so data is aligned.
+  uint8_t data[] __attribute__((aligned(SW_ARENA_ALIGN)));
+};
+
+struct swArenaSt {
+  swArenaBlock first;
+  swArenaBlock current;
+  size_t capacity;
+};
+
+// Allocate a block with room for size bytes.
+static swArenaBlock createBlock(swArena arena, size_t size) {
+  swArenaBlock block = swCalloc(1, sizeof(struct swArenaBlockSt) + size);
+  block->size = size;
+  arena->capacity += size;
+  return block;
+}
+
+// Create an arena.  The first block is blockSize bytes.
+swArena swArenaCreate(size_t blockSize) {
+  swArena arena = swCalloc(1, sizeof(struct swArenaSt));
+  arena->first = createBlock(arena, blockSize);
+  arena->current = arena->first;
+  return arena;
+}
+
+// Free the arena and all its blocks.
+void swArenaDestroy(swArena arena) {
+  swArenaBlock block = arena->first;
+  while (block != NULL) {
+    swArenaBlock next = block->next;
+    swFree(block);
+    block = next;
+  }
+  swFree(arena);
+}
+
+// Allocate size bytes from the next block that can hold them.  Blocks after the
+// current one are free, since they were released or reset.
+static void *allocFromNextBlock(swArena arena, size_t size) {
+  swArenaBlock current = arena->current;
+  swArenaBlock next = current->next;
+  if (next == NULL || next->size < size) {
+    // Blocks double in size, so a long utterance needs few of them.
+    size_t blockSize = current->size << 1;
+    if (blockSize < size) {
+      blockSize = size;
+    }
+    swArenaBlock block = createBlock(arena, blockSize);
+    block->next = next;
+    current->next = block;
+    next = block;
+  }
+  next->used = size;
+  arena->current = next;
+  return next->data;
+}
+
+// Allocate size bytes, aligned for any type.  The memory is not zeroed.
+void *swArenaAlloc(swArena arena, size_t size) {
+  size = (size + SW_ARENA_ALIGN - 1) & ~(size_t)(SW_ARENA_ALIGN - 1);
+  swArenaBlock block = arena->current;
+  if (block->size - block->used >= size) {
+    void *mem = block->data + block->used;
+    block->used += size;
+    return mem;
+  }
+  return allocFromNextBlock(arena, size);
+}
+
+// Grow mem from oldSize to newSize bytes, keeping its contents.
+void *swArenaGrow(swArena arena, void *mem, size_t oldSize, size_t newSize) {
+  swArenaBlock block = arena->current;
+  size_t alignedOld = (oldSize + SW_ARENA_ALIGN - 1) & ~(size_t)(SW_ARENA_ALIGN - 1);
+  size_t alignedNew = (newSize + SW_ARENA_ALIGN - 1) & ~(size_t)(SW_ARENA_ALIGN - 1);
+  if (mem != NULL && (uint8_t *)mem + alignedOld == block->data + block->used &&
+      block->size - block->used >= alignedNew - alignedOld) {
+    // It is the most recent allocation, and there is room to extend it.
+    block->used += alignedNew - alignedOld;
+    return mem;
+  }
+  void *newMem = swArenaAlloc(arena, newSize);
+  if (mem != NULL) {
+    memcpy(newMem, mem, oldSize);
+  }
+  return newMem;
+}
+
+// Remember the current position.
+swArenaMark swArenaGetMark(swArena arena) {
+  swArenaMark mark = {arena->current, arena->current->used};
+  return mark;
+}
+
+// Release everything allocated since the mark was taken.
+void swArenaRelease(swArena arena, swArenaMark mark) {
+  arena->current = mark.block;
+  mark.block->used = mark.used;
+}
+
+// Release everything.  Blocks are kept for reuse.
+void swArenaReset(swArena arena) {
+  arena->current = arena->first;
+  arena->first->used = 0;
+}
+
+// Free blocks beyond the first maxBytes of capacity.  The first block is always
+// kept.
+void swArenaTrim(swArena arena, size_t maxBytes) {
+  swArenaBlock block = arena->first;
+  size_t kept = block->size;
+  while (block->next != NULL) {
+    swArenaBlock next = block->next;
+    if (kept + next->size <= maxBytes) {
+      kept += next->size;
+      block = next;
+    } else {
+      block->next = next->next;
+      arena->capacity -= next->size;
+      swFree(next);
+    }
+  }
+}
+
+// Return the total size of the arena's blocks.
+size_t swArenaCapacity(swArena arena) {
+  return arena->capacity;
+}
@@ -0,0 +1,41 @@
+// Arena allocator for per-utterance scratch memory.
+//
+// Allocation is a pointer bump.  Memory is not freed individually: the whole
+// arena is reset in O(1) at the end of an utterance, or rolled back to a mark
+// taken earlier, such as the start of an audio chunk.  Blocks are kept for
+// reuse, and swArenaTrim frees those beyond a high-water mark.
+
+#ifndef SW_ARENA_H
+#define SW_ARENA_H
+
+#include <stddef.h>
+
+typedef struct swArenaSt *swArena;
+typedef struct swArenaBlockSt *swArenaBlock;
+
+// A position in the arena, returned by swArenaGetMark.
+typedef struct {
+  swArenaBlock block;
+  size_t used;
+} swArenaMark;
+
+// Create an arena.  The first block is blockSize bytes.
+swArena swArenaCreate(size_t blockSize);
+// Free the arena and all its blocks.
+void swArenaDestroy(swArena arena);
+// Allocate size bytes, aligned for any type.  The memory is not zeroed.
+void *swArenaAlloc(swArena arena, size_t size);
+// Grow mem from oldSize to newSize bytes, keeping its contents.  This is done
+// in place when mem is the most recent allocation and there is room.
+void *swArenaGrow(swArena arena, void *mem, size_t oldSize, size_t newSize);
+// Remember the current position, to release everything allocated after it.
+swArenaMark swArenaGetMark(swArena arena);
+void swArenaRelease(swArena arena, swArenaMark mark);
+// Release everything.  Blocks are kept for reuse.
+void swArenaReset(swArena arena);
+// Free blocks beyond the first maxBytes of capacity.  Call after swArenaReset.
+void swArenaTrim(swArena arena, size_t maxBytes);
+// Return the total size of the arena's blocks.
+size_t swArenaCapacity(swArena arena);
+
+#endif  // SW_ARENA_H
@@ -0,0 +1,382 @@
+// Microbenchmarks for the CPU side of the text path: UTF-8 validation, NFC,
+// lexicons, speak command preparation at each punctuation level, ANSI to ASCII
+// conversion, paragraph reading, and the hex audio codec.  Text benchmarks run
+// on corpora of ASCII prose, mixed European text, CJK, and emoji-heavy chat,
+// and report MB/s and ns per character.  No TTS library is needed.
+//
+// Usage: sw-bench [-m megabytes] [name]
+//
+// With a name, only benchmarks whose names start with it are run.
+
+// For clock_gettime.
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ansi2ascii.h"
+#include "arena.h"
+#include "lexicon.h"
+#include "nfc.h"
+#include "speechsw.h"
+#include "utf8.h"
+#include "util.h"
+
+#define DEFAULT_MEGABYTES 4
+#define MIN_SECONDS 0.25
+#define NUM_LEXICON_ENTRIES 2000
+#define NUM_SAMPLES (1 << 20)
+#define MAX_PARAGRAPH 2048
+#define MIN_PARAGRAPH 1024
+
+typedef struct {
+  const char *name;
+  char *text;
+  size_t length;
+  size_t numChars;
+  char *ansiText;  // The text in CP1252, without what it cannot encode.
+  size_t ansiLength;
+} swCorpus;
+
+static const char *swASCIISentences[] = {
+  "The quick brown fox jumps over the lazy dog. ",
+  "Dr. Smith's office (room 42) opens at 9:30 a.m., doesn't it? ",
+  "Revenue grew 12% to $3.4 billion; costs fell by 1/3. ",
+  "\"Never,\" she said -- and meant it! ",
+  "Send e-mail to support@example.com, or call 555-0100 #2. ",
+  NULL
+};
+
+static const char *swEuropeanSentences[] = {
+  "Le cœur déçu mais l'âme plutôt naïve, Louÿs rêva de crapaüter. ",
+  "Zwölf Boxkämpfer jagen Viktor quer über den großen Sylter Deich. ",
+  "¿Por qué no? El pingüino comió jamón en Cádiz — ¡qué rico! ",
+  "Zażółć gęślą jaźń, powiedział „pan” Wójcik. ",
+  "Γαζέες καὶ μυρτιὲς δὲν θὰ βρῶ πιὰ στὸ χρυσαφὶ ξέφωτο. ",
+  "Prix: 12,50 € « toutes taxes comprises » – voilà… ",
+  NULL
+};
+
+static const char *swCJKSentences[] = {
+  "日本語のテキストを読み上げます。",
+  "東京都（とうきょうと）は、日本の首都です。",
+  "我们今天下午三点在会议室开会，请准时参加！",
+  "「こんにちは」と彼女は言った。",
+  "서울은 대한민국의 수도입니다. ",
+  NULL
+};
+
+static const char *swChatSentences[] = {
+  "lol 😂😂😂 see u @ 5pm!!! ",
+  "omg that's sooo good 👍🏽🔥 #winning ",
+  "brb, grabbing ☕ … back in 5 ",
+  "family pic 👨‍👩‍👧‍👦 from the 🏖️ trip :) ",
+  "ok ok 🙏 thx!! <3 ",
+  "can't wait 🎉🎂🥳 happy bday!!! ",
+  NULL
+};
+
+static swEngine swUTF8Engine;
+static swEngine swANSIEngine;
+static swLexicon swBenchLexicon;
+static swArena swBenchArena;
+static const char *swFilter;
+
+// Return the time in seconds.
+static double now(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec + time.tv_nsec*1e-9;
+}
+
+// Fill a corpus with randomly chosen sentences, up to size bytes, and make its
+// CP1252 copy.
+static void buildCorpus(swCorpus *corpus, const char *name, const char **sentences,
+    size_t size) {
+  uint32_t numSentences = 0;
+  while (sentences[numSentences] != NULL) {
+    numSentences++;
+  }
+  corpus->name = name;
+  corpus->text = swCalloc(size + 1, sizeof(char));
+  size_t pos = 0;
+  while (true) {
+    const char *sentence = sentences[rand() % numSentences];
+    size_t len = strlen(sentence);
+    if (pos + len > size) {
+      break;
+    }
+    memcpy(corpus->text + pos, sentence, len);
+    pos += len;
+  }
+  corpus->length = pos;
+  corpus->ansiText = swCalloc(pos + 1, sizeof(char));
+  corpus->numChars = 0;
+  char *out = corpus->ansiText;
+  const char *p = corpus->text;
+  const char *end = p + pos;
+  while (p < end) {
+    bool valid;
+    uint32_t unicodeChar;
+    p += swFindUTF8LengthAndValidate(p, end - p, &valid, &unicodeChar);
+    corpus->numChars++;
+    char ansiChar = unicodeChar < 0x80? unicodeChar : swUnicodeToAnsi(unicodeChar);
+    if (ansiChar != 0) {
+      *out++ = ansiChar;
+    }
+  }
+  corpus->ansiLength = out - corpus->ansiText;
+}
+
+// Build a lexicon of made-up names, plus a few words that are in the corpora.
+static swLexicon buildLexicon(void) {
+  static const char *realKeys[] = {"fox", "Dr", "e-mail", "Viktor", "jamón", "lol",
+      "omg", "brb", "thx", "bday"};
+  uint32_t numRealKeys = sizeof(realKeys)/sizeof(char *);
+  swLexiconEntry *entries = swCalloc(NUM_LEXICON_ENTRIES, sizeof(swLexiconEntry));
+  for (uint32_t i = 0; i < NUM_LEXICON_ENTRIES; i++) {
+    if (i < numRealKeys) {
+      entries[i].key = swCopyString(realKeys[i]);
+    } else {
+      entries[i].key = swSprintf("%c%cx%u", 'a' + i % 26, 'a' + (i/26) % 26, i);
+    }
+    entries[i].replacement = swSprintf("word %u", i);
+  }
+  swLexicon lexicon = swLexiconBuild(entries, NUM_LEXICON_ENTRIES);
+  for (uint32_t i = 0; i < NUM_LEXICON_ENTRIES; i++) {
+    swFree((char *)entries[i].key);
+    swFree((char *)entries[i].replacement);
+  }
+  swFree(entries);
+  return lexicon;
+}
+
+// Validate a character at a time, as the engine and swSpeakChar do.
+static size_t benchValidate(const swCorpus *corpus) {
+  size_t numValid = 0;
+  const char *p = corpus->text;
+  const char *end = p + corpus->length;
+  while (p < end) {
+    bool valid;
+    p += swFindUTF8LengthAndValidate(p, end - p, &valid, NULL);
+    numValid += valid;
+  }
+  return numValid;
+}
+
+static size_t benchCompact(const swCorpus *corpus) {
+  char *dest = swArenaAlloc(swBenchArena, corpus->length);
+  size_t length = swCompactUTF8(dest, corpus->text, corpus->length);
+  swArenaReset(swBenchArena);
+  return length;
+}
+
+static size_t benchNFC(const swCorpus *corpus) {
+  size_t length;
+  swNormalizeNFC(swBenchArena, corpus->text, corpus->length, &length);
+  swArenaReset(swBenchArena);
+  return length;
+}
+
+static size_t benchLexicon(const swCorpus *corpus) {
+  size_t length;
+  swLexiconApply(swBenchLexicon, swBenchArena, corpus->text, corpus->length, &length);
+  swArenaReset(swBenchArena);
+  return length;
+}
+
+// Prepare the speak command at one punctuation level.
+static size_t benchPrepare(const swCorpus *corpus, swPunctuationLevel level) {
+  swSetPunctuation(swUTF8Engine, level);
+  return swPrepareText(swUTF8Engine, corpus->text, true);
+}
+
+static size_t benchPrepareNone(const swCorpus *corpus) {
+  return benchPrepare(corpus, SW_PUNCT_NONE);
+}
+
+static size_t benchPrepareSome(const swCorpus *corpus) {
+  return benchPrepare(corpus, SW_PUNCT_SOME);
+}
+
+static size_t benchPrepareMost(const swCorpus *corpus) {
+  return benchPrepare(corpus, SW_PUNCT_MOST);
+}
+
+static size_t benchPrepareAll(const swCorpus *corpus) {
+  return benchPrepare(corpus, SW_PUNCT_ALL);
+}
+
+// Prepare the speak command for an engine that takes CP1252.
+static size_t benchPrepareANSI(const swCorpus *corpus) {
+  return swPrepareText(swANSIEngine, corpus->text, true);
+}
+
+// Convert a character at a time, as sw-say -a used to.
+static size_t benchANSIChar(const swCorpus *corpus) {
+  size_t length = 0;
+  for (size_t i = 0; i < corpus->ansiLength; i++) {
+    length += strlen(swConvertANSIToASCII(corpus->ansiText[i]));
+  }
+  return length;
+}
+
+static size_t benchANSIBuffer(const swCorpus *corpus) {
+  char *dest = swArenaAlloc(swBenchArena, corpus->ansiLength*SW_ANSI_MAX_EXPANSION);
+  swANSIState state;
+  swInitANSIState(&state);
+  size_t length = swConvertANSIBufferToASCII(&state, dest, corpus->ansiText,
+      corpus->ansiLength);
+  swArenaReset(swBenchArena);
+  return length;
+}
+
+// Read the corpus a paragraph at a time, as sw-say -f does.
+static size_t benchParagraph(const swCorpus *corpus) {
+  static FILE *file;
+  static const swCorpus *fileCorpus;
+  if (fileCorpus != corpus) {
+    if (file != NULL) {
+      fclose(file);
+    }
+    file = tmpfile();
+    fwrite(corpus->text, 1, corpus->length, file);
+    fileCorpus = corpus;
+  }
+  rewind(file);
+  char paragraph[MAX_PARAGRAPH + 1];
+  uint32_t length;
+  size_t total = 0;
+  while (swReadParagraph(file, paragraph, MIN_PARAGRAPH, MAX_PARAGRAPH, &length)) {
+    total += length;
+  }
+  return total;
+}
+
+typedef size_t (*swBenchFunc)(const swCorpus *corpus);
+
+typedef struct {
+  const char *name;
+  swBenchFunc func;
+  bool useANSIText;
+} swBenchmark;
+
+static const swBenchmark swBenchmarks[] = {
+  {"validate", benchValidate, false},
+  {"compact", benchCompact, false},
+  {"nfc", benchNFC, false},
+  {"lexicon", benchLexicon, false},
+  {"prepare-none", benchPrepareNone, false},
+  {"prepare-some", benchPrepareSome, false},
+  {"prepare-most", benchPrepareMost, false},
+  {"prepare-all", benchPrepareAll, false},
+  {"prepare-ansi", benchPrepareANSI, false},
+  {"ansi2ascii-char", benchANSIChar, true},
+  {"ansi2ascii-buffer", benchANSIBuffer, true},
+  {"paragraph", benchParagraph, false},
+};
+
+// Return true if the benchmark was selected on the command line.
+static bool selected(const char *name) {
+  return swFilter == NULL || !strncmp(name, swFilter, strlen(swFilter));
+}
+
+// Run a benchmark until MIN_SECONDS have passed, and print its speed.
+static void runBenchmark(const swBenchmark *benchmark, const swCorpus *corpus) {
+  size_t bytes = benchmark->useANSIText? corpus->ansiLength : corpus->length;
+  // CP1252 has one byte per character.
+  size_t numChars = benchmark->useANSIText? corpus->ansiLength : corpus->numChars;
+  volatile size_t result = 0;
+  uint32_t rounds = 0;
+  double start = now();
+  double seconds;
+  do {
+    result += benchmark->func(corpus);
+    rounds++;
+    seconds = now() - start;
+  } while (seconds < MIN_SECONDS);
+  printf("%-18s %-9s %10.1f %9.2f\n", benchmark->name, corpus->name,
+      (double)bytes*rounds/seconds/1e6, seconds*1e9/((double)numChars*rounds));
+}
+
+// Measure the hex codec used for audio between engines and the client.
+static void runHexBenchmarks(void) {
+  int16_t *samples = swCalloc(NUM_SAMPLES, sizeof(int16_t));
+  for (uint32_t i = 0; i < NUM_SAMPLES; i++) {
+    samples[i] = (int16_t)(rand() - RAND_MAX/2);
+  }
+  char *hex = swCalloc(NUM_SAMPLES*4 + 1, sizeof(char));
+  const char *names[] = {"hex-encode", "hex-decode"};
+  for (uint32_t test = 0; test < 2; test++) {
+    if (!selected(names[test])) {
+      continue;
+    }
+    volatile uint32_t result = 0;
+    uint32_t rounds = 0;
+    double start = now();
+    double seconds;
+    do {
+      if (test == 0) {
+        swConvertInt16ToHex(hex, samples, NUM_SAMPLES);
+      } else {
+        result += swConvertHexToInt16(samples, hex);
+      }
+      rounds++;
+      seconds = now() - start;
+    } while (seconds < MIN_SECONDS);
+    printf("%-18s %-9s %10.1f %9.2f\n", names[test], "samples",
+        (double)NUM_SAMPLES*4*rounds/seconds/1e6, seconds*1e9/((double)NUM_SAMPLES*rounds));
+  }
+  swFree(samples);
+  swFree(hex);
+}
+
+int main(int argc, char **argv) {
+  size_t megabytes = DEFAULT_MEGABYTES;
+  int opt;
+  while ((opt = getopt(argc, argv, "m:")) != -1) {
+    if (opt == 'm' && atoi(optarg) > 0) {
+      megabytes = atoi(optarg);
+    } else {
+      fprintf(stderr, "Usage: sw-bench [-m megabytes] [name]\n");
+      return 1;
+    }
+  }
+  if (optind < argc) {
+    swFilter = argv[optind];
+  }
+  srand(1);
+  swCorpus corpora[4];
+  size_t size = megabytes << 20;
+  buildCorpus(corpora + 0, "ascii", swASCIISentences, size);
+  buildCorpus(corpora + 1, "european", swEuropeanSentences, size);
+  buildCorpus(corpora + 2, "cjk", swCJKSentences, size);
+  buildCorpus(corpora + 3, "chat", swChatSentences, size);
+  swUTF8Engine = swStartOffline(NULL, SW_UTF8);
+  swANSIEngine = swStartOffline(NULL, SW_ANSI);
+  swBenchLexicon = buildLexicon();
+  swBenchArena = swArenaCreate(1 << 16);
+  printf("%-18s %-9s %10s %9s\n", "benchmark", "corpus", "MB/s", "ns/char");
+  for (uint32_t i = 0; i < sizeof(swBenchmarks)/sizeof(swBenchmark); i++) {
+    if (selected(swBenchmarks[i].name)) {
+      for (uint32_t j = 0; j < 4; j++) {
+        runBenchmark(swBenchmarks + i, corpora + j);
+      }
+    }
+  }
+  runHexBenchmarks();
+  swStop(swUTF8Engine);
+  swStop(swANSIEngine);
+  swLexiconFree(swBenchLexicon);
+  swArenaDestroy(swBenchArena);
+  for (uint32_t j = 0; j < 4; j++) {
+    swFree(corpora[j].text);
+    swFree(corpora[j].ansiText);
+  }
+  return 0;
+}
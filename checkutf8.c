@@ -1,123 +1,253 @@
+// Correctness and throughput checks for the UTF-8 validators.
+//
+// With no arguments, swCompactUTF8 is compared against a character-at-a-time
+// reference built on swFindUTF8LengthAndValidate, at every SIMD level the CPU
+// supports, on random text salted with every kind of bad sequence, and then its
+// throughput is measured.  With -i, swFindUTF8LengthAndValidate is also
+// cross-checked against iconv for every 4-byte input, which takes a while.
+
+// For clock_gettime.
+#define _POSIX_C_SOURCE 200112L
+
+#include <iconv.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
-#include <iconv.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
 
-/* Return the length of the UTF-8 character pointed to by p.  Check that the
-   encoding seems valid. We do the full check as defined on Wikipedia because
-   so many applications, likely including commercial TTS engines, leave security
-   holes open through UTF-8 encoding attacks. */
-static int findLengthAndValidate(char *p, bool *valid)
-{
-    int length, expectedLength, bits;
-    unsigned long unicodeCharacter;
-    unsigned char c = (unsigned char)*p;
+#include "utf8.h"
+#include "util.h"
 
-    *valid = true;
-    if((c & 0x80) == 0) {
-        // It's ASCII 
-        /* temp: Commented out for matching iconv
-        if(c < ' ') {
-            // It's a control character - remove it. 
-            *valid = false;
-        }
-        */
-        return 1;
+#define MAX_RANDOM_LENGTH 300
+#define RANDOM_TESTS 200000
+#define THROUGHPUT_BYTES (1 << 24)
+#define THROUGHPUT_ROUNDS 20
+
+static const char *levelNames[] = {"scalar", "sse4", "avx2"};
+
+// Sequences that must be dropped, and valid ones near the edges of the rules.
+static const char *edgeCases[] = {
+  "\xc0\x80", "\xc1\xbf", "\xc2\x80", "\xdf\xbf",  // Overlong, then the first valid.
+  "\xe0\x80\x80", "\xe0\x9f\xbf", "\xe0\xa0\x80", "\xef\xbf\xbf",
+  "\xed\x9f\xbf", "\xed\xa0\x80", "\xed\xbf\xbf", "\xee\x80\x80",  // Surrogates.
+  "\xf0\x80\x80\x80", "\xf0\x8f\xbf\xbf", "\xf0\x90\x80\x80",
+  "\xf4\x8f\xbf\xbf", "\xf4\x90\x80\x80", "\xf5\x80\x80\x80",  // Above 0x10ffff.
+  "\xf8\x88\x80\x80\x80", "\xfc\x84\x80\x80\x80\x80", "\xfe", "\xff",
+  "\x80", "\xbf", "\x80\x80", "\xc3", "\xe2\x82", "\xf0\x9f\x98",  // Stray or cut off.
+  "\xc3\xa9\xa9", "\xe2\x82\xac\x80",  // Too many continuation bytes.
+  "\x01", "\t", "\n", "\x1f", "\x7f", " "
+};
+
+// Compact text a character at a time.
+static size_t referenceCompact(char *dest, const char *text, size_t length) {
+  size_t destLen = 0;
+  size_t pos = 0;
+  while (pos < length) {
+    bool valid;
+    size_t charLen = swFindUTF8LengthAndValidate(text + pos, length - pos, &valid, NULL);
+    if (valid) {
+      memcpy(dest + destLen, text + pos, charLen);
+      destLen += charLen;
     }
-    c <<= 1;
-    expectedLength = 1;
-    while(c & 0x80) {
-        expectedLength++;
-        c <<= 1;
+    pos += charLen;
+  }
+  return destLen;
+}
+
+// Append a random piece of text to buf, and return its new length.
+static size_t addRandomPiece(char *buf, size_t pos) {
+  char piece[8];
+  size_t len = 0;
+  switch (rand() % 8) {
+  case 0:
+  case 1:
+    // A run of ASCII, long enough to fill SIMD blocks.
+    len = 1 + rand() % 7;
+    for (size_t i = 0; i < len; i++) {
+      piece[i] = 'a' + rand() % 26;
     }
-    unicodeCharacter = c >> expectedLength;
-    bits = 7 - expectedLength;
-    if(expectedLength > 4 || expectedLength == 1) {
-        // No unicode values are coded for more than 4 bytes 
-        *valid = false;
+    break;
+  case 2:
+  case 3: {
+    // A valid character of random length.
+    uint32_t ranges[] = {0x80, 0x800, 0x10000, 0x110000};
+    uint32_t bits = rand() % 4;
+    uint32_t low = bits == 0? 0x20 : ranges[bits - 1];
+    uint32_t c = low + rand() % (ranges[bits] - low);
+    if (c >= 0xd800 && c <= 0xdfff) {
+      c = 'x';
     }
-    if(expectedLength == 1 || (expectedLength == 2 && unicodeCharacter <= 1)) {
-        // We could have coded this as ASCII 
-        *valid = false;
+    len = swEncodeUTF8(c, piece);
+    break;
+  }
+  case 4:
+  case 5: {
+    const char *edgeCase = edgeCases[rand() % (sizeof(edgeCases)/sizeof(char *))];
+    len = strlen(edgeCase);
+    memcpy(piece, edgeCase, len);
+    break;
+  }
+  default:
+    // Random bytes, mostly in the multibyte range.
+    len = 1 + rand() % 4;
+    for (size_t i = 0; i < len; i++) {
+      piece[i] = 0x80 | rand();
     }
-    length = 1;
-    c = *++p;
-    while((c & 0xc0) == 0x80) {
-        unicodeCharacter = (unicodeCharacter << 6) | (c & 0x3f);
-        bits += 6;
-        length++;
-        c = *++p;
+    break;
+  }
+  if (pos + len > MAX_RANDOM_LENGTH) {
+    return pos;
+  }
+  memcpy(buf + pos, piece, len);
+  return pos + len;
+}
+
+// Compare swCompactUTF8 to the reference on random text at the current SIMD
+// level, both in place and into a separate buffer.  Return the failure count.
+static uint32_t checkRandom(swSimdLevel level) {
+  char text[MAX_RANDOM_LENGTH], expected[MAX_RANDOM_LENGTH];
+  char inPlace[MAX_RANDOM_LENGTH], copied[MAX_RANDOM_LENGTH];
+  uint32_t failures = 0;
+  srand(123456789);
+  for (uint32_t test = 0; test < RANDOM_TESTS; test++) {
+    size_t targetLen = rand() % MAX_RANDOM_LENGTH;
+    size_t length = 0;
+    while (length < targetLen) {
+      size_t newLength = addRandomPiece(text, length);
+      if (newLength == length) {
+        break;
+      }
+      length = newLength;
+    }
+    size_t expectedLen = referenceCompact(expected, text, length);
+    memcpy(inPlace, text, length);
+    size_t inPlaceLen = swCompactUTF8(inPlace, inPlace, length);
+    size_t copiedLen = swCompactUTF8(copied, text, length);
+    if (inPlaceLen != expectedLen || memcmp(inPlace, expected, expectedLen) ||
+        copiedLen != expectedLen || memcmp(copied, expected, expectedLen)) {
+      if (failures++ < 10) {
+        printf("%s: mismatch on test %u:", levelNames[level], test);
+        for (size_t i = 0; i < length; i++) {
+          printf(" %02x", (uint8_t)text[i]);
+        }
+        printf("\n");
+      }
     }
-    if(length != expectedLength || unicodeCharacter > 0x10ffff ||
-        (unicodeCharacter >= 0xd800 && unicodeCharacter <= 0xdfff)) {
-        /* Unicode only defines characters up to 0x10ffff, and excludes values
-           0xd800 through 0xdfff */
-        *valid = false;
+  }
+  return failures;
+}
+
+// Check swFindUTF8LengthAndValidate against iconv for every 4-byte input.
+// iconv accepts control characters, so they count as valid here.  Return the
+// failure count.
+static uint32_t checkIconv(void) {
+  iconv_t cd = iconv_open("UTF-32", "UTF-8");
+  uint32_t value = 0;
+  uint8_t inbuf[10] = {0};
+  uint8_t outbuf[50];
+  uint32_t failures = 0;
+  do {
+    inbuf[0] = value & 0xff;
+    inbuf[1] = (value >> 8) & 0xff;
+    inbuf[2] = (value >> 16) & 0xff;
+    inbuf[3] = (value >> 24) & 0xff;
+    char *inp = (char *)inbuf;
+    char *outp = (char *)outbuf;
+    size_t inlength = sizeof(inbuf);
+    size_t outlength = sizeof(outbuf);
+    bool iconvValid = iconv(cd, &inp, &inlength, &outp, &outlength) != (size_t)-1;
+    iconv(cd, NULL, NULL, NULL, NULL);
+    bool meValid;
+    size_t pos = 0;
+    do {
+      size_t length = swFindUTF8LengthAndValidate((char *)inbuf + pos, sizeof(inbuf) - pos,
+          &meValid, NULL);
+      meValid |= inbuf[pos] < ' ';
+      pos += length;
+    } while(meValid && pos < 4);
+    if (iconvValid != meValid) {
+      if (failures++ < 10) {
+        printf("iconv = %s me = %s for 0x%02x%02x%02x%02x\n", iconvValid? "true" : "false",
+            meValid? "true" : "false", inbuf[0], inbuf[1], inbuf[2], inbuf[3]);
+      }
     }
-    /* Check to see if we could have encoded the character in the next smaller
-       number of bits, in which case it's invalid. */
-    if(unicodeCharacter >> (bits - 5) == 0) {
-        *valid = false;
+    value++;
+    if ((value & 0xffffff) == 0) {
+      printf("checked through 0x%x\n", value);
+      fflush(stdout);
     }
-    return length;
+  } while(value != 0);
+  iconv_close(cd);
+  return failures;
 }
 
-int main()
-{
-    iconv_t cd = iconv_open("UTF-32", "UTF-8");
-    unsigned int value = 0;
-    size_t inlength, outlength;
-    unsigned char inbuf[10], outbuf[50];
-    char *inp, *outp;
-    size_t result;
-    bool iconvValid, meValid;
-    int length;
-    bool randFlipMe, randFlipIconv;
+// Fill buf with copies of sample.
+static void fillText(char *buf, size_t length, const char *sample) {
+  size_t sampleLen = strlen(sample);
+  for (size_t pos = 0; pos < length; pos += sampleLen) {
+    size_t len = length - pos < sampleLen? length - pos : sampleLen;
+    memcpy(buf + pos, sample, len);
+  }
+}
 
-    srand(123456789);
-    inbuf[4] = 0;
-    inbuf[5] = 0;
-    inbuf[6] = 0;
-    inbuf[7] = 0;
-    inbuf[8] = 0;
-    inbuf[9] = 0;
-    do {
-        // Let's force them to disagree now and then and make sure we catch it.
-        randFlipMe = (rand() & 0xfffff) == 0;
-        randFlipIconv = (rand() & 0xfffff) == 0;
-        inlength = 10;
-        outlength = 50;
-        inp = inbuf;
-        outp = outbuf;
-        inbuf[0] = value & 0xff;
-        inbuf[1] = (value >> 8) & 0xff;
-        inbuf[2] = (value >> 16) & 0xff;
-        inbuf[3] = (value >> 24) & 0xff;
-        result = iconv(cd, &inp, &inlength, &outp, &outlength);
-        iconvValid = true;
-        if(result == -1) {
-            iconvValid = false;
-        }
-        iconvValid ^= randFlipIconv;
-        inp = inbuf;
-        do {
-            length = findLengthAndValidate(inp, &meValid);
-            inp += length;
-        } while(meValid && inp - (char *)inbuf < 4);
-        meValid ^= randFlipMe;
-        if(iconvValid != meValid) {
-            if(randFlipMe != randFlipIconv) {
-                printf("Ignore this: ");
-            }
-            printf("iconv = %s me = %s for 0x%02x%02x%02x%02x, length = %d\n",
-                iconvValid? "true" : "false", meValid? "true" : "false",
-                inbuf[0], inbuf[1], inbuf[2], inbuf[3], length);
-            fflush(stdout);
-        }
-        value++;
-        if((value & 0xffffff) == 0) {
-            printf("checked through 0x%x\n", value);
-            fflush(stdout);
-        }
-    } while(value != 0);
-    return 0;
+// Return the time in seconds.
+static double now(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec + time.tv_nsec*1e-9;
+}
+
+// Print the throughput of swCompactUTF8 in MB/s on one kind of text.
+static void measureThroughput(const char *name, const char *sample, swSimdLevel maxLevel) {
+  char *text = swCalloc(THROUGHPUT_BYTES, sizeof(char));
+  char *dest = swCalloc(THROUGHPUT_BYTES, sizeof(char));
+  fillText(text, THROUGHPUT_BYTES, sample);
+  printf("%-10s", name);
+  for (swSimdLevel level = SW_SIMD_NONE; level <= maxLevel; level++) {
+    swSetMaxSimdLevel(level);
+    double start = now();
+    for (uint32_t i = 0; i < THROUGHPUT_ROUNDS; i++) {
+      swCompactUTF8(dest, text, THROUGHPUT_BYTES);
+    }
+    double seconds = now() - start;
+    printf(" %8s %8.0f MB/s", levelNames[level],
+        (double)THROUGHPUT_BYTES*THROUGHPUT_ROUNDS/seconds/1e6);
+  }
+  printf("\n");
+  swFree(text);
+  swFree(dest);
+}
+
+int main(int argc, char **argv) {
+  bool useIconv = false;
+  int opt;
+  while ((opt = getopt(argc, argv, "i")) != -1) {
+    if (opt == 'i') {
+      useIconv = true;
+    } else {
+      fprintf(stderr, "Usage: checkutf8 [-i]\n");
+      return 1;
+    }
+  }
+  uint32_t failures = 0;
+  if (useIconv) {
+    failures += checkIconv();
+  }
+  swSimdLevel maxLevel = swGetSimdLevel();
+  for (swSimdLevel level = SW_SIMD_NONE; level <= maxLevel; level++) {
+    swSetMaxSimdLevel(level);
+    uint32_t levelFailures = checkRandom(level);
+    printf("%s: %u random tests, %u failures\n", levelNames[level], RANDOM_TESTS,
+        levelFailures);
+    failures += levelFailures;
+  }
+  measureThroughput("ascii", "The quick brown fox jumps over the lazy dog. ", maxLevel);
+  measureThroughput("latin", "Le cœur déçu mais l'âme plutôt naïve. ", maxLevel);
+  measureThroughput("cjk", "日本語のテキストを読み上げます。", maxLevel);
+  measureThroughput("invalid", "Mostly fine text \xc0\xaf with a bad byte. ", maxLevel);
+  swSetMaxSimdLevel(maxLevel);
+  return failures != 0;
 }
@@ -0,0 +1,514 @@
+// Audio post-processing of an engine's samples.  See dsp.h.
+//
+// The chain is an array of the stages that are enabled, rebuilt when one is
+// turned on or off.  Built-in stages use the same swDspStage interface as added
+// ones.  Gain is applied in 4.12 fixed point, widened to 32 bits, and clipped
+// by saturating packs in the SIMD paths.  Overflow repair depends on the
+// previous sample, so when it is on, the fused pass runs a sample at a time.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SW_DSP_SIMD
+#endif
+
+#include <sonic.h>
+
+#include "dsp.h"
+#include "resample.h"
+#include "trace.h"
+#include "util.h"
+
+#define GAIN_BITS 12
+#define UNITY_GAIN (1 << GAIN_BITS)
+// Samples this quiet or quieter are silence, about -54 dB.
+#define SILENCE_LEVEL 64
+
+typedef struct {
+  swDspStage stage;
+  void *context;
+} swDspSlot;
+
+typedef struct {
+  sonicStream stream;
+  int16_t *buffer;
+  uint32_t bufferSize;
+} swSonicStage;
+
+typedef struct {
+  bool started;  // Set once the utterance is no longer silent.
+  // Silence at the end of the samples so far, held back until more speech.
+  int16_t *held;
+  uint32_t numHeld;
+  uint32_t heldSize;
+  int16_t *buffer;
+  uint32_t bufferSize;
+} swTrimStage;
+
+struct swDspSt {
+  uint32_t sampleRate;
+  uint32_t outputRate;
+  bool repair;
+  int32_t prevSample;  // The last repaired sample, before clipping.
+  int32_t gain;
+  float speed;
+  float pitch;
+  swTrimStage *trim;
+  swSonicStage *sonic;
+  swResampler resampler;
+  swDspSlot addedStages[SW_DSP_MAX_STAGES];
+  uint32_t numAddedStages;
+  // The enabled stages, in order.
+  swDspSlot stages[SW_DSP_MAX_STAGES + 3];
+  uint32_t numStages;
+  int16_t *flushBuffer;
+  uint32_t flushBufferSize;
+};
+
+// Grow a buffer to hold at least numSamples.
+static int16_t *growBuffer(int16_t *buffer, uint32_t *bufferSize, uint32_t numSamples) {
+  if (numSamples > *bufferSize) {
+    *bufferSize = numSamples + (numSamples >> 1);
+    buffer = swRealloc(buffer, *bufferSize, sizeof(int16_t));
+  }
+  return buffer;
+}
+
+// Clip a 32-bit sample to int16.
+static inline int16_t clip(int32_t sample) {
+  if (sample > INT16_MAX) {
+    return INT16_MAX;
+  }
+  if (sample < INT16_MIN) {
+    return INT16_MIN;
+  }
+  return sample;
+}
+
+// Repair, scale and clip one sample at a time.  A jump of more than half the
+// range from the previous sample is taken to be a wrap-around, which is off by
+// 0x10000.
+static void pointScalar(swDsp dsp, int16_t *samples, uint32_t numSamples) {
+  int32_t prevSample = dsp->prevSample;
+  int32_t gain = dsp->gain;
+  for (uint32_t i = 0; i < numSamples; i++) {
+    int32_t sample = samples[i];
+    if (dsp->repair) {
+      if (sample > prevSample + 0x8000) {
+        sample -= 0x10000;
+      } else if (sample < prevSample - 0x8000) {
+        sample += 0x10000;
+      }
+      prevSample = sample;
+    }
+    if (gain != UNITY_GAIN) {
+      sample = (sample*gain + (1 << (GAIN_BITS - 1))) >> GAIN_BITS;
+    }
+    samples[i] = clip(sample);
+  }
+  dsp->prevSample = prevSample;
+}
+
+#ifdef SW_DSP_SIMD
+
+// Scale 8 samples at a time.
+__attribute__((target("sse4.1")))
+static uint32_t gainSSE4(int16_t *samples, uint32_t numSamples, int32_t gain) {
+  __m128i factor = _mm_set1_epi32(gain);
+  __m128i round = _mm_set1_epi32(1 << (GAIN_BITS - 1));
+  uint32_t i = 0;
+  for (; i + 8 <= numSamples; i += 8) {
+    __m128i input = _mm_loadu_si128((const __m128i *)(samples + i));
+    __m128i low = _mm_cvtepi16_epi32(input);
+    __m128i high = _mm_cvtepi16_epi32(_mm_srli_si128(input, 8));
+    low = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(low, factor), round), GAIN_BITS);
+    high = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(high, factor), round), GAIN_BITS);
+    _mm_storeu_si128((__m128i *)(samples + i), _mm_packs_epi32(low, high));
+  }
+  return i;
+}
+
+// Scale 16 samples at a time.  The pack works within 128-bit lanes, so its
+// quarters are put back in order.
+__attribute__((target("avx2")))
+static uint32_t gainAVX2(int16_t *samples, uint32_t numSamples, int32_t gain) {
+  __m256i factor = _mm256_set1_epi32(gain);
+  __m256i round = _mm256_set1_epi32(1 << (GAIN_BITS - 1));
+  uint32_t i = 0;
+  for (; i + 16 <= numSamples; i += 16) {
+    __m256i input = _mm256_loadu_si256((const __m256i *)(samples + i));
+    __m256i low = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(input));
+    __m256i high = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(input, 1));
+    low = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(low, factor), round),
+        GAIN_BITS);
+    high = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(high, factor), round),
+        GAIN_BITS);
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), 0xd8);
+    _mm256_storeu_si256((__m256i *)(samples + i), packed);
+  }
+  return i;
+}
+
+#endif  // SW_DSP_SIMD
+
+// Run the one-sample stages over the buffer in a single pass.
+static void runPointStages(swDsp dsp, int16_t *samples, uint32_t numSamples) {
+  if (dsp->repair) {
+    pointScalar(dsp, samples, numSamples);
+    return;
+  }
+  if (dsp->gain == UNITY_GAIN) {
+    return;
+  }
+  uint32_t done = 0;
+#ifdef SW_DSP_SIMD
+  switch (swGetSimdLevel()) {
+  case SW_SIMD_AVX2:
+    done = gainAVX2(samples, numSamples, dsp->gain);
+    break;
+  case SW_SIMD_SSE4:
+    done = gainSSE4(samples, numSamples, dsp->gain);
+    break;
+  case SW_SIMD_NONE:
+    break;
+  }
+#endif
+  pointScalar(dsp, samples + done, numSamples - done);
+}
+
+// Append samples to the trim stage's held silence.
+static void holdSilence(swTrimStage *trim, int16_t *samples, uint32_t numSamples) {
+  if (numSamples == 0) {
+    return;
+  }
+  trim->held = growBuffer(trim->held, &trim->heldSize, trim->numHeld + numSamples);
+  memcpy(trim->held + trim->numHeld, samples, numSamples*sizeof(int16_t));
+  trim->numHeld += numSamples;
+}
+
+// Drop leading silence, and hold back trailing silence until more speech comes.
+// Without held silence, the output is the input, trimmed.
+static uint32_t trimProcess(void *context, int16_t *samples, uint32_t numSamples,
+    int16_t **output) {
+  swTrimStage *trim = context;
+  uint32_t start = 0;
+  if (!trim->started) {
+    while (start < numSamples && abs(samples[start]) <= SILENCE_LEVEL) {
+      start++;
+    }
+    if (start == numSamples) {
+      return 0;
+    }
+    trim->started = true;
+  }
+  uint32_t end = numSamples;
+  while (end > start && abs(samples[end - 1]) <= SILENCE_LEVEL) {
+    end--;
+  }
+  if (end == start) {
+    holdSilence(trim, samples + start, numSamples - start);
+    return 0;
+  }
+  uint32_t length = end - start;
+  if (trim->numHeld == 0) {
+    *output = samples + start;
+  } else {
+    length += trim->numHeld;
+    trim->buffer = growBuffer(trim->buffer, &trim->bufferSize, length);
+    memcpy(trim->buffer, trim->held, trim->numHeld*sizeof(int16_t));
+    memcpy(trim->buffer + trim->numHeld, samples + start, (end - start)*sizeof(int16_t));
+    trim->numHeld = 0;
+    *output = trim->buffer;
+  }
+  holdSilence(trim, samples + end, numSamples - end);
+  return length;
+}
+
+// Forget the utterance, dropping its trailing silence.
+static void trimReset(void *context) {
+  swTrimStage *trim = context;
+  trim->started = false;
+  trim->numHeld = 0;
+}
+
+// Trailing silence is dropped.
+static uint32_t trimFlush(void *context, int16_t **output) {
+  trimReset(context);
+  return 0;
+}
+
+// Free the trim stage.
+static void trimDestroy(void *context) {
+  swTrimStage *trim = context;
+  swFree(trim->held);
+  swFree(trim->buffer);
+  swFree(trim);
+}
+
+static const swDspStage trimStage = {"trim", trimProcess, trimFlush, trimReset, trimDestroy};
+
+// Read all the samples Sonic has ready into its buffer.
+static uint32_t readSonic(swSonicStage *sonic, int16_t **output) {
+  uint32_t numSamples = sonicSamplesAvailable(sonic->stream);
+  if (numSamples == 0) {
+    return 0;
+  }
+  sonic->buffer = growBuffer(sonic->buffer, &sonic->bufferSize, numSamples);
+  if (sonicReadShortFromStream(sonic->stream, sonic->buffer, numSamples) != numSamples) {
+    fprintf(stderr, "Error reading from sonic stream\n");
+    exit(1);
+  }
+  *output = sonic->buffer;
+  return numSamples;
+}
+
+// Run Sonic to adjust speed and/or pitch.
+static uint32_t sonicProcess(void *context, int16_t *samples, uint32_t numSamples,
+    int16_t **output) {
+  swSonicStage *sonic = context;
+  sonicWriteShortToStream(sonic->stream, samples, numSamples);
+  return readSonic(sonic, output);
+}
+
+// Flush the Sonic stream.
+static uint32_t sonicFlush(void *context, int16_t **output) {
+  swSonicStage *sonic = context;
+  sonicFlushStream(sonic->stream);
+  return readSonic(sonic, output);
+}
+
+// Drop what is in the Sonic stream.
+static void sonicReset(void *context) {
+  int16_t *output;
+  sonicFlush(context, &output);
+}
+
+// Free the Sonic stage.
+static void sonicDestroy(void *context) {
+  swSonicStage *sonic = context;
+  sonicDestroyStream(sonic->stream);
+  swFree(sonic->buffer);
+  swFree(sonic);
+}
+
+static const swDspStage sonicStage = {"sonic", sonicProcess, sonicFlush, sonicReset,
+    sonicDestroy};
+
+// Resample to the output rate.
+static uint32_t resampleProcess(void *context, int16_t *samples, uint32_t numSamples,
+    int16_t **output) {
+  return swResample(context, samples, numSamples, output);
+}
+
+// The resampler holds back no more than one sample.
+static uint32_t resampleFlush(void *context, int16_t **output) {
+  swResamplerReset(context);
+  return 0;
+}
+
+// Forget the utterance.
+static void resampleReset(void *context) {
+  swResamplerReset(context);
+}
+
+static const swDspStage resampleStage = {"resample", resampleProcess, resampleFlush,
+    resampleReset, NULL};
+
+// Rebuild the list of enabled stages.
+static void updateStages(swDsp dsp) {
+  uint32_t numStages = 0;
+  if (dsp->trim != NULL) {
+    dsp->stages[numStages++] = (swDspSlot){trimStage, dsp->trim};
+  }
+  if (dsp->sonic != NULL) {
+    dsp->stages[numStages++] = (swDspSlot){sonicStage, dsp->sonic};
+  }
+  for (uint32_t i = 0; i < dsp->numAddedStages; i++) {
+    dsp->stages[numStages++] = dsp->addedStages[i];
+  }
+  if (dsp->resampler != NULL) {
+    dsp->stages[numStages++] = (swDspSlot){resampleStage, dsp->resampler};
+  }
+  dsp->numStages = numStages;
+}
+
+// Create a chain with nothing enabled.
+swDsp swDspCreate(uint32_t sampleRate) {
+  swDsp dsp = swCalloc(1, sizeof(struct swDspSt));
+  dsp->sampleRate = sampleRate;
+  dsp->outputRate = sampleRate;
+  dsp->gain = UNITY_GAIN;
+  dsp->speed = 1.0f;
+  dsp->pitch = 1.0f;
+  return dsp;
+}
+
+// Free the chain and its stages.
+void swDspFree(swDsp dsp) {
+  for (uint32_t i = 0; i < dsp->numAddedStages; i++) {
+    swDspSlot *slot = dsp->addedStages + i;
+    if (slot->stage.destroy != NULL) {
+      slot->stage.destroy(slot->context);
+    }
+  }
+  if (dsp->trim != NULL) {
+    trimDestroy(dsp->trim);
+  }
+  if (dsp->sonic != NULL) {
+    sonicDestroy(dsp->sonic);
+  }
+  if (dsp->resampler != NULL) {
+    swResamplerFree(dsp->resampler);
+  }
+  swFree(dsp->flushBuffer);
+  swFree(dsp);
+}
+
+// Return true if any stage is enabled.
+bool swDspActive(swDsp dsp) {
+  return dsp->numStages != 0 || dsp->repair || dsp->gain != UNITY_GAIN;
+}
+
+// Run samples through the stages from the given one on.
+static int16_t *runStages(swDsp dsp, uint32_t first, int16_t *samples,
+    uint32_t *numSamples) {
+  for (uint32_t i = first; i < dsp->numStages && *numSamples != 0; i++) {
+    swDspSlot *slot = dsp->stages + i;
+    *numSamples = slot->stage.process(slot->context, samples, *numSamples, &samples);
+  }
+  return samples;
+}
+
+// Run samples through the chain.
+int16_t *swDspProcess(swDsp dsp, int16_t *samples, uint32_t *numSamples) {
+  if (*numSamples == 0) {
+    return samples;
+  }
+  uint64_t start = swTraceNow();
+  runPointStages(dsp, samples, *numSamples);
+  samples = runStages(dsp, 0, samples, numSamples);
+  swTraceComplete("dsp", start, "samples", *numSamples);
+  return samples;
+}
+
+// Flush each stage in turn, through the stages after it.
+int16_t *swDspFlush(swDsp dsp, uint32_t *numSamples) {
+  uint32_t total = 0;
+  for (uint32_t i = 0; i < dsp->numStages; i++) {
+    swDspSlot *slot = dsp->stages + i;
+    int16_t *samples = NULL;
+    uint32_t length = slot->stage.flush(slot->context, &samples);
+    samples = runStages(dsp, i + 1, samples, &length);
+    if (length != 0) {
+      dsp->flushBuffer = growBuffer(dsp->flushBuffer, &dsp->flushBufferSize, total + length);
+      memcpy(dsp->flushBuffer + total, samples, length*sizeof(int16_t));
+      total += length;
+    }
+  }
+  dsp->prevSample = 0;
+  *numSamples = total;
+  return dsp->flushBuffer;
+}
+
+// Drop the samples of a cancelled utterance.
+void swDspReset(swDsp dsp) {
+  for (uint32_t i = 0; i < dsp->numStages; i++) {
+    swDspSlot *slot = dsp->stages + i;
+    slot->stage.reset(slot->context);
+  }
+  dsp->prevSample = 0;
+}
+
+// Return the sample rate of the output.
+uint32_t swDspGetOutputRate(swDsp dsp) {
+  return dsp->outputRate;
+}
+
+// Enable or disable overflow repair.
+void swDspSetRepair(swDsp dsp, bool enable) {
+  dsp->repair = enable;
+  dsp->prevSample = 0;
+}
+
+// Set the gain.
+void swDspSetGain(swDsp dsp, float gain) {
+  if (gain < 0.0f) {
+    gain = 0.0f;
+  } else if (gain > SW_DSP_MAX_GAIN) {
+    gain = SW_DSP_MAX_GAIN;
+  }
+  dsp->gain = (int32_t)(gain*UNITY_GAIN + 0.5f);
+}
+
+// Enable or disable silence trimming.
+void swDspSetTrim(swDsp dsp, bool enable) {
+  if (enable && dsp->trim == NULL) {
+    dsp->trim = swCalloc(1, sizeof(swTrimStage));
+  } else if (!enable && dsp->trim != NULL) {
+    trimDestroy(dsp->trim);
+    dsp->trim = NULL;
+  }
+  updateStages(dsp);
+}
+
+// Enable or disable Sonic.
+void swDspSetSonic(swDsp dsp, bool enable) {
+  if (enable && dsp->sonic == NULL) {
+    swSonicStage *sonic = swCalloc(1, sizeof(swSonicStage));
+    sonic->stream = sonicCreateStream(dsp->sampleRate, 1);
+    if (sonic->stream == NULL) {
+      fprintf(stderr, "Out of memory");
+      exit(1);
+    }
+    sonicSetSpeed(sonic->stream, dsp->speed);
+    sonicSetPitch(sonic->stream, dsp->pitch);
+    dsp->sonic = sonic;
+  } else if (!enable && dsp->sonic != NULL) {
+    sonicDestroy(dsp->sonic);
+    dsp->sonic = NULL;
+  }
+  updateStages(dsp);
+}
+
+// Set Sonic's speed factor.
+void swDspSetSpeed(swDsp dsp, float speed) {
+  dsp->speed = speed;
+  if (dsp->sonic != NULL) {
+    sonicSetSpeed(dsp->sonic->stream, speed);
+  }
+}
+
+// Set Sonic's pitch factor.
+void swDspSetPitch(swDsp dsp, float pitch) {
+  dsp->pitch = pitch;
+  if (dsp->sonic != NULL) {
+    sonicSetPitch(dsp->sonic->stream, pitch);
+  }
+}
+
+// Resample the output to this rate.
+void swDspSetOutputRate(swDsp dsp, uint32_t outputRate) {
+  if (dsp->resampler != NULL) {
+    swResamplerFree(dsp->resampler);
+    dsp->resampler = NULL;
+  }
+  dsp->outputRate = outputRate;
+  if (outputRate != dsp->sampleRate) {
+    dsp->resampler = swResamplerCreate(dsp->sampleRate, outputRate);
+  }
+  updateStages(dsp);
+}
+
+// Add a stage after Sonic.
+bool swDspAddStage(swDsp dsp, const swDspStage *stage, void *context) {
+  if (dsp->numAddedStages == SW_DSP_MAX_STAGES) {
+    return false;
+  }
+  dsp->addedStages[dsp->numAddedStages++] = (swDspSlot){*stage, context};
+  updateStages(dsp);
+  return true;
+}
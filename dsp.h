@@ -0,0 +1,71 @@
+// Audio post-processing of an engine's samples.
+//
+// Samples from the engine pass through a chain of stages before they reach the
+// callback.  Stages that work on one sample at a time, overflow repair and
+// gain, are fused into a single pass over each buffer, in place, with SIMD when
+// the CPU has it.  The other stages may change the number of samples, and run in
+// this order: silence trimming, Sonic speed and pitch, stages added with
+// swDspAddStage, and resampling to the output rate.  Each keeps its own buffers
+// between utterances, so the steady state allocates nothing, and a chain with
+// nothing enabled passes samples through untouched.
+
+#ifndef SW_DSP_H
+#define SW_DSP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Stages added with swDspAddStage, beyond the built-in ones.
+#define SW_DSP_MAX_STAGES 8
+// The largest gain swDspSetGain accepts.
+#define SW_DSP_MAX_GAIN 8.0f
+
+// A stage that may change the number of samples.  process returns the number
+// of output samples and points *output at them.  They may be written in place
+// over the input, or be in the stage's own buffer, which must stay valid until
+// its next call.  flush returns any samples held back at the end of an
+// utterance, and reset drops them after a cancel.  destroy, if not NULL, is
+// called when the chain is freed.
+typedef struct {
+  const char *name;
+  uint32_t (*process)(void *context, int16_t *samples, uint32_t numSamples,
+      int16_t **output);
+  uint32_t (*flush)(void *context, int16_t **output);
+  void (*reset)(void *context);
+  void (*destroy)(void *context);
+} swDspStage;
+
+typedef struct swDspSt *swDsp;
+
+swDsp swDspCreate(uint32_t sampleRate);
+void swDspFree(swDsp dsp);
+// Return true if any stage is enabled.
+bool swDspActive(swDsp dsp);
+// Run samples through the chain, and return the output.  The input may be
+// overwritten.  The output is valid until the next call.
+int16_t *swDspProcess(swDsp dsp, int16_t *samples, uint32_t *numSamples);
+// Return the samples held back at the end of an utterance, and get ready for
+// the next one.
+int16_t *swDspFlush(swDsp dsp, uint32_t *numSamples);
+// Drop the samples of a cancelled utterance.
+void swDspReset(swDsp dsp);
+// Return the sample rate of the output.
+uint32_t swDspGetOutputRate(swDsp dsp);
+
+// Undo int16 wrap-around in engines like ibmtts that overflow at high speed,
+// and clip instead.
+void swDspSetRepair(swDsp dsp, bool enable);
+// Scale samples by a factor, clipping at the int16 limits.
+void swDspSetGain(swDsp dsp, float gain);
+// Drop silence at the start and end of each utterance.
+void swDspSetTrim(swDsp dsp, bool enable);
+// Enable Sonic, and set its speed and pitch factors.
+void swDspSetSonic(swDsp dsp, bool enable);
+void swDspSetSpeed(swDsp dsp, float speed);
+void swDspSetPitch(swDsp dsp, float pitch);
+// Resample the output to this rate.
+void swDspSetOutputRate(swDsp dsp, uint32_t outputRate);
+// Add a stage after Sonic.  Return false if there are SW_DSP_MAX_STAGES already.
+bool swDspAddStage(swDsp dsp, const swDspStage *stage, void *context);
+
+#endif  // SW_DSP_H
@@ -8,14 +8,33 @@ To simplify supporting engines in various languages and compile formats, such as
 There are just a few simple commands.
 
 These should mostly be pretty self-explanitory, with the exception of speak.
-The expectation is that the server is single threaded, and so it will read
-characters from the socket until a newline is read, and then execute the
-command.  The speak command takes text until a line is read with just '.'.  At
-that point, it synthesizes the speech, and every so often writes a line of
-encoded samples in hex.  After writing each line, the server should check to see
-if there is a command waiting, and if so, is it 'cancel'.  If cancelled,
-synthesis should stop.  When synthesis ends, a line with "done" should be
-printed.
+The speak command takes text until a line is read with just '.'.  At that
+point, it synthesizes the speech, and every so often writes a line of encoded
+samples in hex.  After each line, the client replies "true" to continue, or
+anything else, such as "false" or "cancel", to stop synthesis.  When synthesis
+ends, a line with "true" or "false" is printed.
+
+Synthesis and pipe I/O run on different threads.  Commands are read and
+executed on the main thread, which also runs the engine, so engines never see
+more than one thread.  While it synthesizes, swProcessAudio only copies samples
+into a bounded lock-free queue.  A separate I/O thread sends them to the client
+and reads the replies, so the engine keeps working while the client is busy
+with the previous chunk, and a cancel is seen as soon as the client sends it.
+The I/O thread sends a small first chunk, SW_FIRST_CHUNK_MS milliseconds of
+audio, and doubles the chunk size up to SW_MAX_CHUNK_MS.
+
+A client can also queue utterances with "speak <id>", where the id is a
+non-zero number, so the engine starts the next one as soon as the current one
+is done.  The client does not wait: from then on a reader thread owns stdin,
+and queues more "speak <id>" and set commands while the main thread speaks.
+Queued audio is written as "audio <id> <hex>" lines, with no replies, and each
+utterance ends with "done <id> true" or "done <id> false".  "cancel <id>"
+cancels one utterance, whether it is queued or being spoken, and "cancel" or
+"cancel all" cancels all of them.  A cancelled utterance still gets its done
+line.  Queued set commands apply to the utterances after them, and their
+replies come in order with the done lines.  Any other command waits until every
+queued utterance is done, and reading goes back to the main thread until the
+next "speak <id>".
 
 */
 
@@ -27,11 +46,20 @@ printed.
 #include <stdarg.h>
 #include <sys/types.h>
 #include <dirent.h>
+#include <pthread.h>
 
 #include "engine.h"
+#include "trace.h"
+#include "utf8.h"
 
 #define MAX_LINE_LENGTH (1 << 12)
 #define MAX_TEXT_LENGTH (1 << 16)
+// The sample queue holds about 1.5 seconds of audio at 22KHz.  It must be a
+// power of 2.
+#define SAMPLE_QUEUE_SIZE (1 << 15)
+// Default chunk sizes, which SW_FIRST_CHUNK_MS and SW_MAX_CHUNK_MS override.
+#define DEFAULT_FIRST_CHUNK_MS 20
+#define DEFAULT_MAX_CHUNK_MS 200
 
 static uint8_t line[MAX_LINE_LENGTH*2];
 static uint8_t word[MAX_LINE_LENGTH*2];
@@ -42,53 +70,87 @@ static uint8_t *textBuffer;
 static int textBufferSize;
 static bool useANSI = false;
 
+// The sample queue is a ring written only by the synthesis thread and read
+// only by the I/O thread.  The head and tail count samples since the start, and
+// wrap around at 2^32, so head - tail is always the number of queued samples.
+// They are on separate cache lines so the threads do not fight over them.
+static int16_t sampleQueue[SAMPLE_QUEUE_SIZE];
+static uint32_t queueHead __attribute__((aligned(64)));
+static uint32_t queueTail __attribute__((aligned(64)));
+// Set by the main thread when an utterance starts, and cleared by the I/O
+// thread when it has sent all of it.
+static bool ioBusy __attribute__((aligned(64)));
+// Set by the main thread when the engine returns from synthesis.
+static bool synthesisDone;
+// Set by the I/O thread when the client cancels or goes away.
+static bool synthesisCancelled;
+static bool ioShutdown;
+// Samples are sent to the client in chunks that start small, so the first
+// audio comes out quickly, and double up to the maximum, so later chunks cost
+// fewer lines and acks.  The client always has at least the previous chunks
+// to play while it waits for the next one.
+static uint32_t firstChunkSamples;
+static uint32_t maxChunkSamples;
+// The size of the chunk the I/O thread is waiting for.
+static uint32_t chunkTarget;
+// Threads only take the mutex to sleep, and only when there is nothing to do.
+static pthread_t ioThread;
+static pthread_mutex_t queueMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t queueCond = PTHREAD_COND_INITIALIZER;
+static uint32_t queueWaiters;
+// The id of the queued utterance being sent, or 0 for a plain speak or char
+// command, which waits for a reply to each chunk.
+static uint32_t utteranceId;
+
+// An utterance queued with "speak <id>", or a set command read while
+// utterances are queued, which is applied in order between them.
+typedef struct swUtteranceSt *swUtterance;
+struct swUtteranceSt {
+  swUtterance next;
+  // The text to speak, or the value of the setting.
+  char *text;
+  // The setting to change, or NULL for an utterance.
+  char *setting;
+  uint32_t id;
+  bool cancelled;
+};
+
+// Utterances waiting to be spoken, in order, and the one being spoken.  The
+// reader thread adds and cancels them, and the main thread speaks them.  Both
+// hold utteranceMutex to change them.
+static swUtterance firstUtterance, lastUtterance, currentUtterance;
+static uint32_t numUtterances;
+static pthread_mutex_t utteranceMutex = PTHREAD_MUTEX_INITIALIZER;
+// Set while the reader thread owns stdin.
+static bool readerActive;
+// Set by the reader thread when it reads a command for the main thread, which
+// is left in line.
+static bool commandPending;
+// Set by the reader thread when the client goes away.
+static bool readerDone;
+static pthread_t readerThread;
+
 // Switch to ANSI rather than UTF-8.
 void swSwitchToANSI(void) {
   useANSI = true;
 }
 
-// Convert a factor that changes pitch or speed, to minRange .. maxRange.
-int swFactorToRange(float factor, float minFactor, float maxFactor, int minRange,
-    int defaultRange, int maxRange) {
-  if (factor > maxFactor) {
-    factor = maxFactor;
-  }
-  if (factor < minFactor) {
-    factor = minFactor;
-  }
-  if (factor >= 1.0f) {
-    return defaultRange + (int)((maxRange - defaultRange)*
-        ((factor - 1.0f)/(maxFactor - 1.0f)) + 0.5f);
-  }
-  return defaultRange - (int)((defaultRange - minRange)*
-      (1.0f/factor - 1.0f)/(1.0f/minFactor - 1.0f) + 0.5f);
-}
-    
 // Make sure that only valid UTF-8 characters are in the line, and that all
 // control characters are gone.
 static void validateLine(void) {
-  uint8_t *p = line;
-  uint8_t *q = line;
-  int length;
-  bool valid;
-  uint8_t *lineEnd = line + sizeof(line);
-
-  while(*p != '\0') {
-    if(useANSI) {
-      length = 1;
-      valid = *p >= ' ';
-    } else {
-      length = swFindUTF8LengthAndValidate((char*)p, lineEnd - p, &valid, NULL);
-    }
-    if(valid) {
-      while(length--) {
-        *q++ = *p++;
+  size_t length = strlen((char *)line);
+  if(useANSI) {
+    uint8_t *q = line;
+    for(size_t i = 0; i < length; i++) {
+      if(line[i] >= ' ') {
+        *q++ = line[i];
       }
-    } else {
-      p += length;
     }
+    length = q - line;
+  } else {
+    length = swCompactUTF8((char *)line, (char *)line, length);
   }
-  *q = '\0';
+  line[length] = '\0';
 }
 
 // Read a line.  If it's longer than some outragiously long ammount, truncate it. 
@@ -118,7 +180,7 @@ static bool readLine(void) {
     }
     validateLine();
   } while(*line == '\0');
-  swLog("Read %s\n", line);
+  swLogDebug("Read %s\n", line);
   return true;
 }
 
@@ -130,14 +192,14 @@ static void writeClient(char *format, ...) {
   vsnprintf(buf, MAX_TEXT_LENGTH - 1, format, ap);
   va_end(ap);
   buf[MAX_TEXT_LENGTH - 1] = '\0';
-  swLog("Wrote %s\n", buf);
+  swLogDebug("Wrote %s\n", buf);
   puts(buf);
   fflush(stdout);
 }
 
 // Write a string to the client.
 static void putClient(char *string) {
-  swLog("Wrote %s\n", string);
+  swLogDebug("Wrote %s\n", string);
   puts(string);
   fflush(stdout);
 }
@@ -149,6 +211,17 @@ static void execGetSampleRate(void) {
   writeClient("%d", sampleRate);
 }
 
+// Execute the get allocstats command.  Counts are zero unless SW_ALLOC_STATS is
+// set in the environment.
+static void execGetAllocStats(void) {
+  swAllocStats stats;
+  swGetAllocStats(&stats);
+  writeClient("%llu %llu %llu %llu %llu %.1f", (unsigned long long)stats.liveBytes,
+      (unsigned long long)stats.peakBytes, (unsigned long long)stats.allocations,
+      (unsigned long long)stats.frees, (unsigned long long)stats.bytesAllocated,
+      stats.allocationsPerSecond);
+}
+
 // Write "true" or "false" to the client based on the boolean value passed.
 static void writeBool(bool value) {
   if(value) {
@@ -207,95 +280,69 @@ static void execGetVoiceVariants(void) {
   swFreeStringList(variants, numVariants);
 }
 
-// Execute the setVoice command.
-static void execSetVoice(void) {
-  char *voiceName = (char *)linePos;
-
-  while(*voiceName == ' ') {
-    voiceName++;
+// Return the rest of the line, without leading spaces.
+static char *readRest(void) {
+  while(*linePos == ' ') {
+    linePos++;
   }
-  writeBool(*voiceName != '\0' && swSetVoice(voiceName));
-}
-
-// Execute the setVariant command.
-static void execSetVoiceVariant(void) {
-  char *variantName = readWord();
-
-  writeBool(variantName != NULL && swSetVoiceVariant(variantName));
+  return (char *)linePos;
 }
 
-// Read a floating point value from the line.
-static float readFloat(bool *passed) {
-  char *floatString = readWord();
+// Read a floating point value.
+static bool parseFloat(const char *string, float *value) {
   char *end;
-  float value;
-
-  *passed = true;
-  if(floatString == NULL) {
-    *passed = false;
-    return 0.0f;
-  }
-  value = strtod(floatString, &end);
-  if(*end != '\0') {
-    *passed = false;
-    return 0.0f;
-  }
-  return value;
+  *value = strtod(string, &end);
+  return end != string && *end == '\0';
 }
 
 // Read a boolean value, either "true" or "false".
-static bool readBool(bool *passed) {
-  char *boolString = readWord();
-
-  *passed = true;
-  if(boolString == NULL) {
-    *passed = false;
-    return false;
-  }
-  if(!strcasecmp(boolString, "true")) {
-    return true;
-  }
-  if(!strcasecmp(boolString, "false")) {
-    return false;
-  }
-  *passed = false;
-  return false;
+static bool parseBool(const char *string, bool *value) {
+  *value = !strcasecmp(string, "true");
+  return *value || !strcasecmp(string, "false");
 }
 
-// Execute the setPitch command 
-static void execSetPitch(void) {
-  bool passed;
-  float pitch = readFloat(&passed);
-
-  if(!passed) {
-    writeBool(false);
-    return;
-  }
-  writeBool(swSetPitch(pitch));
+// Apply a setting from a set command.  The value is the rest of the line, and
+// only the voice may contain spaces.  Return false if the value is invalid or the
+// engine rejects it.  Clear *known if there is no such setting.
+static bool applySetting(const char *key, char *value, bool *known) {
+  *known = true;
+  if(!strcasecmp(key, "voice")) {
+    return *value != '\0' && swSetVoice(value);
+  }
+  char *space = strchr(value, ' ');
+  if(space != NULL) {
+    *space = '\0';
+  }
+  float floatValue;
+  bool boolValue;
+  if(!strcasecmp(key, "variant")) {
+    return *value != '\0' && swSetVoiceVariant(value);
+  } else if(!strcasecmp(key, "pitch")) {
+    return parseFloat(value, &floatValue) && swSetPitch(floatValue);
+  } else if(!strcasecmp(key, "speed")) {
+    return parseFloat(value, &floatValue) && swSetSpeed(floatValue);
+  } else if(!strcasecmp(key, "ssml")) {
+    return parseBool(value, &boolValue) && swSetSSML(boolValue);
+  }
+  *known = false;
+  return false;
 }
 
-// Execute the setSpeed command 
-static void execSetSpeed(void) {
-  bool passed;
-  float speed = readFloat(&passed);
-
-  if(!passed) {
-    writeBool(false);
-    return;
+// Write the result of applying a setting.
+static void writeSettingResult(bool result, bool known) {
+  if(known) {
+    writeBool(result);
+  } else {
+    putClient("Unrecognized command");
   }
-  writeBool(swSetSpeed(speed));
 }
 
-// Execute the setSsml command 
-static void execSetSsml(void) {
-  bool passed;
-  bool value = readBool(&passed);
-
-  if(!passed) {
-    writeBool(false);
-    return;
-  }
-  writeBool(swSetSSML(value));
+// Execute a set command.
+static void execSet(void) {
+  char *key = readWord();
+  bool known = false;
+  bool result = key != NULL && applySetting(key, readRest(), &known);
+  writeSettingResult(result, known);
 }
 
 // Just read one line at a time into the textBuffer until we see a line with "."
@@ -328,24 +375,433 @@ static bool readText(void) {
   return false;
 }
 
-// Execute a speak command.  This will not return until all speech has been synthesized,
-// unless processAudio fails to read "true" from the client after sending speech
-// samples. */
+// Load a flag or counter shared between threads.
+static inline uint32_t loadShared(const uint32_t *value) {
+  return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+}
+
+// Return true if a shared flag is set.
+static inline bool sharedFlag(const bool *flag) {
+  return __atomic_load_n(flag, __ATOMIC_SEQ_CST);
+}
+
+// Wake any thread sleeping in waitFor.  Call this after changing anything a
+// waiting thread checks.  Both this and waitFor use sequentially consistent
+// atomics, so either the waiter sees the change, or we see the waiter.
+static void wakeWaiters(void) {
+  if (loadShared(&queueWaiters) != 0) {
+    pthread_mutex_lock(&queueMutex);
+    pthread_cond_broadcast(&queueCond);
+    pthread_mutex_unlock(&queueMutex);
+  }
+}
+
+// Set a shared flag and wake the other thread.
+static void setSharedFlag(bool *flag, bool value) {
+  __atomic_store_n(flag, value, __ATOMIC_SEQ_CST);
+  wakeWaiters();
+}
+
+// Sleep until ready returns true.
+static void waitFor(bool (*ready)(void)) {
+  if (ready()) {
+    return;
+  }
+  pthread_mutex_lock(&queueMutex);
+  __atomic_add_fetch(&queueWaiters, 1, __ATOMIC_SEQ_CST);
+  while (!ready()) {
+    pthread_cond_wait(&queueCond, &queueMutex);
+  }
+  __atomic_sub_fetch(&queueWaiters, 1, __ATOMIC_SEQ_CST);
+  pthread_mutex_unlock(&queueMutex);
+}
+
+// Return true if the synthesis thread can add samples to the queue.
+static bool queueHasSpace(void) {
+  return loadShared(&queueHead) - loadShared(&queueTail) < SAMPLE_QUEUE_SIZE ||
+      sharedFlag(&synthesisCancelled);
+}
+
+// Return true if the I/O thread has a full chunk to send, or synthesis is over
+// and it should send whatever is left.
+static bool queueHasChunk(void) {
+  return loadShared(&queueHead) - loadShared(&queueTail) >= chunkTarget ||
+      sharedFlag(&synthesisDone);
+}
+
+// Read a chunk size in milliseconds from the environment, and convert it to
+// samples.  Chunks are limited to half the queue, so the engine can fill the
+// next one while one is being sent.
+static uint32_t readChunkSize(const char *name, uint32_t defaultMilliseconds) {
+  uint32_t milliseconds = defaultMilliseconds;
+  const char *value = getenv(name);
+  if (value != NULL && atoi(value) > 0) {
+    milliseconds = atoi(value);
+  }
+  uint64_t samples = (uint64_t)swGetSampleRate()*milliseconds/1000;
+  if (samples < 1) {
+    return 1;
+  }
+  return samples > SAMPLE_QUEUE_SIZE/2? SAMPLE_QUEUE_SIZE/2 : samples;
+}
+
+// Return true if the I/O thread has an utterance to send, or should exit.
+static bool ioHasWork(void) {
+  return sharedFlag(&ioBusy) || sharedFlag(&ioShutdown);
+}
+
+// Return true when the I/O thread has finished with the utterance.
+static bool ioIdle(void) {
+  return !sharedFlag(&ioBusy);
+}
+
+// Send samples from the queue to the client as one line of hex, and read the
+// reply.  The samples may wrap around the end of the queue.  Return false if
+// the client cancelled.
+static bool sendSamples(uint32_t tail, uint32_t numSamples) {
+  uint64_t start = swTraceNow();
+  // Room for "audio <id> " too.
+  int length = numSamples*4 + 32;
+  if(length > speechBufferSize) {
+    speechBufferSize = length << 1;
+    speechBuffer = (uint8_t *)swRealloc(speechBuffer, speechBufferSize, sizeof(char));
+  }
+  char *hex = (char *)speechBuffer;
+  if (utteranceId != 0) {
+    hex += sprintf(hex, "audio %u ", utteranceId);
+  }
+  uint32_t pos = tail & (SAMPLE_QUEUE_SIZE - 1);
+  uint32_t firstPart = SAMPLE_QUEUE_SIZE - pos;
+  if (firstPart > numSamples) {
+    firstPart = numSamples;
+  }
+  swConvertInt16ToHex(hex, sampleQueue + pos, firstPart);
+  swConvertInt16ToHex(hex + firstPart*4, sampleQueue, numSamples - firstPart);
+  putClient((char *)speechBuffer);
+  swTraceComplete("sendChunk", start, "samples", numSamples);
+  if (utteranceId != 0) {
+    // Queued audio is not acknowledged.  The reader thread handles cancels.
+    return true;
+  }
+  start = swTraceNow();
+  if(!readLine()) {
+    swLogWarn("Unable to read from client\n");
+    return false;
+  }
+  swTraceComplete("ackWait", start, NULL, 0);
+  if(strcasecmp((char *)line, "true")) {
+    swLogInfo("Cancelled\n");
+    return false;
+  }
+  return true;
+}
+
+// Send the samples of one utterance to the client as they are synthesized.
+// After a cancel, keep emptying the queue without sending anything, until
+// the engine stops.
+static void sendUtterance(void) {
+  uint32_t tail = queueTail;
+  chunkTarget = firstChunkSamples;
+  while (true) {
+    waitFor(queueHasChunk);
+    uint32_t numSamples = loadShared(&queueHead) - tail;
+    if (numSamples == 0) {
+      // Synthesis is done, and everything has been sent.
+      return;
+    }
+    if (numSamples > maxChunkSamples) {
+      numSamples = maxChunkSamples;
+    }
+    chunkTarget = chunkTarget << 1 < maxChunkSamples? chunkTarget << 1 : maxChunkSamples;
+    if (!sharedFlag(&synthesisCancelled) && !sendSamples(tail, numSamples)) {
+      setSharedFlag(&synthesisCancelled, true);
+      // Drop whatever the engine queues until it stops.
+      chunkTarget = 1;
+    }
+    tail += numSamples;
+    __atomic_store_n(&queueTail, tail, __ATOMIC_SEQ_CST);
+    wakeWaiters();
+  }
+}
+
+// The I/O thread owns stdin and stdout while an utterance is synthesized.
+static void *runIOThread(void *arg) {
+  while (true) {
+    waitFor(ioHasWork);
+    if (sharedFlag(&ioShutdown)) {
+      break;
+    }
+    sendUtterance();
+    setSharedFlag(&ioBusy, false);
+  }
+  return NULL;
+}
+
+// Hand stdout, and stdin unless the utterance is queued, to the I/O thread for
+// an utterance.  The id is 0 if it is not queued.
+static void startUtterance(uint32_t id) {
+  utteranceId = id;
+  __atomic_store_n(&synthesisCancelled, false, __ATOMIC_SEQ_CST);
+  __atomic_store_n(&synthesisDone, false, __ATOMIC_SEQ_CST);
+  setSharedFlag(&ioBusy, true);
+}
+
+// Tell the I/O thread synthesis is over, and wait until it has sent everything
+// and stopped using stdin and stdout.
+static void finishUtterance(void) {
+  setSharedFlag(&synthesisDone, true);
+  uint64_t start = swTraceNow();
+  waitFor(ioIdle);
+  swTraceComplete("drainQueue", start, NULL, 0);
+}
+
+static void appendUtterance(swUtterance utterance);
+
+// Read the text of a "speak <id>" command, and add it to the queue.  Return
+// false if the text cannot be read.
+static bool queueUtterance(const char *idString) {
+  char *end;
+  unsigned long id = strtoul(idString, &end, 10);
+  bool validId = *end == '\0' && id != 0 && id <= UINT32_MAX;
+  if(!readText()) {
+    return false;
+  }
+  if(!validId) {
+    swLogWarn("Invalid utterance id %s\n", idString);
+    return true;
+  }
+  swUtterance utterance = swCalloc(1, sizeof(struct swUtteranceSt));
+  utterance->text = swCopyString((char *)textBuffer);
+  utterance->id = id;
+  appendUtterance(utterance);
+  return true;
+}
+
+// Queue a set command, so it applies to the utterances queued after it.
+static void queueSetting(void) {
+  char *key = readWord();
+  swUtterance utterance = swCalloc(1, sizeof(struct swUtteranceSt));
+  utterance->setting = swCopyString(key != NULL? key : "");
+  utterance->text = swCopyString(readRest());
+  appendUtterance(utterance);
+}
+
+// Add an utterance or setting to the end of the queue.
+static void appendUtterance(swUtterance utterance) {
+  pthread_mutex_lock(&utteranceMutex);
+  if(lastUtterance == NULL) {
+    firstUtterance = utterance;
+  } else {
+    lastUtterance->next = utterance;
+  }
+  lastUtterance = utterance;
+  __atomic_add_fetch(&numUtterances, 1, __ATOMIC_SEQ_CST);
+  pthread_mutex_unlock(&utteranceMutex);
+  wakeWaiters();
+}
+
+// Cancel the utterance with the given id, or every utterance if all is set.
+static void cancelUtterances(uint32_t id, bool all) {
+  pthread_mutex_lock(&utteranceMutex);
+  if(currentUtterance != NULL && (all || currentUtterance->id == id)) {
+    currentUtterance->cancelled = true;
+    setSharedFlag(&synthesisCancelled, true);
+  }
+  for(swUtterance utterance = firstUtterance; utterance != NULL; utterance = utterance->next) {
+    if(utterance->setting == NULL && (all || utterance->id == id)) {
+      utterance->cancelled = true;
+    }
+  }
+  pthread_mutex_unlock(&utteranceMutex);
+}
+
+// Execute a cancel command read while utterances are queued.
+static void execCancel(void) {
+  char *idString = readWord();
+  if(idString == NULL || !strcasecmp(idString, "all")) {
+    cancelUtterances(0, true);
+    return;
+  }
+  char *end;
+  unsigned long id = strtoul(idString, &end, 10);
+  if(*end == '\0' && id != 0 && id <= UINT32_MAX) {
+    cancelUtterances(id, false);
+  }
+}
+
+// Return true if the reader thread should read stdin, or exit.
+static bool readerHasWork(void) {
+  return sharedFlag(&readerActive) || sharedFlag(&ioShutdown);
+}
+
+// Stop reading.  Either there is a command for the main thread in line, or the
+// client has gone away.
+static void stopReader(bool *reason) {
+  __atomic_store_n(&readerActive, false, __ATOMIC_SEQ_CST);
+  setSharedFlag(reason, true);
+}
+
+// Read one command while utterances are queued.  Queued speak commands and
+// cancels are handled here, so they take effect while the main thread speaks,
+// and set commands are queued.  Any other command is left for the main thread.
+static void readQueueCommand(void) {
+  if(!readLine()) {
+    cancelUtterances(0, true);
+    stopReader(&readerDone);
+    return;
+  }
+  linePos = line;
+  char *command = readWord();
+  if(command != NULL && !strcasecmp(command, "cancel")) {
+    execCancel();
+    return;
+  }
+  if(command != NULL && !strcasecmp(command, "set")) {
+    queueSetting();
+    return;
+  }
+  if(command != NULL && !strcasecmp(command, "speak")) {
+    char *idString = readWord();
+    if(idString != NULL && !queueUtterance(idString)) {
+      cancelUtterances(0, true);
+      stopReader(&readerDone);
+    }
+    if(idString != NULL) {
+      return;
+    }
+  }
+  stopReader(&commandPending);
+}
+
+// The reader thread owns stdin while utterances are queued.
+static void *runReaderThread(void *arg) {
+  while (true) {
+    waitFor(readerHasWork);
+    if (sharedFlag(&ioShutdown)) {
+      break;
+    }
+    readQueueCommand();
+  }
+  return NULL;
+}
+
+// Return true if the main thread has an utterance to speak, a command to run,
+// or the client has gone away.
+static bool mainHasWork(void) {
+  return loadShared(&numUtterances) != 0 || sharedFlag(&commandPending) ||
+      sharedFlag(&readerDone);
+}
+
+// Take the next queued utterance, and start it unless it was cancelled.
+// Return NULL if none are queued.
+static swUtterance startQueuedUtterance(void) {
+  pthread_mutex_lock(&utteranceMutex);
+  swUtterance utterance = firstUtterance;
+  if(utterance != NULL) {
+    firstUtterance = utterance->next;
+    if(firstUtterance == NULL) {
+      lastUtterance = NULL;
+    }
+    __atomic_sub_fetch(&numUtterances, 1, __ATOMIC_SEQ_CST);
+    if(utterance->setting == NULL && !utterance->cancelled) {
+      currentUtterance = utterance;
+      startUtterance(utterance->id);
+    }
+  }
+  pthread_mutex_unlock(&utteranceMutex);
+  return utterance;
+}
+
+// Speak a queued utterance, and report when it is done.
+static void speakQueuedUtterance(swUtterance utterance) {
+  bool result = false;
+  if(utterance == currentUtterance) {
+    swTraceBegin("speakText");
+    result = swSpeakText(utterance->text);
+    swTraceEnd("speakText");
+    finishUtterance();
+  }
+  pthread_mutex_lock(&utteranceMutex);
+  currentUtterance = NULL;
+  result = result && !utterance->cancelled;
+  pthread_mutex_unlock(&utteranceMutex);
+  writeClient("done %u %s", utterance->id, result? "true" : "false");
+  swTraceFlush();
+  swFree(utterance->text);
+  swFree(utterance);
+}
+
+// Apply a queued set command, and reply just as for one that is not queued.
+static void applyQueuedSetting(swUtterance utterance) {
+  bool known;
+  bool result = applySetting(utterance->setting, utterance->text, &known);
+  writeSettingResult(result, known);
+  swFree(utterance->setting);
+  swFree(utterance->text);
+  swFree(utterance);
+}
+
+// Speak queued utterances until the queue is empty and the reader thread has
+// read a command for the main thread.  Return false if the client has gone away.
+static bool runQueue(void) {
+  while (true) {
+    waitFor(mainHasWork);
+    swUtterance utterance = startQueuedUtterance();
+    if(utterance == NULL) {
+      // The reader has stopped, so nothing more will be queued.
+      return !sharedFlag(&readerDone);
+    }
+    if(utterance->setting != NULL) {
+      applyQueuedSetting(utterance);
+    } else {
+      speakQueuedUtterance(utterance);
+    }
+  }
+}
+
+// Read the next command into line, unless the reader thread already did.
+static bool readCommand(void) {
+  if(sharedFlag(&commandPending)) {
+    __atomic_store_n(&commandPending, false, __ATOMIC_SEQ_CST);
+    return true;
+  }
+  return readLine();
+}
+
+// Execute a speak command.  This will not return until all speech has been
+// synthesized and sent, unless the client cancels.  With an id, the text is
+// queued instead, and this returns when the queue is empty and there is
+// another command to run.
 static bool execSpeak(void) {
-  swLog("entering execSpeak\n");
+  swLogDebug("entering execSpeak\n");
+  char *idString = readWord();
+  if(idString != NULL) {
+    if(!queueUtterance(idString)) {
+      return false;
+    }
+    setSharedFlag(&readerActive, true);
+    return runQueue();
+  }
+  uint64_t start = swTraceNow();
   if(!readText()) {
     return false;
   }
-  swLog("Starting speakText: %s\n", textBuffer);
-  writeBool(swSpeakText((char *)textBuffer));
+  swTraceComplete("readText", start, "bytes", strlen((char *)textBuffer));
+  swLogDebug("Starting speakText: %s\n", textBuffer);
+  startUtterance(0);
+  swTraceBegin("speakText");
+  bool result = swSpeakText((char *)textBuffer);
+  swTraceEnd("speakText");
+  finishUtterance();
+  writeBool(result);
+  swTraceFlush();
   return true;
 }
 
 // Execute a speak character command.  This will not return until the character
-// has been synthesized, unless processAudio fails to read "true" from the
-// client after sending speech samples.
+// has been synthesized and sent, unless the client cancels.
 static bool execChar(void) {
-  swLog("entering execChar\n");
+  swLogDebug("entering execChar\n");
   validateLine();  // Make sure it is valid UTF-8.
   char *charName = (char *)linePos;
   while(*charName == ' ') {
@@ -358,14 +814,20 @@ static bool execChar(void) {
   if (charName[length] != '\0') {
     return false;
   }
-  writeBool(valid && swSpeakChar(unicodeChar));
+  startUtterance(0);
+  swTraceBegin("speakChar");
+  bool result = valid && swSpeakChar(unicodeChar);
+  swTraceEnd("speakChar");
+  finishUtterance();
+  writeBool(result);
+  swTraceFlush();
   return true;
 }
 
 // Just send a simple summary of the commands.
 static void execHelp(void) {
   putClient(
-    "cancel     - Interrupt speech while being synthesized\n"
+    "cancel [<id>|all] - Interrupt speech while being synthesized\n"
     "quit/exit    - Close the connection and kill the speech server\n"
     "get samplerate - Show the sample rate in Hertz\n"
     "get voices   - List available voices\n"
@@ -379,16 +841,20 @@ static void execHelp(void) {
     "set ssml [true|false] - Enable or disable ssml support\n"
     "speak      - Enter text on separate lines, ending with \".\" on a line by\n"
     "         itself.  Synthesized samples will be generated in hexidecimal\n"
+    "speak <id>   - Queue text, and return without waiting.  Samples are written as\n"
+    "         \"audio <id> <hex>\", and \"done <id> true\" or \"false\" follows.\n"
     "char <characther> - Speak a character, encoded in UTF-8.\n"
     "get version  - Report the speech-switch protocol version, currently 1\n"
     "get sonicpitch - Return \"true\" if speech pitch should be adjusted with Sonic.\n"
-    "get sonicspeed - Return \"true\" if speech speed should be adjusted with Sonic.\n");
+    "get sonicspeed - Return \"true\" if speech speed should be adjusted with Sonic.\n"
+    "get allocstats - Live bytes, peak bytes, allocations, frees, bytes allocated,\n"
+    "         and allocations per second, if SW_ALLOC_STATS is set.\n");
 }
 
 // Execute the current command stored in 'line'.  If we read a close command, return false. 
 static bool executeCommand(void) {
   char *command, *key;
-  swLog("Executing %s\n", line);
+  swLogDebug("Executing %s\n", line);
   linePos = line;
   command = readWord();
   if(command == NULL) {
@@ -411,24 +877,13 @@ static bool executeCommand(void) {
       writeBool(swUseSonicPitch());
     } else if(!strcasecmp(key, "sonicspeed")) {
       writeBool(swUseSonicSpeed());
+    } else if(!strcasecmp(key, "allocstats")) {
+      execGetAllocStats();
     } else {
       putClient("Unrecognized command");
     }
   } else if(!strcasecmp(command, "set")) {
-    key = readWord();
-    if(!strcasecmp(key, "voice")) {
-      execSetVoice();
-    } else if(!strcasecmp(key, "variant")) {
-      execSetVoiceVariant();
-    } else if(!strcasecmp(key, "pitch")) {
-      execSetPitch();
-    } else if(!strcasecmp(key, "speed")) {
-      execSetSpeed();
-    } else if(!strcasecmp(key, "ssml")) {
-      execSetSsml();
-    } else {
-      putClient("Unrecognized command");
-    }
+    execSet();
   } else if(!strcasecmp(command, "speak")) {
     return execSpeak();
   } else if(!strcasecmp(command, "char")) {
@@ -445,73 +900,41 @@ static bool executeCommand(void) {
   return true;
 }
 
-// Convert the int16_t data to hex, in big-endian format.
-static char *convertToHex(const int16_t *data, int numSamples) {
-  int length = numSamples*4 + 1;
-  int i, j;
-  char *p, value;
-  int16_t sample;
-  if(length > speechBufferSize) {
-    speechBufferSize = length << 1;
-    speechBuffer = (uint8_t *)swRealloc(speechBuffer, speechBufferSize, sizeof(char));
-  }
-  p = (char *)speechBuffer;
-  for(i = 0; i < numSamples; i++) {
-    sample = data[i];
-    for(j = 0; j < 4; j++) {
-      value = (sample >> 12) & 0xf;
-      *p++ = value <= 9? '0' + value : 'A' + value - 10;
-      sample <<= 4;
-    }
-  }
-  *p++ = '\0';
-  return (char *)speechBuffer;
-}
-
-// Clamp an integer to an int16_t range.  For example, 0x8888 becomes 0x8000
-// (moste negative value), and 0x9999 becomes 0x7fff (most positive value).
-static inline int16_t clamp(int32_t sample) {
-  if (sample > INT16_MAX) {
-    return INT16_MAX;
-  }
-  if (sample < INT16_MIN) {
-    return INT16_MIN;
-  }
-  return sample;
-}
-
-/*
-// Some engines, like ibmtts, can overflow an int16 when speaking at very highi
-// speed.  This creates harsh pops.  Instead clamp at INT16_MAX and INT16_MIN.
-static void clampSamples(int16_t *data, uint32_t numSamples) {
-  static int32_t prevSample = 0;
-  for (uint32_t i = 0; i < numSamples; i++) {
-    int32_t sample = data[i];
-    if (sample > prevSample + 0x4000) {
-      sample -= 0x8000;
-    } else if (sample < prevSample - 0x4000) {
-      sample += 0x8000;
-    }
-    data[i] = clamp(sample);
-    prevSample = sample;
-  }
+// Return true if the client has cancelled the current utterance.
+bool swSynthesisCancelled(void) {
+  return sharedFlag(&synthesisCancelled);
 }
-*/
 
-// Send audio samples in hex to the client.  Return false if the client cancelled. 
+// Add synthesized samples to the queue for the I/O thread to send.  This only
+// blocks when the queue is full.  Return false if the client cancelled.
 bool swProcessAudio(int16_t *data, uint32_t numSamples) {
-  // clampSamples(data, numSamples);
-  char *hexBuf = convertToHex(data, numSamples);
-  putClient(hexBuf);
-  if(!readLine()) {
-    swLog("Unable to read from client\n");
-    return false;
-  }
-  if(strcasecmp((char *)line, "true")) {
-    swLog("Cancelled\n");
-    return false;
-  }
-  return true;
+  uint64_t start = swTraceNow();
+  uint32_t head = queueHead;
+  uint32_t total = numSamples;
+  while (numSamples != 0 && !sharedFlag(&synthesisCancelled)) {
+    uint32_t space = SAMPLE_QUEUE_SIZE - (head - loadShared(&queueTail));
+    if (space == 0) {
+      uint64_t waitStart = swTraceNow();
+      waitFor(queueHasSpace);
+      swTraceComplete("queueFull", waitStart, NULL, 0);
+      continue;
+    }
+    uint32_t length = numSamples < space? numSamples : space;
+    uint32_t pos = head & (SAMPLE_QUEUE_SIZE - 1);
+    uint32_t firstPart = SAMPLE_QUEUE_SIZE - pos;
+    if (firstPart > length) {
+      firstPart = length;
+    }
+    memcpy(sampleQueue + pos, data, firstPart*sizeof(int16_t));
+    memcpy(sampleQueue, data + firstPart, (length - firstPart)*sizeof(int16_t));
+    head += length;
+    data += length;
+    numSamples -= length;
+    __atomic_store_n(&queueHead, head, __ATOMIC_SEQ_CST);
+    wakeWaiters();
+  }
+  swTraceComplete("queueChunk", start, "samples", total);
+  return !sharedFlag(&synthesisCancelled);
 }
 
 // Run the speech server.  The only argument will be a directory where the
@@ -525,6 +948,8 @@ int main(int argc, char **argv) {
     return 1;
   }
   swSetLogFileName("/tmp/speechsw_engine.log");
+  char *exeName = strrchr(argv[0], '/');
+  swTraceStart(exeName != NULL? exeName + 1 : argv[0], false);
   if(!swInitializeEngine(synthDataDir)) {
     if(argc == 2) {
       printf("Unable to initialize the TTS engine with data directory %s.\n", argv[1]);
@@ -537,7 +962,20 @@ int main(int argc, char **argv) {
   speechBuffer = (uint8_t *)swCalloc(speechBufferSize, sizeof(char));
   textBufferSize = 4096;
   textBuffer = (uint8_t *)swCalloc(textBufferSize, sizeof(char));
-  while(readLine() && executeCommand());
+  firstChunkSamples = readChunkSize("SW_FIRST_CHUNK_MS", DEFAULT_FIRST_CHUNK_MS);
+  maxChunkSamples = readChunkSize("SW_MAX_CHUNK_MS", DEFAULT_MAX_CHUNK_MS);
+  if(firstChunkSamples > maxChunkSamples) {
+    firstChunkSamples = maxChunkSamples;
+  }
+  if(pthread_create(&ioThread, NULL, runIOThread, NULL) != 0 ||
+      pthread_create(&readerThread, NULL, runReaderThread, NULL) != 0) {
+    printf("Unable to start the I/O threads.\n");
+    return 1;
+  }
+  while(readCommand() && executeCommand());
+  setSharedFlag(&ioShutdown, true);
+  pthread_join(ioThread, NULL);
+  pthread_join(readerThread, NULL);
   swFree(textBuffer);
   swFree(speechBuffer);
   swCloseEngine();
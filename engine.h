@@ -33,8 +33,14 @@ bool swSpeakChar(uint32_t unicodeChar);
 // The engine needs to pass the synthesized samples back to the system to be
 // processed with this callback.  speakText should block until all samples are
 // synthesized.  Samples are in 16-bit signed notation, from -32767 to 32767.
-// Returns true to continue synthesis, false to cancel.
+// Returns true to continue synthesis, false to cancel.  Samples are queued and
+// sent to the client by another thread, so this only blocks when the queue is
+// full.
 bool swProcessAudio(int16_t *data, uint32_t numSamples);
+// Return true if the client has cancelled the current utterance.  Engines that
+// synthesize without calling swProcessAudio for a while, or that feed text in
+// pieces, should check this between pieces and stop early.
+bool swSynthesisCancelled(void);
 // Enable or disable support for SSML.  By default, SSML support be disabled.
 bool swSetSSML(bool value);
 // These two functions are only for voices that have "variants", which so far
@@ -47,6 +53,3 @@ bool swSetVoiceVariant(const char *variant);
 // this function from their initializeEngine routine to switch to ANSI.  The
 // server will expect the client to use ANSI as well.
 void swSwitchToANSI(void);
-// Convert a factor that changes pitch or speed, to minRange .. maxRange.
-int swFactorToRange(float factor, float minFactor, float maxFactor, int32_t minRange,
-    int32_t defaultRange, int maxRange);
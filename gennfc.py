@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+# Generate nfc_tables.h, the Unicode data used by nfc.c, from Python's
+# unicodedata module.  Usage: gennfc.py > nfc_tables.h
+#
+# Every code point gets a properties word holding its canonical combining
+# class, its NFC quick-check value, and where its full canonical decomposition
+# is stored.  The words are found through a two-level table like the
+# punctuation tables: the high bits of a code point select a page of 64
+# indexes into the list of distinct words, and identical pages are shared.
+# Hangul syllables are composed and decomposed arithmetically, so they are left
+# out.
+
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x110000
+PAGE_BITS = 6
+PAGE_SIZE = 1 << PAGE_BITS
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+QC_YES = 0
+QC_MAYBE = 1
+QC_NO = 2
+
+
+def isHangul(c):
+    return HANGUL_FIRST <= c <= HANGUL_LAST
+
+
+def isSurrogate(c):
+    return 0xD800 <= c <= 0xDFFF
+
+
+def main():
+    chars = [c for c in range(MAX_CODE_POINT) if not isSurrogate(c) and not isHangul(c)]
+    # Primary composites: two-character canonical decompositions that survive
+    # NFC, so they are not composition exclusions.
+    compositions = []
+    for c in chars:
+        decomp = unicodedata.decomposition(chr(c))
+        if decomp == "" or decomp.startswith("<"):
+            continue
+        parts = [int(part, 16) for part in decomp.split()]
+        if len(parts) == 2 and unicodedata.normalize("NFC", chr(c)) == chr(c):
+            compositions.append((parts[0], parts[1], c))
+    compositions.sort()
+    seconds = set(second for _, second, _ in compositions)
+    # Hangul vowels and trailing consonants compose with what comes before.
+    seconds.update(range(0x1161, 0x1176))
+    seconds.update(range(0x11A8, 0x11C3))
+    # nfc.c skips over everything below U+0300 without looking it up.
+    assert min(seconds) >= 0x300
+    assert all(unicodedata.combining(chr(c)) == 0 for c in range(0x300))
+
+    decompositions = []
+    decompOffsets = {}
+    props = [0]
+    propIndexes = {0: 0}
+    charProps = [0] * MAX_CODE_POINT
+    for c in chars:
+        ccc = unicodedata.combining(chr(c))
+        if unicodedata.normalize("NFC", chr(c)) != chr(c):
+            qc = QC_NO
+        elif c in seconds:
+            qc = QC_MAYBE
+        else:
+            qc = QC_YES
+        offset = length = 0
+        nfd = unicodedata.normalize("NFD", chr(c))
+        if nfd != chr(c):
+            key = tuple(ord(ch) for ch in nfd)
+            if key not in decompOffsets:
+                decompOffsets[key] = len(decompositions)
+                decompositions.extend(key)
+            offset = decompOffsets[key]
+            length = len(key)
+        prop = ccc | (qc << 8) | (length << 10) | (offset << 13)
+        if prop not in propIndexes:
+            propIndexes[prop] = len(props)
+            props.append(prop)
+        charProps[c] = propIndexes[prop]
+    assert max(len(key) for key in decompOffsets) < 8
+    assert len(decompositions) < (1 << 19)
+
+    pages = []
+    pageIndexes = []
+    pageNumbers = {}
+    for start in range(0, MAX_CODE_POINT, PAGE_SIZE):
+        page = tuple(charProps[start:start + PAGE_SIZE])
+        if page not in pageNumbers:
+            pageNumbers[page] = len(pages)
+            pages.append(page)
+        pageIndexes.append(pageNumbers[page])
+    assert len(pages) < 256 and len(props) < (1 << 16)
+
+    out = sys.stdout
+    out.write("// Generated by gennfc.py from Unicode %s.  Do not edit.\n\n"
+            % unicodedata.unidata_version)
+    out.write("#define SW_NFC_PAGE_BITS %d\n\n" % PAGE_BITS)
+    writeArray(out, "uint8_t", "swNfcPageIndexes", pageIndexes, 16)
+    writeArray(out, "uint16_t", "swNfcPages",
+            [index for page in pages for index in page], 16)
+    writeArray(out, "uint32_t", "swNfcProps", props, 6, "0x%x")
+    writeArray(out, "uint32_t", "swNfcDecompositions", decompositions, 8, "0x%x")
+    out.write("#define SW_NFC_NUM_COMPOSITIONS %d\n\n" % len(compositions))
+    out.write("// Sorted by the pair of characters that compose.\n")
+    out.write("static const swNfcComposition swNfcCompositions[%d] = {\n" % len(compositions))
+    for first, second, composite in compositions:
+        out.write("  {0x%x, 0x%x, 0x%x},\n" % (first, second, composite))
+    out.write("};\n")
+
+
+def writeArray(out, type, name, values, perLine, format="%d"):
+    out.write("static const %s %s[%d] = {\n" % (type, name, len(values)))
+    for start in range(0, len(values), perLine):
+        line = ", ".join(format % value for value in values[start:start + perLine])
+        out.write("  %s,\n" % line)
+    out.write("};\n\n")
+
+
+main()
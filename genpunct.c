@@ -0,0 +1,106 @@
+// Compile a punctuation source file into a table that libspeechsw maps into
+// memory.  Usage: genpunct <language>.txt <language>.swp
+//
+// Each source line is a code point, the lowest punctuation level at which its
+// name is spoken, and the name, which is the rest of the line:
+//
+//   U+0021 all exclaim
+//
+// Levels are some, most and all.  Below its level, a character is replaced by
+// a space.  Blank lines and lines starting with '#' are ignored.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "punct.h"
+#include "utf8.h"
+#include "util.h"
+
+#define MAX_SOURCE_LINE 256
+
+// Parse a punctuation level.  Return 0 if it is not one.
+static uint8_t parseLevel(const char *level) {
+  if (!strcasecmp(level, "some")) {
+    return 1;
+  } else if (!strcasecmp(level, "most")) {
+    return 2;
+  } else if (!strcasecmp(level, "all")) {
+    return 3;
+  }
+  return 0;
+}
+
+// Parse one source line into entry.  Return false if it is malformed.
+static bool parseLine(char *line, swPunctEntry *entry) {
+  char level[8];
+  int nameStart = 0;
+  if (sscanf(line, "U+%x %7s %n", &entry->unicodeChar, level, &nameStart) != 2 ||
+      nameStart == 0) {
+    return false;
+  }
+  entry->level = parseLevel(level);
+  char *name = line + nameStart;
+  char *end = name + strlen(name);
+  while (end > name && (end[-1] == ' ' || end[-1] == '\t')) {
+    end--;
+  }
+  *end = '\0';
+  char validName[MAX_SOURCE_LINE];
+  if (entry->level == 0 || *name == '\0' ||
+      swCompactUTF8(validName, name, end - name) != (size_t)(end - name)) {
+    // Invalid UTF-8 or control characters.
+    return false;
+  }
+  entry->name = swCopyString(name);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    fprintf(stderr, "Usage: genpunct <language>.txt <language>.swp\n");
+    return 1;
+  }
+  FILE *file = fopen(argv[1], "r");
+  if (file == NULL) {
+    fprintf(stderr, "Unable to read %s\n", argv[1]);
+    return 1;
+  }
+  uint32_t numEntries = 0;
+  uint32_t entriesSize = 64;
+  swPunctEntry *entries = swCalloc(entriesSize, sizeof(swPunctEntry));
+  char line[MAX_SOURCE_LINE];
+  uint32_t lineNum = 0;
+  while (fgets(line, sizeof(line), file) != NULL) {
+    lineNum++;
+    line[strcspn(line, "\r\n")] = '\0';
+    char *p = line + strspn(line, " \t");
+    if (*p == '\0' || *p == '#') {
+      continue;
+    }
+    if (numEntries == entriesSize) {
+      entriesSize <<= 1;
+      entries = swRealloc(entries, entriesSize, sizeof(swPunctEntry));
+    }
+    if (!parseLine(p, entries + numEntries)) {
+      fprintf(stderr, "%s:%u: expected U+XXXX some|most|all name\n", argv[1], lineNum);
+      return 1;
+    }
+    numEntries++;
+  }
+  fclose(file);
+  size_t size;
+  void *image = swPunctBuildImage(entries, numEntries, &size);
+  if (image == NULL) {
+    return 1;
+  }
+  file = fopen(argv[2], "wb");
+  if (file == NULL || fwrite(image, 1, size, file) != size || fclose(file) != 0) {
+    fprintf(stderr, "Unable to write %s\n", argv[2]);
+    return 1;
+  }
+  return 0;
+}
@@ -1,20 +1,59 @@
 // SpeechSwitch interface to the IBM TTS engine.
 
+// For nanosleep.
+#define _POSIX_C_SOURCE 200112L
+
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
 #include <ctype.h>
 #include <eci.h>
+#include <pthread.h>
+#include <time.h>
 #include <unistd.h>
 #include "engine.h"
 
 #define IBMTTS_BUFLEN 1024
+// Text is fed to ECI a sentence at a time, so a cancel never waits for more
+// than one sentence.  Sentences longer than this are split at a space.
+#define MAX_SENTENCE_LEN 512
+// How often to let ECI deliver audio while it synthesizes.
+#define POLL_NANOSECONDS 2000000
+// How long to wait for eciStop before giving up and restarting the engine.
+#define STOP_TIMEOUT_POLLS 100
+// The most ECI handles SW_IBMTTS_HANDLES can ask for.
+#define MAX_HANDLES 16
+
+// Each ECI handle has its own output buffer.  With more than one handle,
+// each also has a worker thread, and consecutive sentences are synthesized in
+// parallel.  Their audio is collected in samples, and sent in order.
+typedef struct {
+  ECIHand handle;
+  short buffer[IBMTTS_BUFLEN];
+  pthread_t thread;
+  char sentence[MAX_SENTENCE_LEN + 1];
+  // Set when the worker has a sentence, and cleared when it is synthesized.
+  bool busy;
+  // When true, audio goes to samples rather than straight to the client.
+  bool collect;
+  int16_t *samples;
+  uint32_t numSamples;
+  uint32_t samplesSize;
+} swEciWorker;
 
 // Globals are declared with sw prefix.
-static short swBuffer[IBMTTS_BUFLEN];
-static ECIHand swEciHandle;
+static swEciWorker swWorkers[MAX_HANDLES];
+static uint32_t swNumWorkers;
+static pthread_mutex_t swWorkerMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t swWorkerCond = PTHREAD_COND_INITIALIZER;
+static bool swWorkersStopping;
 static int swDefaultSpeed, swDefaultPitch;
-static float swCurrentSpeed = 0.0f, swCurrentPitch = 0.0f;
+static float swCurrentSpeed = 1.0f, swCurrentPitch = 1.0f;
+// Remembered so a restarted engine can be put back the way it was.
+static enum ECILanguageDialect swCurrentLanguage;
+static bool swLanguageSet;
+static int swCurrentVariant;
+// Set from the main thread, and read by workers.
 static bool swCancelled;
 
 // This structure was copied from speech-dispatcher's ibmtts.c
@@ -94,54 +133,137 @@ const char *swVariants[13] = {
 #define NUM_LANGUAGES (sizeof(swEciLocales)/sizeof(swEciLocales[0]) - 1)
 
 // Print an error message.
-static void error(void) {
+static void error(ECIHand handle) {
   char buf[200]; // Docs says it must be at least 100 long
-  eciErrorMessage(swEciHandle, buf);
+  eciErrorMessage(handle, buf);
   printf("Error: %s\n", buf);
 }
 
-// Process data from the synth engine.  Just forward it to the audio processor.
+// Return true if the utterance has been cancelled.
+static bool isCancelled(void) {
+  return __atomic_load_n(&swCancelled, __ATOMIC_ACQUIRE) || swSynthesisCancelled();
+}
+
+// Cancel the utterance.
+static void setCancelled(bool value) {
+  __atomic_store_n(&swCancelled, value, __ATOMIC_RELEASE);
+}
+
+// Append a buffer of audio to the worker's samples.
+static void collectSamples(swEciWorker *worker, uint32_t numSamples) {
+  if (worker->numSamples + numSamples > worker->samplesSize) {
+    worker->samplesSize = (worker->numSamples + numSamples) << 1;
+    worker->samples = swRealloc(worker->samples, worker->samplesSize, sizeof(int16_t));
+  }
+  memcpy(worker->samples + worker->numSamples, worker->buffer, numSamples*sizeof(int16_t));
+  worker->numSamples += numSamples;
+}
+
+// Process data from the synth engine.  Forward it to the audio processor, or
+// collect it if it is being synthesized in parallel.
 static enum ECICallbackReturn synthCallback(ECIHand eciHandle, enum ECIMessage msg,
     long lparam, void* data) {
-  if (msg == eciWaveformBuffer) {
-    if (!swCancelled && !swProcessAudio(swBuffer, lparam)) {
-      swCancelled = true; // eciStop does not seem to work when called from Windows, even on a separate thread.
-      return eciDataAbort; // The docs say this cancels synthesis, but it doesn't
+  swEciWorker *worker = data;
+  if (msg == eciWaveformBuffer && !isCancelled()) {
+    if (worker->collect) {
+      collectSamples(worker, lparam);
+    } else if (!swProcessAudio(worker->buffer, lparam)) {
+      setCancelled(true);
     }
   }
+  // Returning eciDataAbort is documented to cancel synthesis, but it doesn't,
+  // so the samples are just dropped.  synthesize stops the engine.
   return eciDataProcessed;
 }
 
-// Read the default speed and pitch parameters.
-static void setDefaultPitchAndSpeed(void) {
-  swDefaultSpeed = eciGetVoiceParam(swEciHandle, 0, eciSpeed);
-  swDefaultPitch = eciGetVoiceParam(swEciHandle, 0, eciPitchBaseline);
+// Read the default speed and pitch parameters of the selected variant.  Only
+// the main thread calls this, while no sentence is in progress: workers read the
+// defaults when they restart their engine.
+static void setDefaultPitchAndSpeed(swEciWorker *worker) {
+  swDefaultSpeed = eciGetVoiceParam(worker->handle, 0, eciSpeed);
+  swDefaultPitch = eciGetVoiceParam(worker->handle, 0, eciPitchBaseline);
+}
+
+// Create the worker's ECI handle and route its audio to synthCallback.
+static bool openEngine(swEciWorker *worker) {
+  worker->handle = eciNew();
+  if (worker->handle == NULL_ECI_HAND) {
+    return false;
+  }
+  eciRegisterCallback(worker->handle, synthCallback, worker);
+  eciSetOutputBuffer(worker->handle, IBMTTS_BUFLEN, worker->buffer);
+  return true;
+}
+
+// Read SW_IBMTTS_HANDLES, the number of ECI handles to synthesize with.  The
+// default is 1, which streams audio with the least latency.  More handles
+// render long text faster on multi-core machines.
+static uint32_t readNumHandles(void) {
+  const char *value = getenv("SW_IBMTTS_HANDLES");
+  if (value == NULL) {
+    return 1;
+  }
+  int numHandles = atoi(value);
+  if (numHandles < 1) {
+    return 1;
+  }
+  return numHandles > MAX_HANDLES? MAX_HANDLES : numHandles;
 }
 
+static void *runWorker(void *arg);
+
 // Initialize the engine.
 bool swInitializeEngine(const char *synthdataPath) {
   // ibmtts Only supports ANSI.
   swSwitchToANSI();
   swCancelled = false;
-  swEciHandle = eciNew();
-  if (swEciHandle == NULL_ECI_HAND) {
+  uint32_t numHandles = readNumHandles();
+  for (swNumWorkers = 0; swNumWorkers < numHandles; swNumWorkers++) {
+    if (!openEngine(swWorkers + swNumWorkers)) {
+      break;
+    }
+  }
+  if (swNumWorkers == 0) {
     return false;
   }
-  eciRegisterCallback(swEciHandle, synthCallback, NULL);
-  eciSetOutputBuffer(swEciHandle, IBMTTS_BUFLEN, swBuffer);
-  setDefaultPitchAndSpeed();
+  setDefaultPitchAndSpeed(swWorkers);
+  if (swNumWorkers < numHandles) {
+    swLogWarn("Only able to create %u ibmtts handles\n", swNumWorkers);
+  }
+  if (swNumWorkers > 1) {
+    for (uint32_t i = 0; i < swNumWorkers; i++) {
+      if (pthread_create(&swWorkers[i].thread, NULL, runWorker, swWorkers + i) != 0) {
+        fprintf(stderr, "Unable to start ibmtts worker threads\n");
+        exit(1);
+      }
+    }
+  }
   return true;
 }
 
 // Close the TTS Engine.
 bool swCloseEngine(void) {
-  eciDelete(swEciHandle);
+  if (swNumWorkers > 1) {
+    pthread_mutex_lock(&swWorkerMutex);
+    swWorkersStopping = true;
+    pthread_cond_broadcast(&swWorkerCond);
+    pthread_mutex_unlock(&swWorkerMutex);
+    for (uint32_t i = 0; i < swNumWorkers; i++) {
+      pthread_join(swWorkers[i].thread, NULL);
+    }
+  }
+  for (uint32_t i = 0; i < swNumWorkers; i++) {
+    eciDelete(swWorkers[i].handle);
+    if (swWorkers[i].samples != NULL) {
+      swFree(swWorkers[i].samples);
+    }
+  }
   return true;
 }
 
 // Return the sample rate.
 uint32_t swGetSampleRate(void) {
-  switch(eciGetParam(swEciHandle, eciSampleRate)) {
+  switch(eciGetParam(swWorkers[0].handle, eciSampleRate)) {
   case 0: return 8000;
   case 1: return 11025;
   case 2: return 22050;
@@ -170,7 +292,7 @@ char **swGetVoices(uint32_t *numVoices) {
   *numVoices = NUM_LANGUAGES;
   eciGetAvailableLanguages(NULL, (int *)numVoices);
   if (eciGetAvailableLanguages(language, (int *)numVoices) != 0) {
-    error();
+    error(swWorkers[0].handle);
     *numVoices = 0;
     return NULL;
   }
@@ -216,6 +338,24 @@ static eciLocale findLocaleFromName(const char *name, bool *foundIt) {
   return swEciLocales[0];
 }
 
+// Set an ECI parameter on every handle.
+static bool setParam(enum ECIParam param, int value) {
+  bool result = true;
+  for (uint32_t i = 0; i < swNumWorkers; i++) {
+    result &= eciSetParam(swWorkers[i].handle, param, value) != -1;
+  }
+  return result;
+}
+
+// Set a parameter of the active voice on every handle.
+static bool setVoiceParam(enum ECIVoiceParam param, int value) {
+  bool result = true;
+  for (uint32_t i = 0; i < swNumWorkers; i++) {
+    result &= eciSetVoiceParam(swWorkers[i].handle, 0, param, value) != -1;
+  }
+  return result;
+}
+
 // Select a voice.
 bool swSetVoice(const char *voice) {
   bool foundIt;
@@ -223,7 +363,9 @@ bool swSetVoice(const char *voice) {
   if (!foundIt) {
     return false;
   }
-  eciSetParam(swEciHandle, eciLanguageDialect, locale.langID);
+  setParam(eciLanguageDialect, locale.langID);
+  swCurrentLanguage = locale.langID;
+  swLanguageSet = true;
   return true;
 }
 
@@ -231,15 +373,16 @@ bool swSetVoice(const char *voice) {
 bool swSetSpeed(float speed) {
   // speed is between 1/6 and 6.  Integer range is 0 to 250, but speed is
   // normally limited to 150 or so.
-  swCurrentSpeed = swFactorToRange(speed, 1.0f/6.0f, 6.0f, 0, swDefaultSpeed, 170);
-  return eciSetVoiceParam(swEciHandle, 0, eciSpeed, swCurrentSpeed) != -1;
+  swCurrentSpeed = speed;
+  return setVoiceParam(eciSpeed, swFactorToRange(speed, 1.0f/6.0f, 6.0f, 0, swDefaultSpeed, 170));
 }
 
 // Set the pitch.  0 means default, -100 is min pitch, and 100 is max pitch.
 bool swSetPitch(float pitch) {
   // pitch is between 1/3 and 3.
-  swCurrentPitch = swFactorToRange(pitch, 1.0f/3.0f, 3.0f, 0, swDefaultPitch, 100);
-  return eciSetVoiceParam(swEciHandle, 0, eciPitchBaseline, swCurrentPitch) != -1;
+  swCurrentPitch = pitch;
+  return setVoiceParam(eciPitchBaseline,
+      swFactorToRange(pitch, 1.0f/3.0f, 3.0f, 0, swDefaultPitch, 100));
 }
 
 // Enable or disable SSML support.
@@ -247,12 +390,14 @@ bool swSetSSML(bool value) {
   return true; // No support for SSML
 }
 
-// Convert characters >= 0x80 to spaces.
+// Convert characters 0x80 through 0x9f to spaces.  The client sends CP1252, but
+// ibmtts reads Latin-1, where these are control characters.  Accented letters
+// are the same in both, and are kept.
 static char *cleanText(const char *text) {
   char *newText = swCopyString(text);
-  char *p = newText;
+  uint8_t *p = (uint8_t *)newText;
   while (*p != '\0') {
-    if (*p & 0x80) {
+    if (*p >= 0x80 && *p < 0xa0) {
       *p = ' ';
     }
     p++;
@@ -260,15 +405,204 @@ static char *cleanText(const char *text) {
   return newText;
 }
 
-// Speak the text.  For some reason, we have to call etiSynchronize here, making
-// it impossible to process audio output while synthesizing in small blocks, or
-// to abort.
+// Copy a preset voice to the worker's active voice.  Preset 0 is the active
+// voice itself, so the default is preset 1.
+static bool copyVariant(swEciWorker *worker, int variant) {
+  return eciCopyVoice(worker->handle, variant == 0? 1 : variant, 0);
+}
+
+// Select a preset voice, and put back the speed and pitch, which ibmtts resets
+// to the preset's defaults.
+static bool selectVariant(int variant) {
+  for (uint32_t i = 0; i < swNumWorkers; i++) {
+    if (!copyVariant(swWorkers + i, variant)) {
+      return false;
+    }
+  }
+  swCurrentVariant = variant;
+  setDefaultPitchAndSpeed(swWorkers);
+  swSetPitch(swCurrentPitch);
+  swSetSpeed(swCurrentSpeed);
+  return true;
+}
+
+// Replace the worker's ECI handle with a new one with the same settings.  This
+// is how we stop synthesis when eciStop does not work.
+static bool restartEngine(swEciWorker *worker) {
+  swLogWarn("eciStop failed: restarting ibmtts\n");
+  eciDelete(worker->handle);
+  if (!openEngine(worker)) {
+    swLogError("Unable to restart ibmtts\n");
+    return false;
+  }
+  if (swLanguageSet) {
+    eciSetParam(worker->handle, eciLanguageDialect, swCurrentLanguage);
+  }
+  if (!copyVariant(worker, swCurrentVariant)) {
+    return false;
+  }
+  ECIHand handle = worker->handle;
+  eciSetVoiceParam(handle, 0, eciSpeed,
+      swFactorToRange(swCurrentSpeed, 1.0f/6.0f, 6.0f, 0, swDefaultSpeed, 170));
+  eciSetVoiceParam(handle, 0, eciPitchBaseline,
+      swFactorToRange(swCurrentPitch, 1.0f/3.0f, 3.0f, 0, swDefaultPitch, 100));
+  return true;
+}
+
+// Stop synthesis in progress, and wait until the engine is idle.
+static void stopSynthesis(swEciWorker *worker) {
+  if (eciStop(worker->handle)) {
+    struct timespec delay = {0, POLL_NANOSECONDS};
+    for (uint32_t i = 0; i < STOP_TIMEOUT_POLLS; i++) {
+      if (!eciSpeaking(worker->handle)) {
+        return;
+      }
+      nanosleep(&delay, NULL);
+    }
+  }
+  restartEngine(worker);
+}
+
+// Synthesize text.  ECI synthesizes on its own thread, and only delivers audio
+// to synthCallback while we call eciSpeaking, so poll it until the text is
+// done, checking for a cancel between buffers.  Return false if cancelled.
+static bool synthesize(swEciWorker *worker, const char *text) {
+  struct timespec delay = {0, POLL_NANOSECONDS};
+  if (!eciAddText(worker->handle, text) || !eciSynthesize(worker->handle)) {
+    error(worker->handle);
+    return true;
+  }
+  while (eciSpeaking(worker->handle)) {
+    if (isCancelled()) {
+      stopSynthesis(worker);
+      return false;
+    }
+    nanosleep(&delay, NULL);
+  }
+  return !isCancelled();
+}
+
+// Synthesize the sentences given to this worker until the engine closes.
+static void *runWorker(void *arg) {
+  swEciWorker *worker = arg;
+  pthread_mutex_lock(&swWorkerMutex);
+  while (true) {
+    while (!worker->busy && !swWorkersStopping) {
+      pthread_cond_wait(&swWorkerCond, &swWorkerMutex);
+    }
+    if (swWorkersStopping) {
+      break;
+    }
+    pthread_mutex_unlock(&swWorkerMutex);
+    synthesize(worker, worker->sentence);
+    pthread_mutex_lock(&swWorkerMutex);
+    worker->busy = false;
+    pthread_cond_broadcast(&swWorkerCond);
+  }
+  pthread_mutex_unlock(&swWorkerMutex);
+  return NULL;
+}
+
+// Give a worker a sentence to synthesize.
+static void startSentence(swEciWorker *worker, const char *sentence, size_t length) {
+  memcpy(worker->sentence, sentence, length);
+  worker->sentence[length] = '\0';
+  worker->numSamples = 0;
+  worker->collect = true;
+  pthread_mutex_lock(&swWorkerMutex);
+  worker->busy = true;
+  pthread_cond_broadcast(&swWorkerCond);
+  pthread_mutex_unlock(&swWorkerMutex);
+}
+
+// Wait for a worker to finish its sentence.
+static void waitForSentence(swEciWorker *worker) {
+  pthread_mutex_lock(&swWorkerMutex);
+  while (worker->busy) {
+    pthread_cond_wait(&swWorkerCond, &swWorkerMutex);
+  }
+  pthread_mutex_unlock(&swWorkerMutex);
+}
+
+// Return the end of the sentence starting at text: just past the whitespace
+// after a '.', '!' or '?', or after a newline.  Long sentences end at the
+// last space before MAX_SENTENCE_LEN.
+static char *findSentenceEnd(char *text) {
+  char *lastSpace = NULL;
+  char *p = text;
+  while (*p != '\0' && p - text < MAX_SENTENCE_LEN) {
+    char c = *p++;
+    if (c == '\n' || ((c == '.' || c == '!' || c == '?') && isspace((uint8_t)*p))) {
+      while (isspace((uint8_t)*p) && p - text < MAX_SENTENCE_LEN) {
+        p++;
+      }
+      return p;
+    }
+    if (c == ' ') {
+      lastSpace = p;
+    }
+  }
+  if (*p != '\0' && lastSpace != NULL) {
+    return lastSpace;
+  }
+  return p;
+}
+
+// Speak the text a sentence at a time on one handle, so audio streams out as
+// it is synthesized, and a cancel stops synthesis within one sentence.
+static void speakStreaming(char *text) {
+  swEciWorker *worker = swWorkers;
+  worker->collect = false;
+  char *sentence = text;
+  while (*sentence != '\0') {
+    char *end = findSentenceEnd(sentence);
+    char savedChar = *end;
+    *end = '\0';
+    bool finished = synthesize(worker, sentence);
+    *end = savedChar;
+    if (!finished) {
+      break;
+    }
+    sentence = end;
+  }
+}
+
+// Speak the text with every handle working on a different sentence.  Sentences
+// are handed out round robin, so the worker with the next sentence to send is
+// always the one after the last.  After a cancel, wait for the workers to stop.
+static void speakInParallel(const char *text) {
+  const char *sentence = text;
+  uint32_t started = 0;
+  uint32_t sent = 0;
+  while (true) {
+    while (started - sent < swNumWorkers && *sentence != '\0' && !isCancelled()) {
+      const char *end = findSentenceEnd((char *)sentence);
+      startSentence(swWorkers + started % swNumWorkers, sentence, end - sentence);
+      sentence = end;
+      started++;
+    }
+    if (sent == started) {
+      return;
+    }
+    swEciWorker *worker = swWorkers + sent % swNumWorkers;
+    waitForSentence(worker);
+    if (worker->numSamples != 0 && !isCancelled() &&
+        !swProcessAudio(worker->samples, worker->numSamples)) {
+      setCancelled(true);
+    }
+    sent++;
+  }
+}
+
+// Speak the text.
 bool swSpeakText(const char *text) {
   char *newText = cleanText(text);
-  swCancelled = false;
-  eciAddText(swEciHandle, newText);
-  eciSynthesize(swEciHandle);
-  eciSynchronize(swEciHandle);
+  setCancelled(false);
+  if (swNumWorkers > 1) {
+    speakInParallel(newText);
+  } else {
+    speakStreaming(newText);
+  }
   swFree(newText);
   return true;
 }
@@ -281,12 +615,12 @@ bool swSpeakChar(uint32_t unicodeChar) {
     return false;
   }
   char charText[] = {(char)ansiChar, '\0'};
-  eciSetParam(swEciHandle, eciTextMode, eciTextModeAllSpell);
-  swCancelled = false;
-  eciAddText(swEciHandle, charText);
-  eciSynthesize(swEciHandle);
-  eciSynchronize(swEciHandle);
-  eciSetParam(swEciHandle, eciTextMode, eciTextModeDefault);
+  swEciWorker *worker = swWorkers;
+  eciSetParam(worker->handle, eciTextMode, eciTextModeAllSpell);
+  setCancelled(false);
+  worker->collect = false;
+  synthesize(worker, charText);
+  eciSetParam(worker->handle, eciTextMode, eciTextModeDefault);
   return true;
 }
 
@@ -300,21 +634,9 @@ char **swGetVoiceVariants(uint32_t *numVariants) {
 // Select a voice variant.
 bool swSetVoiceVariant(const char *variant) {
   int i;
-  bool result;
   for (i = 0; i < ECI_PRESET_VOICES + 1; i++) {
     if (!strcasecmp(variant, swVariants[i])) {
-      if (i == 0) {
-        result = eciCopyVoice(swEciHandle, 1, 0); // Set default voice, which is 1
-      } else {
-        result = eciCopyVoice(swEciHandle, i, 0);
-      }
-      if (result) {
-        // Ibmtts resets speed and pitch to default when setting a voice variant.
-        setDefaultPitchAndSpeed();
-        swSetPitch(swCurrentPitch);
-        swSetSpeed(swCurrentSpeed);
-      }
-      return result;
+      return selectVariant(i);
     }
   }
   return false;
@@ -0,0 +1,457 @@
+// User pronunciation lexicons, compiled into an Aho-Corasick automaton.  See
+// lexicon.h for the file format.
+//
+// The automaton runs over the text with ASCII folded to lower case.  The root,
+// where it spends most of its time, has a full transition table.  Other states
+// keep their transitions as a sorted edge list and fall back along failure
+// links.  Each state with a key ending in it lists the patterns for that key:
+// exact-case ones, checked against the original text, and at most one that
+// matches in any case.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lexicon.h"
+#include "utf8.h"
+#include "util.h"
+
+#define MAX_LINE_LENGTH 1024
+#define NO_PATTERN UINT32_MAX
+
+typedef struct {
+  uint32_t keyOffset;
+  uint32_t replacementOffset;
+  uint32_t replacementLength;
+  uint32_t next;  // The next pattern with the same folded key, or NO_PATTERN.
+  bool exactCase;
+} swLexPattern;
+
+typedef struct {
+  uint32_t firstEdge;
+  uint32_t numEdges;
+  uint32_t fail;
+  // The nearest state along the failure links with patterns, or 0 for none.
+  uint32_t dictLink;
+  uint32_t firstPattern;  // NO_PATTERN if no key ends here.
+  uint32_t depth;
+} swLexState;
+
+// An edge is the target state shifted left 8, ORed with the input byte.
+struct swLexiconSt {
+  uint32_t rootTransitions[256];
+  swLexState *states;
+  uint32_t numStates;
+  uint32_t *edges;
+  swLexPattern *patterns;
+  uint32_t numPatterns;
+  uint32_t numKeys;
+  char *strings;
+};
+
+// A match found while scanning.
+typedef struct {
+  size_t start;
+  uint32_t length;
+  uint32_t pattern;
+} swLexMatch;
+
+// The trie built before it is laid out as an automaton.
+typedef struct {
+  uint32_t *firstChild;
+  uint32_t *nextSibling;
+  uint8_t *bytes;
+  uint32_t *firstPattern;
+  uint32_t numNodes;
+  uint32_t size;
+} swLexTrie;
+
+static const uint8_t swLowerCase[256] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+  0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+  0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+  0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+  0x40, 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o',
+  'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+  0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+  0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+  0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+  0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+  0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+  0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+  0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+  0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+  0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+  0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+
+// Return true if the byte is part of a word.  Bytes of multi-byte UTF-8
+// characters are, so accented letters do not split words.
+static inline bool isWordByte(uint8_t c) {
+  uint8_t lower = c | 0x20;
+  return (lower >= 'a' && lower <= 'z') || (c >= '0' && c <= '9') || c >= 0x80;
+}
+
+// Add a node to the trie, and return its index.
+static uint32_t addTrieNode(swLexTrie *trie, uint8_t byte) {
+  if (trie->numNodes == trie->size) {
+    trie->size <<= 1;
+    trie->firstChild = swRealloc(trie->firstChild, trie->size, sizeof(uint32_t));
+    trie->nextSibling = swRealloc(trie->nextSibling, trie->size, sizeof(uint32_t));
+    trie->bytes = swRealloc(trie->bytes, trie->size, sizeof(uint8_t));
+    trie->firstPattern = swRealloc(trie->firstPattern, trie->size, sizeof(uint32_t));
+  }
+  uint32_t node = trie->numNodes++;
+  trie->firstChild[node] = 0;
+  trie->nextSibling[node] = 0;
+  trie->bytes[node] = byte;
+  trie->firstPattern[node] = NO_PATTERN;
+  return node;
+}
+
+// Return the child of node for byte, or 0 if it has none.
+static uint32_t findTrieChild(swLexTrie *trie, uint32_t node, uint8_t byte) {
+  for (uint32_t child = trie->firstChild[node]; child != 0; child = trie->nextSibling[child]) {
+    if (trie->bytes[child] == byte) {
+      return child;
+    }
+  }
+  return 0;
+}
+
+// Add the folded key to the trie and return the node it ends at.
+static uint32_t insertKey(swLexTrie *trie, const char *key) {
+  uint32_t node = 0;
+  for (const char *p = key; *p != '\0'; p++) {
+    uint8_t byte = swLowerCase[(uint8_t)*p];
+    uint32_t child = findTrieChild(trie, node, byte);
+    if (child == 0) {
+      child = addTrieNode(trie, byte);
+      trie->nextSibling[child] = trie->firstChild[node];
+      trie->firstChild[node] = child;
+    }
+    node = child;
+  }
+  return node;
+}
+
+// Return true if the key has an ASCII capital letter.
+static bool hasCapital(const char *key) {
+  for (const char *p = key; *p != '\0'; p++) {
+    if (*p >= 'A' && *p <= 'Z') {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Add a pattern to the node's list, replacing one with the same key.
+static void addPattern(swLexicon lexicon, swLexTrie *trie, uint32_t node, uint32_t pattern,
+    const char *strings) {
+  swLexPattern *patterns = lexicon->patterns;
+  const char *key = strings + patterns[pattern].keyOffset;
+  uint32_t *link = trie->firstPattern + node;
+  while (*link != NO_PATTERN) {
+    swLexPattern *other = patterns + *link;
+    if (other->exactCase == patterns[pattern].exactCase &&
+        (!other->exactCase || !strcmp(strings + other->keyOffset, key))) {
+      // Replace it.
+      patterns[pattern].next = other->next;
+      *link = pattern;
+      return;
+    }
+    link = &other->next;
+  }
+  lexicon->numKeys++;
+  patterns[pattern].next = NO_PATTERN;
+  if (patterns[pattern].exactCase) {
+    // Exact-case patterns come first, so they win over the one for any case.
+    patterns[pattern].next = trie->firstPattern[node];
+    trie->firstPattern[node] = pattern;
+  } else {
+    *link = pattern;
+  }
+}
+
+// Compare edges by input byte.
+static int compareEdges(const void *a, const void *b) {
+  return (int)(*(const uint32_t *)a & 0xff) - (int)(*(const uint32_t *)b & 0xff);
+}
+
+// Return the state reached from state on byte, following failure links.
+static inline uint32_t nextState(swLexicon lexicon, uint32_t state, uint8_t byte) {
+  while (state != 0) {
+    const swLexState *s = lexicon->states + state;
+    const uint32_t *edges = lexicon->edges + s->firstEdge;
+    for (uint32_t i = 0; i < s->numEdges; i++) {
+      uint8_t edgeByte = edges[i] & 0xff;
+      if (edgeByte == byte) {
+        return edges[i] >> 8;
+      }
+      if (edgeByte > byte) {
+        break;
+      }
+    }
+    state = s->fail;
+  }
+  return lexicon->rootTransitions[byte];
+}
+
+// Lay the trie out breadth first as the automaton's states, and compute the
+// failure and dictionary links.
+static void buildAutomaton(swLexicon lexicon, swLexTrie *trie) {
+  uint32_t numNodes = trie->numNodes;
+  uint32_t *order = swCalloc(numNodes, sizeof(uint32_t));
+  uint32_t *stateOfNode = swCalloc(numNodes, sizeof(uint32_t));
+  lexicon->states = swCalloc(numNodes, sizeof(swLexState));
+  lexicon->edges = swCalloc(numNodes, sizeof(uint32_t));
+  lexicon->numStates = numNodes;
+  uint32_t numOrdered = 1;
+  uint32_t numEdges = 0;
+  for (uint32_t i = 0; i < numOrdered; i++) {
+    uint32_t node = order[i];
+    swLexState *state = lexicon->states + i;
+    state->firstPattern = trie->firstPattern[node];
+    state->firstEdge = numEdges;
+    for (uint32_t child = trie->firstChild[node]; child != 0; child = trie->nextSibling[child]) {
+      stateOfNode[child] = numOrdered;
+      lexicon->states[numOrdered].depth = state->depth + 1;
+      order[numOrdered++] = child;
+      lexicon->edges[numEdges++] = (stateOfNode[child] << 8) | trie->bytes[child];
+    }
+    state->numEdges = numEdges - state->firstEdge;
+    qsort(lexicon->edges + state->firstEdge, state->numEdges, sizeof(uint32_t), compareEdges);
+  }
+  const swLexState *root = lexicon->states;
+  for (uint32_t i = 0; i < root->numEdges; i++) {
+    uint32_t edge = lexicon->edges[root->firstEdge + i];
+    lexicon->rootTransitions[edge & 0xff] = edge >> 8;
+  }
+  // Breadth-first order means a state's failure target is always done first.
+  for (uint32_t i = 0; i < numNodes; i++) {
+    swLexState *state = lexicon->states + i;
+    for (uint32_t j = 0; j < state->numEdges; j++) {
+      uint32_t edge = lexicon->edges[state->firstEdge + j];
+      swLexState *child = lexicon->states + (edge >> 8);
+      child->fail = i == 0? 0 : nextState(lexicon, state->fail, edge & 0xff);
+      const swLexState *fail = lexicon->states + child->fail;
+      child->dictLink = fail->firstPattern != NO_PATTERN? child->fail : fail->dictLink;
+    }
+  }
+  swFree(order);
+  swFree(stateOfNode);
+}
+
+// Compile entries into a lexicon.  Later entries replace earlier ones with the
+// same key.  Return NULL and print an error if a key is empty or too long.
+swLexicon swLexiconBuild(const swLexiconEntry *entries, uint32_t numEntries) {
+  size_t stringsSize = 0;
+  for (uint32_t i = 0; i < numEntries; i++) {
+    size_t keyLen = strlen(entries[i].key);
+    if (keyLen == 0 || keyLen > SW_LEXICON_MAX_KEY_LEN) {
+      fprintf(stderr, "Invalid lexicon key \"%s\"\n", entries[i].key);
+      return NULL;
+    }
+    stringsSize += keyLen + strlen(entries[i].replacement) + 2;
+  }
+  swLexicon lexicon = swCalloc(1, sizeof(struct swLexiconSt));
+  lexicon->strings = swCalloc(stringsSize + 1, sizeof(char));
+  lexicon->patterns = swCalloc(numEntries + 1, sizeof(swLexPattern));
+  lexicon->numPatterns = numEntries;
+  swLexTrie trie = {0};
+  trie.size = 64;
+  trie.firstChild = swCalloc(trie.size, sizeof(uint32_t));
+  trie.nextSibling = swCalloc(trie.size, sizeof(uint32_t));
+  trie.bytes = swCalloc(trie.size, sizeof(uint8_t));
+  trie.firstPattern = swCalloc(trie.size, sizeof(uint32_t));
+  addTrieNode(&trie, 0);
+  size_t pos = 0;
+  for (uint32_t i = 0; i < numEntries; i++) {
+    swLexPattern *pattern = lexicon->patterns + i;
+    pattern->keyOffset = pos;
+    strcpy(lexicon->strings + pos, entries[i].key);
+    pos += strlen(entries[i].key) + 1;
+    pattern->replacementOffset = pos;
+    pattern->replacementLength = strlen(entries[i].replacement);
+    strcpy(lexicon->strings + pos, entries[i].replacement);
+    pos += pattern->replacementLength + 1;
+    pattern->exactCase = hasCapital(entries[i].key);
+    addPattern(lexicon, &trie, insertKey(&trie, entries[i].key), i, lexicon->strings);
+  }
+  buildAutomaton(lexicon, &trie);
+  swFree(trie.firstChild);
+  swFree(trie.nextSibling);
+  swFree(trie.bytes);
+  swFree(trie.firstPattern);
+  return lexicon;
+}
+
+// Read and compile a lexicon file.  Return NULL if it cannot be read, or has
+// an invalid line.
+swLexicon swLexiconLoad(const char *fileName) {
+  FILE *file = fopen(fileName, "r");
+  if (file == NULL) {
+    return NULL;
+  }
+  uint32_t numEntries = 0;
+  uint32_t entriesSize = 64;
+  swLexiconEntry *entries = swCalloc(entriesSize, sizeof(swLexiconEntry));
+  char line[MAX_LINE_LENGTH];
+  char valid[MAX_LINE_LENGTH];
+  uint32_t lineNum = 0;
+  bool ok = true;
+  while (ok && fgets(line, sizeof(line), file) != NULL) {
+    lineNum++;
+    line[strcspn(line, "\r\n")] = '\0';
+    if (*line == '\0' || *line == '#') {
+      continue;
+    }
+    char *tab = strchr(line, '\t');
+    size_t length = strlen(line);
+    if (tab == NULL || tab == line) {
+      swLogWarn("%s:%u: expected a key, a tab, and a replacement\n", fileName, lineNum);
+      ok = false;
+    } else if (swCompactUTF8(valid, tab + 1, line + length - tab - 1) !=
+        (size_t)(line + length - tab - 1) ||
+        swCompactUTF8(valid, line, tab - line) != (size_t)(tab - line)) {
+      swLogWarn("%s:%u: invalid UTF-8 or control character\n", fileName, lineNum);
+      ok = false;
+    } else {
+      *tab = '\0';
+      if (numEntries == entriesSize) {
+        entriesSize <<= 1;
+        entries = swRealloc(entries, entriesSize, sizeof(swLexiconEntry));
+      }
+      entries[numEntries].key = swCopyString(line);
+      entries[numEntries].replacement = swCopyString(tab + 1);
+      numEntries++;
+    }
+  }
+  fclose(file);
+  swLexicon lexicon = ok? swLexiconBuild(entries, numEntries) : NULL;
+  for (uint32_t i = 0; i < numEntries; i++) {
+    swFree((char *)entries[i].key);
+    swFree((char *)entries[i].replacement);
+  }
+  swFree(entries);
+  return lexicon;
+}
+
+// Free the lexicon.
+void swLexiconFree(swLexicon lexicon) {
+  swFree(lexicon->states);
+  swFree(lexicon->edges);
+  swFree(lexicon->patterns);
+  swFree(lexicon->strings);
+  swFree(lexicon);
+}
+
+// Return the number of distinct keys.
+uint32_t swLexiconSize(swLexicon lexicon) {
+  return lexicon->numKeys;
+}
+
+// Return the pattern that matches the text ending at end, or NO_PATTERN if the
+// match is not on word boundaries or no exact-case key matches.
+static uint32_t checkMatch(swLexicon lexicon, const swLexState *state, const char *text,
+    size_t length, size_t end) {
+  size_t start = end - state->depth;
+  const uint8_t *p = (const uint8_t *)text;
+  if ((start != 0 && isWordByte(p[start - 1]) && isWordByte(p[start])) ||
+      (end != length && isWordByte(p[end]) && isWordByte(p[end - 1]))) {
+    return NO_PATTERN;
+  }
+  for (uint32_t i = state->firstPattern; i != NO_PATTERN; i = lexicon->patterns[i].next) {
+    const swLexPattern *pattern = lexicon->patterns + i;
+    if (!pattern->exactCase ||
+        !memcmp(text + start, lexicon->strings + pattern->keyOffset, state->depth)) {
+      return i;
+    }
+  }
+  return NO_PATTERN;
+}
+
+// Compare matches by start, and then longest first.
+static int compareMatches(const void *a, const void *b) {
+  const swLexMatch *matchA = a;
+  const swLexMatch *matchB = b;
+  if (matchA->start != matchB->start) {
+    return matchA->start < matchB->start? -1 : 1;
+  }
+  return (int)matchB->length - (int)matchA->length;
+}
+
+// Replace every match in length bytes of text.  Return text if nothing
+// matched, and otherwise a zero-terminated copy allocated in arena.  Set
+// *newLength to the length of the result.
+const char *swLexiconApply(swLexicon lexicon, swArena arena, const char *text,
+    size_t length, size_t *newLength) {
+  swLexMatch *matches = NULL;
+  size_t numMatches = 0;
+  size_t matchesSize = 0;
+  uint32_t state = 0;
+  for (size_t i = 0; i < length; i++) {
+    state = nextState(lexicon, state, swLowerCase[(uint8_t)text[i]]);
+    const swLexState *s = lexicon->states + state;
+    if (s->firstPattern == NO_PATTERN) {
+      if (s->dictLink == 0) {
+        continue;
+      }
+      s = lexicon->states + s->dictLink;
+    }
+    while (true) {
+      uint32_t pattern = checkMatch(lexicon, s, text, length, i + 1);
+      if (pattern != NO_PATTERN) {
+        if (numMatches == matchesSize) {
+          size_t newSize = matchesSize == 0? 16 : matchesSize << 1;
+          matches = swArenaGrow(arena, matches, matchesSize*sizeof(swLexMatch),
+              newSize*sizeof(swLexMatch));
+          matchesSize = newSize;
+        }
+        swLexMatch *match = matches + numMatches++;
+        match->start = i + 1 - s->depth;
+        match->length = s->depth;
+        match->pattern = pattern;
+      }
+      if (s->dictLink == 0) {
+        break;
+      }
+      s = lexicon->states + s->dictLink;
+    }
+  }
+  if (numMatches == 0) {
+    *newLength = length;
+    return text;
+  }
+  // Keep the leftmost, longest matches that do not overlap.
+  qsort(matches, numMatches, sizeof(swLexMatch), compareMatches);
+  size_t numKept = 0;
+  size_t resultLen = length;
+  size_t pos = 0;
+  for (size_t i = 0; i < numMatches; i++) {
+    if (matches[i].start >= pos) {
+      matches[numKept] = matches[i];
+      pos = matches[i].start + matches[i].length;
+      resultLen += lexicon->patterns[matches[i].pattern].replacementLength;
+      resultLen -= matches[i].length;
+      numKept++;
+    }
+  }
+  char *result = swArenaAlloc(arena, resultLen + 1);
+  char *out = result;
+  pos = 0;
+  for (size_t i = 0; i < numKept; i++) {
+    const swLexPattern *pattern = lexicon->patterns + matches[i].pattern;
+    memcpy(out, text + pos, matches[i].start - pos);
+    out += matches[i].start - pos;
+    memcpy(out, lexicon->strings + pattern->replacementOffset, pattern->replacementLength);
+    out += pattern->replacementLength;
+    pos = matches[i].start + matches[i].length;
+  }
+  memcpy(out, text + pos, length - pos);
+  out[length - pos] = '\0';
+  *newLength = resultLen;
+  return result;
+}
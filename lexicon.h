@@ -0,0 +1,47 @@
+// User pronunciation lexicons.
+//
+// A lexicon replaces words and phrases, like product names and acronyms, with
+// text that the engine pronounces correctly.  All the keys are compiled into
+// one Aho-Corasick automaton, so applying thousands of entries is a single pass
+// over the text.
+//
+// A lexicon file is UTF-8, with one entry per line: the key, a tab, and the
+// replacement.  Blank lines and lines starting with '#' are ignored.  Keys
+// written in lower case match in any case, and keys with capitals match only
+// exactly, so "US" can be spelled out without changing "us".  Keys only match
+// whole words, and where several keys match, the leftmost and then the longest
+// wins.
+
+#ifndef SW_LEXICON_H
+#define SW_LEXICON_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+
+#define SW_LEXICON_MAX_KEY_LEN 255
+
+typedef struct swLexiconSt *swLexicon;
+
+typedef struct {
+  const char *key;
+  const char *replacement;
+} swLexiconEntry;
+
+// Compile entries into a lexicon.  Later entries replace earlier ones with the
+// same key.  Return NULL and print an error if a key is empty or too long.
+swLexicon swLexiconBuild(const swLexiconEntry *entries, uint32_t numEntries);
+// Read and compile a lexicon file.  Return NULL if it cannot be read, or has
+// an invalid line.
+swLexicon swLexiconLoad(const char *fileName);
+void swLexiconFree(swLexicon lexicon);
+// Return the number of distinct keys.
+uint32_t swLexiconSize(swLexicon lexicon);
+// Replace every match in length bytes of text.  Return text if nothing
+// matched, and otherwise a zero-terminated copy allocated in arena.  Set
+// *newLength to the length of the result.
+const char *swLexiconApply(swLexicon lexicon, swArena arena, const char *text,
+    size_t length, size_t *newLength);
+
+#endif  // SW_LEXICON_H
@@ -0,0 +1,324 @@
+// Unicode NFC normalization.  The tables in nfc_tables.h are generated by
+// gennfc.py.  Text is normalized a segment at a time: a starter and the
+// combining marks after it are decomposed, put in canonical order, and
+// composed again.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "nfc.h"
+#include "util.h"
+
+typedef struct {
+  uint32_t first;
+  uint32_t second;
+  uint32_t composite;
+} swNfcComposition;
+
+#include "nfc_tables.h"
+
+// Quick-check values.
+#define QC_YES 0
+#define QC_MAYBE 1
+
+// Hangul syllables are composed from leading consonants, vowels and optional
+// trailing consonants arithmetically.
+#define HANGUL_S_BASE 0xac00
+#define HANGUL_L_BASE 0x1100
+#define HANGUL_V_BASE 0x1161
+#define HANGUL_T_BASE 0x11a7
+#define HANGUL_L_COUNT 19
+#define HANGUL_V_COUNT 21
+#define HANGUL_T_COUNT 28
+#define HANGUL_N_COUNT (HANGUL_V_COUNT*HANGUL_T_COUNT)
+#define HANGUL_S_COUNT (HANGUL_L_COUNT*HANGUL_N_COUNT)
+
+// Real text never has this many combining marks on one letter.  Longer runs
+// are normalized in pieces.
+#define MAX_SEGMENT 64
+
+typedef struct {
+  swArena arena;
+  char *out;
+  size_t outLen;
+  size_t outSize;
+  uint32_t chars[MAX_SEGMENT];
+  uint32_t numChars;
+} swNfcWriter;
+
+// Return the properties word of a character.
+static inline uint32_t getProps(uint32_t unicodeChar) {
+  uint32_t page = swNfcPageIndexes[unicodeChar >> SW_NFC_PAGE_BITS];
+  return swNfcProps[swNfcPages[(page << SW_NFC_PAGE_BITS) |
+      (unicodeChar & ((1 << SW_NFC_PAGE_BITS) - 1))]];
+}
+
+// Return the canonical combining class from a properties word.
+static inline uint8_t combiningClass(uint32_t props) {
+  return props & 0xff;
+}
+
+// Return the NFC quick-check value from a properties word.
+static inline uint8_t quickCheck(uint32_t props) {
+  return (props >> 8) & 3;
+}
+
+// Return the offset of the first character at or after pos that is U+0300 or
+// above.  Everything below is in NFC and has combining class 0, so it is never
+// looked up.  Those characters all start with a byte below 0xcc.
+static inline size_t skipLowChars(const char *text, size_t pos, size_t length) {
+#ifdef __SSE2__
+  // Flipping the sign bit lets a signed compare find bytes >= 0xcc.
+  __m128i sign = _mm_set1_epi8((char)0x80);
+  __m128i limit = _mm_set1_epi8(0xcb ^ 0x80);
+  while (length - pos >= 16) {
+    __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(text + pos)), sign);
+    uint32_t mask = _mm_movemask_epi8(_mm_cmpgt_epi8(v, limit));
+    if (mask != 0) {
+      return pos + __builtin_ctz(mask);
+    }
+    pos += 16;
+  }
+#endif
+  while (pos < length && (uint8_t)text[pos] < 0xcc) {
+    pos++;
+  }
+  return pos;
+}
+
+// Return the start of the last character before end, which is after start.
+static inline size_t lastCharStart(const char *text, size_t start, size_t end) {
+  size_t pos = end - 1;
+  while (pos > start && ((uint8_t)text[pos] & 0xc0) == 0x80) {
+    pos--;
+  }
+  return pos;
+}
+
+// Return the length of the prefix of UTF-8 text that is known to be in NFC,
+// which is length when all of it is.  The prefix ends on a character boundary
+// that normalization never moves.
+size_t swNFCQuickCheck(const char *text, size_t length) {
+  // The start of the last starter that never composes with what comes before.
+  size_t safe = 0;
+  uint8_t lastClass = 0;
+  size_t pos = 0;
+  while (pos < length) {
+    size_t next = skipLowChars(text, pos, length);
+    if (next != pos) {
+      safe = lastCharStart(text, pos, next);
+      lastClass = 0;
+      pos = next;
+      if (pos == length) {
+        break;
+      }
+    }
+    bool valid;
+    uint32_t unicodeChar;
+    size_t len = swFindUTF8LengthAndValidate(text + pos, length - pos, &valid, &unicodeChar);
+    if (valid) {
+      uint32_t props = getProps(unicodeChar);
+      uint8_t charClass = combiningClass(props);
+      if (quickCheck(props) != QC_YES || (charClass != 0 && lastClass > charClass)) {
+        return safe;
+      }
+      if (charClass == 0) {
+        safe = pos;
+      }
+      lastClass = charClass;
+    }
+    pos += len;
+  }
+  return length;
+}
+
+// Make room for size more bytes of output.
+static void reserveOutput(swNfcWriter *writer, size_t size) {
+  if (writer->outLen + size > writer->outSize) {
+    size_t newSize = (writer->outLen + size) << 1;
+    writer->out = swArenaGrow(writer->arena, writer->out, writer->outSize, newSize);
+    writer->outSize = newSize;
+  }
+}
+
+// Copy bytes to the output unchanged.
+static void writeBytes(swNfcWriter *writer, const char *text, size_t length) {
+  reserveOutput(writer, length);
+  memcpy(writer->out + writer->outLen, text, length);
+  writer->outLen += length;
+}
+
+// Return the primary composite of two characters, or 0 if they do not compose.
+static uint32_t composePair(uint32_t first, uint32_t second) {
+  if (first - HANGUL_L_BASE < HANGUL_L_COUNT && second - HANGUL_V_BASE < HANGUL_V_COUNT) {
+    return HANGUL_S_BASE + ((first - HANGUL_L_BASE)*HANGUL_V_COUNT +
+        second - HANGUL_V_BASE)*HANGUL_T_COUNT;
+  }
+  if (first - HANGUL_S_BASE < HANGUL_S_COUNT && (first - HANGUL_S_BASE) % HANGUL_T_COUNT == 0 &&
+      second - HANGUL_T_BASE - 1 < HANGUL_T_COUNT - 1) {
+    return first + second - HANGUL_T_BASE;
+  }
+  uint32_t low = 0;
+  uint32_t high = SW_NFC_NUM_COMPOSITIONS;
+  while (low < high) {
+    uint32_t mid = (low + high) >> 1;
+    const swNfcComposition *composition = swNfcCompositions + mid;
+    if (composition->first < first ||
+        (composition->first == first && composition->second < second)) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low < SW_NFC_NUM_COMPOSITIONS && swNfcCompositions[low].first == first &&
+      swNfcCompositions[low].second == second) {
+    return swNfcCompositions[low].composite;
+  }
+  return 0;
+}
+
+// Sort each run of combining marks in the segment by combining class.  The
+// sort is stable, as the standard requires, and starters are never moved.
+static void reorderSegment(swNfcWriter *writer) {
+  uint32_t *chars = writer->chars;
+  for (uint32_t i = 1; i < writer->numChars; i++) {
+    uint32_t c = chars[i];
+    uint8_t charClass = combiningClass(getProps(c));
+    if (charClass == 0) {
+      continue;
+    }
+    uint32_t j = i;
+    while (j > 0 && combiningClass(getProps(chars[j - 1])) > charClass) {
+      chars[j] = chars[j - 1];
+      j--;
+    }
+    chars[j] = c;
+  }
+}
+
+// Compose the segment in place with the canonical composition algorithm.  A
+// character composes with the last starter unless a character between them has
+// a combining class at least as high as its own.
+static void composeSegment(swNfcWriter *writer) {
+  uint32_t *chars = writer->chars;
+  bool haveStarter = combiningClass(getProps(chars[0])) == 0;
+  uint32_t starter = 0;
+  uint32_t lastClass = haveStarter? 0 : 256;
+  uint32_t numChars = 1;
+  for (uint32_t i = 1; i < writer->numChars; i++) {
+    uint32_t c = chars[i];
+    uint32_t charClass = combiningClass(getProps(c));
+    if (haveStarter && (lastClass < charClass || lastClass == 0)) {
+      uint32_t composite = composePair(chars[starter], c);
+      if (composite != 0) {
+        chars[starter] = composite;
+        continue;
+      }
+    }
+    if (charClass == 0) {
+      haveStarter = true;
+      starter = numChars;
+    }
+    lastClass = charClass;
+    chars[numChars++] = c;
+  }
+  writer->numChars = numChars;
+}
+
+// Normalize the buffered segment and write it out.
+static void flushSegment(swNfcWriter *writer) {
+  if (writer->numChars == 0) {
+    return;
+  }
+  reorderSegment(writer);
+  composeSegment(writer);
+  reserveOutput(writer, writer->numChars*SW_MAX_UTF8_CHAR_LEN);
+  for (uint32_t i = 0; i < writer->numChars; i++) {
+    writer->outLen += swEncodeUTF8(writer->chars[i], writer->out + writer->outLen);
+  }
+  writer->numChars = 0;
+}
+
+// Add one fully decomposed character to the segment.  A starter that never
+// composes with what comes before it starts a new segment.
+static void addChar(swNfcWriter *writer, uint32_t unicodeChar) {
+  uint32_t props = getProps(unicodeChar);
+  if (writer->numChars == MAX_SEGMENT || (writer->numChars != 0 &&
+      combiningClass(props) == 0 && quickCheck(props) != QC_MAYBE)) {
+    flushSegment(writer);
+  }
+  writer->chars[writer->numChars++] = unicodeChar;
+}
+
+// Add the full canonical decomposition of a character to the segment.
+static void decompose(swNfcWriter *writer, uint32_t unicodeChar) {
+  uint32_t sIndex = unicodeChar - HANGUL_S_BASE;
+  if (sIndex < HANGUL_S_COUNT) {
+    addChar(writer, HANGUL_L_BASE + sIndex/HANGUL_N_COUNT);
+    addChar(writer, HANGUL_V_BASE + (sIndex % HANGUL_N_COUNT)/HANGUL_T_COUNT);
+    if (sIndex % HANGUL_T_COUNT != 0) {
+      addChar(writer, HANGUL_T_BASE + sIndex % HANGUL_T_COUNT);
+    }
+    return;
+  }
+  uint32_t props = getProps(unicodeChar);
+  uint32_t length = (props >> 10) & 7;
+  if (length == 0) {
+    addChar(writer, unicodeChar);
+    return;
+  }
+  const uint32_t *decomposition = swNfcDecompositions + (props >> 13);
+  for (uint32_t i = 0; i < length; i++) {
+    addChar(writer, decomposition[i]);
+  }
+}
+
+// Normalize UTF-8 text to NFC.  Return text if it is already normalized, and
+// otherwise a zero-terminated copy allocated in arena.  Set *newLength to the
+// length of the result.  Invalid UTF-8 is copied unchanged.
+const char *swNormalizeNFC(swArena arena, const char *text, size_t length,
+    size_t *newLength) {
+  size_t pos = swNFCQuickCheck(text, length);
+  if (pos == length) {
+    *newLength = length;
+    return text;
+  }
+  swNfcWriter writer;
+  writer.arena = arena;
+  writer.outSize = length + (length >> 2) + 16;
+  writer.out = swArenaAlloc(arena, writer.outSize);
+  writer.outLen = 0;
+  writer.numChars = 0;
+  writeBytes(&writer, text, pos);
+  while (pos < length) {
+    size_t next = skipLowChars(text, pos, length);
+    if (next != pos) {
+      // Only the last of these characters can compose with what follows.
+      size_t last = lastCharStart(text, pos, next);
+      if (last != pos) {
+        flushSegment(&writer);
+        writeBytes(&writer, text + pos, last - pos);
+        pos = last;
+      }
+    }
+    bool valid;
+    uint32_t unicodeChar;
+    size_t len = swFindUTF8LengthAndValidate(text + pos, length - pos, &valid, &unicodeChar);
+    if (valid) {
+      decompose(&writer, unicodeChar);
+    } else {
+      flushSegment(&writer);
+      writeBytes(&writer, text + pos, len);
+    }
+    pos += len;
+  }
+  flushSegment(&writer);
+  reserveOutput(&writer, 1);
+  writer.out[writer.outLen] = '\0';
+  *newLength = writer.outLen;
+  return writer.out;
+}
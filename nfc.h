@@ -0,0 +1,26 @@
+// Unicode NFC normalization.
+//
+// Text pasted from the web and from PDFs often spells accented letters as a
+// base letter followed by combining marks.  Engines mispronounce these, and
+// punctuation lookup, which works on single code points, misses them.  NFC
+// composes them.  Nearly all text is already in NFC, and a quick check finds
+// that without copying it.
+
+#ifndef SW_NFC_H
+#define SW_NFC_H
+
+#include <stddef.h>
+
+#include "arena.h"
+
+// Return the length of the prefix of UTF-8 text that is known to be in NFC,
+// which is length when all of it is.  The prefix ends on a character boundary
+// that normalization never moves.
+size_t swNFCQuickCheck(const char *text, size_t length);
+// Normalize UTF-8 text to NFC.  Return text if it is already normalized, and
+// otherwise a zero-terminated copy allocated in arena.  Set *newLength to the
+// length of the result.  Invalid UTF-8 is copied unchanged.
+const char *swNormalizeNFC(swArena arena, const char *text, size_t length,
+    size_t *newLength);
+
+#endif  // SW_NFC_H
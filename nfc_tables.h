@@ -0,0 +1,3501 @@
+// Generated by gennfc.py from Unicode 14.0.0.  Do not edit.
+
+#define SW_NFC_PAGE_BITS 6
+
+static const uint8_t swNfcPageIndexes[17408] = {
+  0, 0, 0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 7, 8, 9, 10,
+  11, 12, 13, 14, 0, 0, 15, 16, 17, 18, 0, 19, 20, 21, 0, 22,
+  23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 29, 35, 36, 37,
+  33, 38, 33, 39, 40, 41, 0, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+  51, 0, 52, 0, 0, 53, 54, 55, 0, 0, 0, 0, 0, 56, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 58,
+  0, 0, 59, 0, 60, 0, 0, 0, 61, 62, 63, 64, 65, 66, 67, 68,
+  69, 0, 0, 70, 0, 0, 0, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 0, 0, 81, 82, 0, 83, 84, 85, 86, 87, 88, 89, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 0,
+  0, 0, 0, 91, 0, 92, 0, 93, 0, 0, 0, 0, 0, 0, 0, 0,
+  94, 95, 96, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 99, 100, 0, 0, 0, 0,
+  101, 0, 0, 102, 103, 104, 105, 106, 0, 0, 107, 108, 0, 0, 0, 109,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 120, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 121, 0, 0, 0, 122, 0, 123, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 124, 0, 0, 125, 0, 0, 0, 0,
+  0, 0, 0, 0, 126, 0, 0, 0, 0, 0, 127, 0, 0, 128, 129, 0,
+  0, 130, 131, 0, 132, 105, 0, 133, 134, 0, 0, 135, 136, 137, 0, 0,
+  0, 138, 139, 140, 0, 0, 141, 142, 92, 0, 143, 0, 144, 0, 0, 0,
+  145, 0, 0, 0, 146, 147, 0, 148, 149, 150, 151, 0, 0, 0, 0, 0,
+  92, 0, 0, 0, 0, 152, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 154, 155, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 156,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 157, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 158, 159, 160, 0, 161, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  162, 0, 0, 0, 155, 0, 0, 0, 0, 0, 163, 164, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 165, 0, 166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  167, 168, 169, 170, 171, 172, 173, 174, 175, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t swNfcPages[11264] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 2, 3, 4, 5, 6, 0, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  0, 16, 17, 18, 19, 20, 21, 0, 0, 22, 23, 24, 25, 26, 0, 0,
+  27, 28, 29, 30, 31, 32, 0, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+  0, 42, 43, 44, 45, 46, 47, 0, 0, 48, 49, 50, 51, 52, 0, 53,
+  54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+  0, 0, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+  84, 85, 86, 87, 88, 89, 0, 0, 90, 91, 92, 93, 94, 95, 96, 97,
+  98, 0, 0, 0, 99, 100, 101, 102, 0, 103, 104, 105, 106, 107, 108, 0,
+  0, 0, 0, 109, 110, 111, 112, 113, 114, 0, 0, 0, 115, 116, 117, 118,
+  119, 120, 0, 0, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+  133, 134, 135, 136, 137, 138, 0, 0, 139, 140, 141, 142, 143, 144, 145, 146,
+  147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  162, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164,
+  165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166, 167, 168,
+  169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 0, 182, 183,
+  184, 185, 186, 187, 0, 0, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197,
+  198, 0, 0, 0, 199, 200, 0, 0, 201, 202, 203, 204, 205, 206, 207, 208,
+  209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+  225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 0, 0, 237, 238,
+  0, 0, 0, 0, 0, 0, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248,
+  249, 250, 251, 252, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  253, 253, 253, 253, 253, 254, 253, 253, 253, 253, 253, 253, 253, 254, 254, 253,
+  254, 253, 254, 253, 253, 255, 256, 256, 256, 256, 255, 257, 256, 256, 256, 256,
+  256, 258, 258, 259, 259, 259, 259, 260, 260, 256, 256, 256, 256, 259, 259, 256,
+  259, 259, 256, 256, 261, 261, 261, 261, 262, 256, 256, 256, 256, 254, 254, 254,
+  263, 264, 253, 265, 266, 267, 254, 256, 256, 256, 254, 254, 254, 256, 256, 0,
+  254, 254, 254, 256, 256, 256, 256, 254, 255, 256, 256, 254, 268, 269, 269, 268,
+  269, 269, 268, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+  0, 0, 0, 0, 270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 271, 0,
+  0, 0, 0, 0, 0, 272, 273, 274, 275, 276, 277, 0, 278, 0, 279, 280,
+  281, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 282, 283, 284, 285, 286, 287,
+  288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 289, 290, 291, 292, 293, 0,
+  0, 0, 0, 294, 295, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  296, 297, 0, 298, 0, 0, 0, 299, 0, 0, 0, 0, 300, 301, 302, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 303, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  305, 306, 0, 307, 0, 0, 0, 308, 0, 0, 0, 0, 309, 310, 311, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 312, 313, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 314, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  316, 317, 318, 319, 0, 0, 320, 321, 0, 0, 322, 323, 324, 325, 326, 327,
+  0, 0, 328, 329, 330, 331, 332, 333, 0, 0, 334, 335, 336, 337, 338, 339,
+  340, 341, 342, 343, 344, 345, 0, 0, 346, 347, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 256, 254, 254, 254, 254, 256, 254, 254, 254, 348, 256, 254, 254, 254, 254,
+  254, 254, 256, 256, 256, 256, 256, 256, 254, 254, 256, 254, 254, 348, 349, 254,
+  350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 359, 360, 361, 362, 0, 363,
+  0, 364, 365, 0, 254, 256, 0, 358, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  254, 254, 254, 254, 254, 254, 254, 254, 366, 367, 368, 0, 0, 0, 0, 0,
+  0, 0, 369, 370, 371, 372, 373, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 374, 375, 376, 366, 367,
+  368, 377, 378, 253, 253, 259, 256, 254, 254, 254, 254, 254, 256, 254, 254, 256,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  379, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  380, 0, 381, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 382, 0, 0, 254, 254, 254, 254, 254, 254, 254, 0, 0, 254,
+  254, 254, 254, 256, 254, 0, 0, 254, 254, 0, 256, 254, 254, 256, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  254, 256, 254, 254, 256, 254, 254, 256, 256, 256, 254, 256, 256, 254, 256, 254,
+  254, 254, 256, 254, 256, 254, 256, 254, 256, 254, 254, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254,
+  254, 254, 256, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 0, 254, 254, 254, 254, 254,
+  254, 254, 254, 254, 0, 254, 254, 254, 0, 254, 254, 254, 254, 254, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 254, 256, 256, 256, 254, 254, 254, 254,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 256,
+  256, 256, 256, 256, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+  254, 254, 0, 256, 254, 254, 256, 254, 254, 256, 254, 254, 254, 256, 256, 256,
+  374, 375, 376, 254, 254, 254, 256, 254, 254, 256, 256, 254, 254, 254, 254, 254,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 0, 0, 0, 0, 0, 0,
+  0, 385, 0, 0, 386, 0, 0, 0, 0, 0, 0, 0, 387, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0,
+  0, 254, 256, 254, 254, 0, 0, 0, 389, 390, 391, 392, 393, 394, 395, 396,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 398, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 399, 400, 388, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 401, 402, 0, 403,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 404, 0, 0, 405, 0, 0, 0, 0, 0, 397, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 407, 408, 0, 0, 409, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 410, 0, 0, 411, 412, 388, 0, 0,
+  0, 0, 0, 0, 0, 0, 398, 398, 0, 0, 0, 0, 413, 414, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 416, 417, 418, 388, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 419, 0, 0, 0, 0, 388, 0, 0,
+  0, 0, 0, 0, 0, 420, 421, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  422, 0, 398, 0, 0, 0, 0, 423, 424, 0, 425, 426, 0, 388, 0, 0,
+  0, 0, 0, 0, 0, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 388, 0, 398, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 427, 428, 429, 388, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 430, 0, 0, 0, 0, 398,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 431, 0, 432, 433, 434, 398,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 435, 435, 388, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 436, 436, 436, 436, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 437, 437, 388, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 438, 438, 438, 438, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 256, 0, 256, 0, 439, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 440, 0, 0, 0, 0, 0, 0, 0, 0, 0, 441, 0, 0,
+  0, 0, 442, 0, 0, 0, 0, 443, 0, 0, 0, 0, 444, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 445, 0, 0, 0, 0, 0, 0,
+  0, 446, 447, 448, 449, 450, 451, 0, 452, 0, 447, 447, 447, 447, 0, 0,
+  447, 453, 254, 254, 388, 0, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 454, 0, 0, 0, 0, 0, 0, 0, 0, 0, 455, 0, 0,
+  0, 0, 456, 0, 0, 0, 0, 457, 0, 0, 0, 0, 458, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 460, 0, 0, 0, 0, 0, 0, 0, 398, 0,
+  0, 0, 0, 0, 0, 0, 0, 397, 0, 388, 388, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+  398, 398, 398, 398, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 398, 398, 398, 398, 398, 398,
+  398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+  398, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 349, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 348, 254, 256, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 254, 256, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 254, 254, 0, 0, 256,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  254, 254, 254, 254, 254, 256, 256, 256, 256, 256, 256, 254, 254, 256, 0, 256,
+  256, 254, 254, 256, 256, 254, 254, 254, 254, 254, 256, 254, 254, 254, 254, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 461, 0, 462, 0, 463, 0, 464, 0, 465, 0,
+  0, 0, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 397, 398, 0, 0, 0, 0, 0, 467, 0, 468, 0, 0,
+  469, 470, 0, 471, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 256, 254, 254, 254,
+  254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 388, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  254, 254, 254, 0, 261, 256, 256, 256, 256, 256, 254, 254, 256, 256, 256, 256,
+  254, 0, 261, 261, 261, 261, 261, 261, 261, 0, 0, 0, 0, 256, 0, 0,
+  0, 0, 0, 0, 254, 0, 0, 0, 254, 254, 0, 0, 0, 0, 0, 0,
+  254, 254, 256, 254, 254, 254, 254, 254, 254, 254, 256, 254, 254, 269, 472, 256,
+  258, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+  254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+  254, 254, 254, 254, 254, 254, 255, 349, 349, 256, 473, 254, 268, 256, 254, 256,
+  474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489,
+  490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
+  506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521,
+  522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537,
+  538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553,
+  554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
+  570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585,
+  586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601,
+  602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617,
+  618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 0, 628, 0, 0, 0, 0,
+  629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
+  645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660,
+  661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676,
+  677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692,
+  693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708,
+  709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 0, 0, 0, 0, 0, 0,
+  719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
+  735, 736, 737, 738, 739, 740, 0, 0, 741, 742, 743, 744, 745, 746, 0, 0,
+  747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762,
+  763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778,
+  779, 780, 781, 782, 783, 784, 0, 0, 785, 786, 787, 788, 789, 790, 0, 0,
+  791, 792, 793, 794, 795, 796, 797, 798, 0, 799, 0, 800, 0, 801, 0, 802,
+  803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818,
+  819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 0, 0,
+  833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848,
+  849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864,
+  865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880,
+  881, 882, 883, 884, 885, 0, 886, 887, 888, 889, 890, 891, 892, 0, 893, 0,
+  0, 894, 895, 896, 897, 0, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907,
+  908, 909, 910, 911, 0, 0, 912, 913, 914, 915, 916, 917, 0, 918, 919, 920,
+  921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936,
+  0, 0, 937, 938, 939, 0, 940, 941, 942, 943, 944, 945, 946, 947, 0, 0,
+  948, 949, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  254, 254, 261, 261, 254, 254, 254, 254, 261, 261, 261, 254, 254, 0, 0, 0,
+  0, 254, 0, 0, 0, 261, 261, 254, 256, 254, 261, 261, 256, 256, 256, 256,
+  254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 950, 0, 0, 0, 951, 952, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 953, 954, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 955, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 956, 957, 958,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 959, 0, 0, 0, 0, 960, 0, 0, 961, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 962, 0, 963, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 964, 0, 0, 965, 0, 0, 966, 0, 967, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  968, 0, 969, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 970, 971, 972,
+  973, 974, 0, 0, 975, 976, 0, 0, 977, 978, 0, 0, 0, 0, 0, 0,
+  979, 980, 0, 0, 981, 982, 0, 0, 983, 984, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 985, 986, 987, 988,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  989, 990, 991, 992, 0, 0, 0, 0, 0, 0, 993, 994, 995, 996, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 997, 998, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 999, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254,
+  254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+  254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 473, 349, 255, 348, 1000, 1000,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1001, 0, 1002, 0,
+  1003, 0, 1004, 0, 1005, 0, 1006, 0, 1007, 0, 1008, 0, 1009, 0, 1010, 0,
+  1011, 0, 1012, 0, 0, 1013, 0, 1014, 0, 1015, 0, 0, 0, 0, 0, 0,
+  1016, 1017, 0, 1018, 1019, 0, 1020, 1021, 0, 1022, 1023, 0, 1024, 1025, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1026, 0, 0, 0, 0, 1027, 1027, 0, 0, 0, 1028, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1029, 0, 1030, 0,
+  1031, 0, 1032, 0, 1033, 0, 1034, 0, 1035, 0, 1036, 0, 1037, 0, 1038, 0,
+  1039, 0, 1040, 0, 0, 1041, 0, 1042, 0, 1043, 0, 0, 0, 0, 0, 0,
+  1044, 1045, 0, 1046, 1047, 0, 1048, 1049, 0, 1050, 1051, 0, 1052, 1053, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1054, 0, 0, 1055, 1056, 1057, 1058, 0, 0, 0, 1059, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254,
+  0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+  254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  254, 0, 254, 254, 256, 0, 0, 254, 254, 0, 0, 0, 0, 0, 254, 254,
+  0, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
+  1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090,
+  1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106,
+  1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122,
+  1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138,
+  1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1079, 1151, 1152, 1153,
+  1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169,
+  1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185,
+  1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201,
+  1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217,
+  1218, 1169, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1153, 1227, 1228, 1229, 1230, 1231,
+  1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1079,
+  1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262,
+  1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1155, 1274, 1275, 1276, 1277,
+  1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293,
+  1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309,
+  1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 0, 0,
+  1324, 0, 1325, 0, 0, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 0,
+  1336, 0, 1337, 0, 0, 1338, 1339, 0, 0, 0, 1340, 1341, 1342, 1343, 1344, 1345,
+  1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361,
+  1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377,
+  1378, 1379, 1380, 1381, 1382, 1383, 1384, 1208, 1385, 1386, 1387, 1388, 1389, 1390, 1390, 1391,
+  1392, 1393, 1394, 1395, 1396, 1397, 1398, 1338, 1399, 1400, 1401, 1402, 1403, 1404, 0, 0,
+  1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1352, 1413, 1414, 1415, 1324, 1416, 1417, 1418,
+  1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1361, 1428, 1362, 1429, 1430, 1431, 1432,
+  1433, 1325, 1100, 1434, 1435, 1436, 1170, 1257, 1437, 1438, 1369, 1439, 1370, 1440, 1441, 1442,
+  1327, 1443, 1444, 1445, 1446, 1447, 1328, 1448, 1449, 1450, 1451, 1452, 1453, 1384, 1454, 1455,
+  1208, 1456, 1388, 1457, 1458, 1459, 1460, 1461, 1393, 1462, 1337, 1463, 1394, 1151, 1464, 1395,
+  1465, 1397, 1466, 1467, 1468, 1469, 1470, 1399, 1333, 1471, 1400, 1472, 1401, 1473, 1067, 1474,
+  1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1485, 1486, 1487,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1488, 1489, 1490, 1491, 1492, 1493,
+  1494, 1495, 1496, 1497, 1498, 1499, 1500, 0, 1501, 1502, 1503, 1504, 1505, 0, 1506, 0,
+  1507, 1508, 0, 1509, 1510, 0, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  254, 254, 254, 254, 254, 254, 254, 256, 256, 256, 256, 256, 256, 256, 254, 254,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 254,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 254, 261, 256, 0, 0, 0, 0, 388,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 254, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 256, 256, 254, 254, 254, 256, 254, 256, 256, 256,
+  256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 254, 256, 254, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1520, 0, 1521, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1522, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 387, 0, 0, 0, 0, 0,
+  254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 1523, 1524,
+  0, 0, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 388, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 388, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 397, 0, 398, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1525, 1526, 388, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 254, 0, 0, 0,
+  254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 388, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 1527, 1528, 398, 1529, 0,
+  0, 0, 388, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1530, 1531, 0, 0, 0, 388,
+  397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 388, 397, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 397, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  398, 0, 0, 0, 0, 0, 0, 0, 1532, 0, 0, 0, 0, 388, 388, 0,
+  0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 397, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  261, 261, 261, 261, 261, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  254, 254, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1533, 1533, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 261, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1534, 1535,
+  1536, 1537, 1538, 1539, 1540, 439, 439, 261, 261, 261, 0, 0, 0, 1541, 439, 439,
+  439, 439, 439, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 256, 256,
+  256, 256, 256, 0, 0, 254, 254, 254, 254, 254, 256, 256, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1542, 1543, 1544, 1545, 1546,
+  1547, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  254, 254, 254, 254, 254, 254, 254, 0, 254, 254, 254, 254, 254, 254, 254, 254,
+  254, 254, 254, 254, 254, 254, 254, 254, 254, 0, 0, 254, 254, 254, 254, 254,
+  254, 254, 0, 254, 254, 0, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  256, 256, 256, 256, 256, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 397, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1548, 1549, 1550, 1551, 1552, 1346, 1553, 1554, 1555, 1556, 1347, 1557, 1558, 1559, 1348, 1560,
+  1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1406, 1572, 1573, 1574, 1575,
+  1576, 1577, 1578, 1579, 1580, 1411, 1349, 1350, 1412, 1581, 1582, 1157, 1583, 1351, 1584, 1585,
+  1586, 1587, 1587, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599,
+  1600, 1601, 1602, 1603, 1604, 1605, 1605, 1414, 1606, 1607, 1608, 1609, 1353, 1610, 1611, 1612,
+  1310, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627,
+  1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1638, 1639, 1640, 1641, 1153,
+  1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1358, 1650, 1651, 1652, 1653, 1654, 1655, 1656,
+  1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1099, 1671,
+  1672, 1673, 1673, 1674, 1675, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685,
+  1686, 1687, 1688, 1359, 1689, 1690, 1691, 1692, 1426, 1692, 1693, 1361, 1694, 1695, 1696, 1697,
+  1362, 1072, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711,
+  1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1363, 1720, 1721, 1722, 1723, 1724, 1725, 1365,
+  1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1100, 1434, 1734, 1735, 1736, 1737, 1738, 1739,
+  1740, 1741, 1366, 1742, 1743, 1744, 1745, 1477, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753,
+  1754, 1755, 1756, 1757, 1758, 1170, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768,
+  1769, 1367, 1257, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1438, 1778, 1779, 1780, 1781,
+  1782, 1783, 1784, 1785, 1439, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796,
+  1797, 1441, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1808, 1809, 1810,
+  1443, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1156, 1818, 1819, 1820, 1821, 1822, 1823, 1824,
+  1449, 1825, 1826, 1827, 1828, 1829, 1830, 1830, 1450, 1479, 1831, 1832, 1833, 1834, 1835, 1118,
+  1452, 1836, 1837, 1378, 1838, 1839, 1332, 1840, 1841, 1382, 1842, 1843, 1844, 1845, 1845, 1846,
+  1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862,
+  1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1388, 1873, 1874, 1875, 1876, 1877,
+  1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1674, 1889, 1890, 1891, 1892,
+  1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1174, 1901, 1902, 1903, 1904, 1905, 1906, 1391,
+  1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922,
+  1923, 1924, 1925, 1926, 1113, 1927, 1928, 1929, 1930, 1931, 1932, 1459, 1933, 1934, 1935, 1936,
+  1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952,
+  1464, 1465, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1466,
+  1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981,
+  1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1472, 1472,
+  1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 1473, 2006, 2007, 2008, 2009, 2010,
+  2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint32_t swNfcProps[2025] = {
+  0x0, 0x800, 0x4800, 0x8800, 0xc800, 0x10800,
+  0x14800, 0x18800, 0x1c800, 0x20800, 0x24800, 0x28800,
+  0x2c800, 0x30800, 0x34800, 0x38800, 0x3c800, 0x40800,
+  0x44800, 0x48800, 0x4c800, 0x50800, 0x54800, 0x58800,
+  0x5c800, 0x60800, 0x64800, 0x68800, 0x6c800, 0x70800,
+  0x74800, 0x78800, 0x7c800, 0x80800, 0x84800, 0x88800,
+  0x8c800, 0x90800, 0x94800, 0x98800, 0x9c800, 0xa0800,
+  0xa4800, 0xa8800, 0xac800, 0xb0800, 0xb4800, 0xb8800,
+  0xbc800, 0xc0800, 0xc4800, 0xc8800, 0xcc800, 0xd0800,
+  0xd4800, 0xd8800, 0xdc800, 0xe0800, 0xe4800, 0xe8800,
+  0xec800, 0xf0800, 0xf4800, 0xf8800, 0xfc800, 0x100800,
+  0x104800, 0x108800, 0x10c800, 0x110800, 0x114800, 0x118800,
+  0x11c800, 0x120800, 0x124800, 0x128800, 0x12c800, 0x130800,
+  0x134800, 0x138800, 0x13c800, 0x140800, 0x144800, 0x148800,
+  0x14c800, 0x150800, 0x154800, 0x158800, 0x15c800, 0x160800,
+  0x164800, 0x168800, 0x16c800, 0x170800, 0x174800, 0x178800,
+  0x17c800, 0x180800, 0x184800, 0x188800, 0x18c800, 0x190800,
+  0x194800, 0x198800, 0x19c800, 0x1a0800, 0x1a4800, 0x1a8800,
+  0x1ac800, 0x1b0800, 0x1b4800, 0x1b8800, 0x1bc800, 0x1c0800,
+  0x1c4800, 0x1c8800, 0x1cc800, 0x1d0800, 0x1d4800, 0x1d8800,
+  0x1dc800, 0x1e0800, 0x1e4800, 0x1e8800, 0x1ec800, 0x1f0800,
+  0x1f4800, 0x1f8800, 0x1fc800, 0x200800, 0x204800, 0x208800,
+  0x20c800, 0x210800, 0x214800, 0x218800, 0x21c800, 0x220800,
+  0x224800, 0x228800, 0x22c800, 0x230800, 0x234800, 0x238800,
+  0x23c800, 0x240800, 0x244800, 0x248800, 0x24c800, 0x250800,
+  0x254800, 0x258800, 0x25c800, 0x260800, 0x264800, 0x268800,
+  0x26c800, 0x270800, 0x274800, 0x278800, 0x27c800, 0x280800,
+  0x284800, 0x288800, 0x28c800, 0x290800, 0x294800, 0x298800,
+  0x29c800, 0x2a0800, 0x2a4800, 0x2a8800, 0x2ac800, 0x2b0800,
+  0x2b4c00, 0x2bac00, 0x2c0c00, 0x2c6c00, 0x2ccc00, 0x2d2c00,
+  0x2d8c00, 0x2dec00, 0x2e4c00, 0x2eac00, 0x2f0c00, 0x2f6c00,
+  0x2fc800, 0x300800, 0x304800, 0x308800, 0x30c800, 0x310800,
+  0x314800, 0x318800, 0x31cc00, 0x322c00, 0x328800, 0x32c800,
+  0x330800, 0x334800, 0x338800, 0x33c800, 0x340800, 0x344c00,
+  0x34ac00, 0x350800, 0x354800, 0x358800, 0x35c800, 0x360800,
+  0x364800, 0x368800, 0x36c800, 0x370800, 0x374800, 0x378800,
+  0x37c800, 0x380800, 0x384800, 0x388800, 0x38c800, 0x390800,
+  0x394800, 0x398800, 0x39c800, 0x3a0800, 0x3a4800, 0x3a8800,
+  0x3ac800, 0x3b0800, 0x3b4800, 0x3b8800, 0x3bc800, 0x3c0800,
+  0x3c4800, 0x3c8800, 0x3cc800, 0x3d0800, 0x3d4800, 0x3d8800,
+  0x3dc800, 0x3e0800, 0x3e4800, 0x3e8c00, 0x3eec00, 0x3f4c00,
+  0x3fac00, 0x400800, 0x404800, 0x408c00, 0x40ec00, 0x414800,
+  0x418800, 0x1e6, 0xe6, 0xe8, 0xdc, 0x1d8,
+  0xca, 0x1dc, 0x1ca, 0x1, 0x101, 0x41c6e6,
+  0x41e6e6, 0x4206e6, 0x422ae6, 0x1f0, 0xe9, 0xea,
+  0x426600, 0x428600, 0x42a800, 0x42e800, 0x432600, 0x434800,
+  0x438800, 0x43c800, 0x440800, 0x444800, 0x448800, 0x44cc00,
+  0x452800, 0x456800, 0x45a800, 0x45e800, 0x462800, 0x466800,
+  0x46ac00, 0x470800, 0x474800, 0x478800, 0x47c800, 0x480800,
+  0x484800, 0x488800, 0x48c800, 0x490800, 0x494800, 0x498800,
+  0x49c800, 0x4a0800, 0x4a4800, 0x4a8800, 0x4ac800, 0x4b0800,
+  0x4b4800, 0x4b8800, 0x4bc800, 0x4c0800, 0x4c4800, 0x4c8800,
+  0x4cc800, 0x4d0800, 0x4d4800, 0x4d8800, 0x4dc800, 0x4e0800,
+  0x4e4800, 0x4e8800, 0x4ec800, 0x4f0800, 0x4f4800, 0x4f8800,
+  0x4fc800, 0x500800, 0x504800, 0x508800, 0x50c800, 0x510800,
+  0x514800, 0x518800, 0x51c800, 0x520800, 0x524800, 0x528800,
+  0x52c800, 0x530800, 0x534800, 0x538800, 0x53c800, 0x540800,
+  0x544800, 0x548800, 0x54c800, 0x550800, 0x554800, 0x558800,
+  0xde, 0xe4, 0xa, 0xb, 0xc, 0xd,
+  0xe, 0xf, 0x10, 0x11, 0x12, 0x13,
+  0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+  0x1e, 0x1f, 0x20, 0x55c800, 0x560800, 0x564800,
+  0x568800, 0x56c800, 0x1b, 0x1c, 0x1d, 0x21,
+  0x22, 0x23, 0x570800, 0x574800, 0x578800, 0x24,
+  0x57c800, 0x580800, 0x584800, 0x107, 0x9, 0x588a00,
+  0x58ca00, 0x590a00, 0x594a00, 0x598a00, 0x59ca00, 0x5a0a00,
+  0x5a4a00, 0x7, 0x100, 0x5a8800, 0x5ac800, 0x5b0a00,
+  0x5b4a00, 0x5b8a00, 0x5bca00, 0x5c0a00, 0x5c4a00, 0x5c8a00,
+  0x5cca00, 0x5d0a00, 0x5d4800, 0x5d8800, 0x5dc800, 0x5e0a00,
+  0x5e4a00, 0x5e8800, 0x5ec800, 0x5f0800, 0x5f4800, 0x5f8800,
+  0x54, 0x15b, 0x5fc800, 0x600800, 0x604800, 0x608800,
+  0x60cc00, 0x612800, 0x616800, 0x61a800, 0x109, 0x61e800,
+  0x622800, 0x626c00, 0x62c800, 0x67, 0x6b, 0x76,
+  0x7a, 0xd8, 0x630a00, 0x634a00, 0x638a00, 0x63ca00,
+  0x640a00, 0x644a00, 0x81, 0x82, 0x648a00, 0x84,
+  0x64ca00, 0x650a00, 0x654a00, 0x658a00, 0x65ca00, 0x660a00,
+  0x664a00, 0x668a00, 0x66ca00, 0x670a00, 0x674800, 0x678800,
+  0x67c800, 0x680800, 0x684800, 0x688800, 0x68c800, 0x690800,
+  0x694800, 0x698800, 0x69c800, 0x6a0800, 0xd6, 0xda,
+  0x6a4800, 0x6a8800, 0x6ac800, 0x6b0800, 0x6b4800, 0x6b8800,
+  0x6bc800, 0x6c0800, 0x6c4c00, 0x6cac00, 0x6d0800, 0x6d4800,
+  0x6d8800, 0x6dc800, 0x6e0800, 0x6e4800, 0x6e8800, 0x6ec800,
+  0x6f0800, 0x6f4800, 0x6f8c00, 0x6fec00, 0x704c00, 0x70ac00,
+  0x710800, 0x714800, 0x718800, 0x71c800, 0x720c00, 0x726c00,
+  0x72c800, 0x730800, 0x734800, 0x738800, 0x73c800, 0x740800,
+  0x744800, 0x748800, 0x74c800, 0x750800, 0x754800, 0x758800,
+  0x75c800, 0x760800, 0x764800, 0x768800, 0x76cc00, 0x772c00,
+  0x778800, 0x77c800, 0x780800, 0x784800, 0x788800, 0x78c800,
+  0x790800, 0x794800, 0x798c00, 0x79ec00, 0x7a4800, 0x7a8800,
+  0x7ac800, 0x7b0800, 0x7b4800, 0x7b8800, 0x7bc800, 0x7c0800,
+  0x7c4800, 0x7c8800, 0x7cc800, 0x7d0800, 0x7d4800, 0x7d8800,
+  0x7dc800, 0x7e0800, 0x7e4800, 0x7e8800, 0x7ecc00, 0x7f2c00,
+  0x7f8c00, 0x7fec00, 0x804c00, 0x80ac00, 0x810c00, 0x816c00,
+  0x81c800, 0x820800, 0x824800, 0x828800, 0x82c800, 0x830800,
+  0x834800, 0x838800, 0x83cc00, 0x842c00, 0x848800, 0x84c800,
+  0x850800, 0x854800, 0x858800, 0x85c800, 0x860c00, 0x866c00,
+  0x86cc00, 0x872c00, 0x878c00, 0x87ec00, 0x884800, 0x888800,
+  0x88c800, 0x890800, 0x894800, 0x898800, 0x89c800, 0x8a0800,
+  0x8a4800, 0x8a8800, 0x8ac800, 0x8b0800, 0x8b4800, 0x8b8800,
+  0x8bcc00, 0x8c2c00, 0x8c8c00, 0x8cec00, 0x8d4800, 0x8d8800,
+  0x8dc800, 0x8e0800, 0x8e4800, 0x8e8800, 0x8ec800, 0x8f0800,
+  0x8f4800, 0x8f8800, 0x8fc800, 0x900800, 0x904800, 0x908800,
+  0x90c800, 0x910800, 0x914800, 0x918800, 0x91c800, 0x920800,
+  0x924800, 0x928800, 0x92c800, 0x930800, 0x934800, 0x938800,
+  0x93c800, 0x940800, 0x944800, 0x948800, 0x94c800, 0x950800,
+  0x954800, 0x958800, 0x95c800, 0x960c00, 0x966c00, 0x96cc00,
+  0x972c00, 0x978c00, 0x97ec00, 0x984c00, 0x98ac00, 0x990c00,
+  0x996c00, 0x99cc00, 0x9a2c00, 0x9a8c00, 0x9aec00, 0x9b4c00,
+  0x9bac00, 0x9c0c00, 0x9c6c00, 0x9ccc00, 0x9d2c00, 0x9d8800,
+  0x9dc800, 0x9e0800, 0x9e4800, 0x9e8800, 0x9ec800, 0x9f0c00,
+  0x9f6c00, 0x9fcc00, 0xa02c00, 0xa08c00, 0xa0ec00, 0xa14c00,
+  0xa1ac00, 0xa20c00, 0xa26c00, 0xa2c800, 0xa30800, 0xa34800,
+  0xa38800, 0xa3c800, 0xa40800, 0xa44800, 0xa48800, 0xa4cc00,
+  0xa52c00, 0xa58c00, 0xa5ec00, 0xa64c00, 0xa6ac00, 0xa70c00,
+  0xa76c00, 0xa7cc00, 0xa82c00, 0xa88c00, 0xa8ec00, 0xa94c00,
+  0xa9ac00, 0xaa0c00, 0xaa6c00, 0xaacc00, 0xab2c00, 0xab8c00,
+  0xabec00, 0xac4800, 0xac8800, 0xacc800, 0xad0800, 0xad4c00,
+  0xadac00, 0xae0c00, 0xae6c00, 0xaecc00, 0xaf2c00, 0xaf8c00,
+  0xafec00, 0xb04c00, 0xb0ac00, 0xb10800, 0xb14800, 0xb18800,
+  0xb1c800, 0xb20800, 0xb24800, 0xb28800, 0xb2c800, 0xb30800,
+  0xb34800, 0xb38c00, 0xb3ec00, 0xb44c00, 0xb4ac00, 0xb50c00,
+  0xb56c00, 0xb5c800, 0xb60800, 0xb64c00, 0xb6ac00, 0xb70c00,
+  0xb76c00, 0xb7cc00, 0xb82c00, 0xb88800, 0xb8c800, 0xb90c00,
+  0xb96c00, 0xb9cc00, 0xba2c00, 0xba8800, 0xbac800, 0xbb0c00,
+  0xbb6c00, 0xbbcc00, 0xbc2c00, 0xbc8800, 0xbcc800, 0xbd0c00,
+  0xbd6c00, 0xbdcc00, 0xbe2c00, 0xbe8c00, 0xbeec00, 0xbf4800,
+  0xbf8800, 0xbfcc00, 0xc02c00, 0xc08c00, 0xc0ec00, 0xc14c00,
+  0xc1ac00, 0xc20800, 0xc24800, 0xc28c00, 0xc2ec00, 0xc34c00,
+  0xc3ac00, 0xc40c00, 0xc46c00, 0xc4c800, 0xc50800, 0xc54c00,
+  0xc5ac00, 0xc60c00, 0xc66c00, 0xc6cc00, 0xc72c00, 0xc78800,
+  0xc7c800, 0xc80c00, 0xc86c00, 0xc8cc00, 0xc92c00, 0xc98800,
+  0xc9c800, 0xca0c00, 0xca6c00, 0xcacc00, 0xcb2c00, 0xcb8800,
+  0xcbc800, 0xcc0c00, 0xcc6c00, 0xcccc00, 0xcd2c00, 0xcd8c00,
+  0xcdec00, 0xce4800, 0xce8c00, 0xceec00, 0xcf4c00, 0xcfa800,
+  0xcfe800, 0xd02c00, 0xd08c00, 0xd0ec00, 0xd14c00, 0xd1ac00,
+  0xd20c00, 0xd26800, 0xd2a800, 0xd2ec00, 0xd34c00, 0xd3ac00,
+  0xd40c00, 0xd46c00, 0xd4cc00, 0xd52800, 0x45aa00, 0xd56800,
+  0x45ea00, 0xd5a800, 0x462a00, 0xd5e800, 0x466a00, 0xd62800,
+  0x478a00, 0xd66800, 0x47ca00, 0xd6a800, 0x480a00, 0xd6ec00,
+  0xd74c00, 0xd7b000, 0xd83000, 0xd8b000, 0xd93000, 0xd9b000,
+  0xda3000, 0xdaac00, 0xdb0c00, 0xdb7000, 0xdbf000, 0xdc7000,
+  0xdcf000, 0xdd7000, 0xddf000, 0xde6c00, 0xdecc00, 0xdf3000,
+  0xdfb000, 0xe03000, 0xe0b000, 0xe13000, 0xe1b000, 0xe22c00,
+  0xe28c00, 0xe2f000, 0xe37000, 0xe3f000, 0xe47000, 0xe4f000,
+  0xe57000, 0xe5ec00, 0xe64c00, 0xe6b000, 0xe73000, 0xe7b000,
+  0xe83000, 0xe8b000, 0xe93000, 0xe9ac00, 0xea0c00, 0xea7000,
+  0xeaf000, 0xeb7000, 0xebf000, 0xec7000, 0xecf000, 0xed6800,
+  0xeda800, 0xedec00, 0xee4800, 0xee8c00, 0xeee800, 0xef2c00,
+  0xef8800, 0xefc800, 0xf00800, 0x42ea00, 0xf04800, 0xf08600,
+  0xf0a800, 0xf0ec00, 0xf14800, 0xf18c00, 0xf1e800, 0xf22c00,
+  0xf28800, 0x434a00, 0xf2c800, 0x438a00, 0xf30800, 0xf34800,
+  0xf38800, 0xf3c800, 0xf40800, 0xf44800, 0xf48c00, 0x44ce00,
+  0xf4e800, 0xf52c00, 0xf58800, 0xf5c800, 0xf60800, 0x43ca00,
+  0xf64800, 0xf68800, 0xf6c800, 0xf70800, 0xf74800, 0xf78c00,
+  0x46ae00, 0xf7e800, 0xf82800, 0xf86800, 0xf8ac00, 0xf90800,
+  0xf94800, 0xf98800, 0x444a00, 0xf9c800, 0xfa0800, 0x42aa00,
+  0xfa4600, 0xfa6c00, 0xfac800, 0xfb0c00, 0xfb6800, 0xfbac00,
+  0xfc0800, 0x440a00, 0xfc4800, 0x448a00, 0xfc8800, 0xfcc600,
+  0xfce600, 0xfd0600, 0xfd2600, 0xfd4600, 0x14a00, 0xfd6800,
+  0xfda800, 0xfde800, 0xfe2800, 0xfe6800, 0xfea800, 0xfee800,
+  0xff2800, 0xff6800, 0xffa800, 0xffe800, 0x1002800, 0x1006800,
+  0x100a800, 0x100e800, 0x1012800, 0x1016800, 0x101a800, 0x101e800,
+  0x1022800, 0x1026800, 0x102a800, 0x102e800, 0x1032800, 0x1036800,
+  0x103a800, 0x103e800, 0x1042800, 0x1046800, 0x104a800, 0x104e800,
+  0x1052800, 0x1056800, 0x105a800, 0x105e800, 0x1062800, 0x1066800,
+  0x106a800, 0x106e800, 0x1072800, 0x1076800, 0x107a800, 0x107e800,
+  0x1082800, 0x1086600, 0x1088600, 0x108aa00, 0xe0, 0x108e800,
+  0x1092800, 0x1096800, 0x109a800, 0x109e800, 0x10a2800, 0x10a6800,
+  0x10aa800, 0x10ae800, 0x10b2800, 0x10b6800, 0x10ba800, 0x10be800,
+  0x10c2800, 0x10c6800, 0x10ca800, 0x10ce800, 0x10d2800, 0x10d6800,
+  0x10da800, 0x10de800, 0x10e2800, 0x10e6800, 0x10ea800, 0x10ee800,
+  0x10f2800, 0x108, 0x10f6800, 0x10fa800, 0x10fe800, 0x1102800,
+  0x1106800, 0x110a800, 0x110e800, 0x1112800, 0x1116800, 0x111a800,
+  0x111e800, 0x1122800, 0x1126800, 0x112a800, 0x112e800, 0x1132800,
+  0x1136800, 0x113a800, 0x113e800, 0x1142800, 0x1146800, 0x114a800,
+  0x114e800, 0x1152800, 0x1156800, 0x115a800, 0x115e800, 0x1162800,
+  0x1166800, 0x116a800, 0x116e800, 0x1172800, 0x1176600, 0x1178600,
+  0x117a600, 0x117c600, 0x117e600, 0x1180600, 0x1182600, 0x1184600,
+  0x1186600, 0x1188600, 0x118a600, 0x118c600, 0x118e600, 0x1190600,
+  0x1192600, 0x1194600, 0x1196600, 0x1198600, 0x119a600, 0x119c600,
+  0x119e600, 0x11a0600, 0x11a2600, 0x11a4600, 0x11a6600, 0x11a8600,
+  0x11aa600, 0x11ac600, 0x11ae600, 0x11b0600, 0x11b2600, 0x11b4600,
+  0x11b6600, 0x11b8600, 0x11ba600, 0x11bc600, 0x11be600, 0x11c0600,
+  0x11c2600, 0x11c4600, 0x11c6600, 0x11c8600, 0x11ca600, 0x11cc600,
+  0x11ce600, 0x11d0600, 0x11d2600, 0x11d4600, 0x11d6600, 0x11d8600,
+  0x11da600, 0x11dc600, 0x11de600, 0x11e0600, 0x11e2600, 0x11e4600,
+  0x11e6600, 0x11e8600, 0x11ea600, 0x11ec600, 0x11ee600, 0x11f0600,
+  0x11f2600, 0x11f4600, 0x11f6600, 0x11f8600, 0x11fa600, 0x11fc600,
+  0x11fe600, 0x1200600, 0x1202600, 0x1204600, 0x1206600, 0x1208600,
+  0x120a600, 0x120c600, 0x120e600, 0x1210600, 0x1212600, 0x1214600,
+  0x1216600, 0x1218600, 0x121a600, 0x121c600, 0x121e600, 0x1220600,
+  0x1222600, 0x1224600, 0x1226600, 0x1228600, 0x122a600, 0x122c600,
+  0x122e600, 0x1230600, 0x1232600, 0x1234600, 0x1236600, 0x1238600,
+  0x123a600, 0x123c600, 0x123e600, 0x1240600, 0x1242600, 0x1244600,
+  0x1246600, 0x1248600, 0x124a600, 0x124c600, 0x124e600, 0x1250600,
+  0x1252600, 0x1254600, 0x1256600, 0x1258600, 0x125a600, 0x125c600,
+  0x125e600, 0x1260600, 0x1262600, 0x1264600, 0x1266600, 0x1268600,
+  0x126a600, 0x126c600, 0x126e600, 0x1270600, 0x1272600, 0x1274600,
+  0x1276600, 0x1278600, 0x127a600, 0x127c600, 0x127e600, 0x1280600,
+  0x1282600, 0x1284600, 0x1286600, 0x1288600, 0x128a600, 0x128c600,
+  0x128e600, 0x1290600, 0x1292600, 0x1294600, 0x1296600, 0x1298600,
+  0x129a600, 0x129c600, 0x129e600, 0x12a0600, 0x12a2600, 0x12a4600,
+  0x12a6600, 0x12a8600, 0x12aa600, 0x12ac600, 0x12ae600, 0x12b0600,
+  0x12b2600, 0x12b4600, 0x12b6600, 0x12b8600, 0x12ba600, 0x12bc600,
+  0x12be600, 0x12c0600, 0x12c2600, 0x12c4600, 0x12c6600, 0x12c8600,
+  0x12ca600, 0x12cc600, 0x12ce600, 0x12d0600, 0x12d2600, 0x12d4600,
+  0x12d6600, 0x12d8600, 0x12da600, 0x12dc600, 0x12de600, 0x12e0600,
+  0x12e2600, 0x12e4600, 0x12e6600, 0x12e8600, 0x12ea600, 0x12ec600,
+  0x12ee600, 0x12f0600, 0x12f2600, 0x12f4600, 0x12f6600, 0x12f8600,
+  0x12fa600, 0x12fc600, 0x12fe600, 0x1300600, 0x1302600, 0x1304600,
+  0x1306600, 0x1308600, 0x130a600, 0x130c600, 0x130e600, 0x1310600,
+  0x1312600, 0x1314600, 0x1316600, 0x1318600, 0x131a600, 0x131c600,
+  0x131e600, 0x1320600, 0x1322600, 0x1324600, 0x1326600, 0x1328600,
+  0x132a600, 0x132c600, 0x132e600, 0x1330600, 0x1332600, 0x1334600,
+  0x1336600, 0x1338600, 0x133a600, 0x133c600, 0x133e600, 0x1340600,
+  0x1342600, 0x1344600, 0x1346600, 0x1348600, 0x134a600, 0x134c600,
+  0x134e600, 0x1350600, 0x1352600, 0x1354600, 0x1356600, 0x1358600,
+  0x135a600, 0x135c600, 0x135e600, 0x1360600, 0x1362600, 0x1364600,
+  0x1366600, 0x1368600, 0x136a600, 0x136c600, 0x136e600, 0x1370600,
+  0x1372600, 0x1374600, 0x1376600, 0x1378600, 0x137a600, 0x137c600,
+  0x137e600, 0x1380600, 0x1382600, 0x1384600, 0x1386600, 0x1388600,
+  0x138a600, 0x138c600, 0x138e600, 0x1390600, 0x1392600, 0x1394600,
+  0x1396600, 0x1398600, 0x139a600, 0x139c600, 0x139e600, 0x13a0600,
+  0x13a2600, 0x13a4600, 0x13a6600, 0x13a8600, 0x13aa600, 0x13ac600,
+  0x13ae600, 0x13b0600, 0x13b2600, 0x13b4600, 0x13b6600, 0x13b8600,
+  0x13ba600, 0x13bc600, 0x13be600, 0x13c0600, 0x13c2600, 0x13c4600,
+  0x13c6600, 0x13c8600, 0x13ca600, 0x13cc600, 0x13ce600, 0x13d0600,
+  0x13d2600, 0x13d4600, 0x13d6600, 0x13d8600, 0x13da600, 0x13dc600,
+  0x13de600, 0x13e0600, 0x13e2600, 0x13e4600, 0x13e6600, 0x13e8600,
+  0x13ea600, 0x13ec600, 0x13ee600, 0x13f0600, 0x13f2600, 0x13f4600,
+  0x13f6600, 0x13f8600, 0x13fa600, 0x13fc600, 0x13fe600, 0x1400600,
+  0x1402600, 0x1404600, 0x1406600, 0x1408600, 0x140a600, 0x140c600,
+  0x140e600, 0x1410600, 0x1412600, 0x1414600, 0x1416600, 0x1418600,
+  0x141a600, 0x141c600, 0x141e600, 0x1420600, 0x1422600, 0x1424600,
+  0x1426600, 0x1428600, 0x142a600, 0x142c600, 0x142e600, 0x1430600,
+  0x1432600, 0x1434600, 0x1436600, 0x1438600, 0x143a600, 0x143c600,
+  0x143e600, 0x1440600, 0x1442600, 0x1444600, 0x1446600, 0x1448600,
+  0x144a600, 0x144c600, 0x144e600, 0x1450600, 0x1452600, 0x1454600,
+  0x1456600, 0x1458600, 0x145a600, 0x145c600, 0x145e600, 0x1460600,
+  0x1462600, 0x1464600, 0x1466600, 0x1468600, 0x146a600, 0x146c600,
+  0x146e600, 0x1470600, 0x1472600, 0x1474600, 0x1476600, 0x1478600,
+  0x147a600, 0x147c600, 0x147e600, 0x1480600, 0x1482600, 0x1484600,
+  0x1486600, 0x1488600, 0x148a600, 0x148c600, 0x148e600, 0x1490600,
+  0x1492600, 0x1494600, 0x1496600, 0x1498600, 0x149a600, 0x149c600,
+  0x149e600, 0x14a0600, 0x14a2600, 0x14a4600, 0x14a6600, 0x14a8600,
+  0x14aa600, 0x14ac600, 0x14ae600, 0x14b0600, 0x14b2600, 0x14b4600,
+  0x14b6600, 0x14b8600, 0x14ba600, 0x14bc600, 0x14be600, 0x14c0600,
+  0x14c2600, 0x14c4600, 0x14c6600, 0x14c8a00, 0x1a, 0x14cca00,
+  0x14d0a00, 0x14d4a00, 0x14d8e00, 0x14dee00, 0x14e4a00, 0x14e8a00,
+  0x14eca00, 0x14f0a00, 0x14f4a00, 0x14f8a00, 0x14fca00, 0x1500a00,
+  0x1504a00, 0x1508a00, 0x150ca00, 0x1510a00, 0x1514a00, 0x1518a00,
+  0x151ca00, 0x1520a00, 0x1524a00, 0x1528a00, 0x152ca00, 0x1530a00,
+  0x1534a00, 0x1538a00, 0x153ca00, 0x1540a00, 0x1544a00, 0x1548a00,
+  0x154ca00, 0x1550a00, 0x1554800, 0x1558800, 0x155c800, 0x1560800,
+  0x1564800, 0x1568800, 0x156c800, 0x1570800, 0x1574800, 0x1578800,
+  0x157c800, 0x1580800, 0x1584800, 0x6, 0x1588a00, 0x158ca00,
+  0x1590e00, 0x1596e00, 0x159ce00, 0x15a2e00, 0x15a8e00, 0xe2,
+  0x15aea00, 0x15b2a00, 0x15b6e00, 0x15bce00, 0x15c2e00, 0x15c8e00,
+  0x15ce600, 0x15d0600, 0x15d2600, 0x15d4600, 0x15d6600, 0x15d8600,
+  0x15da600, 0x15dc600, 0x15de600, 0x15e0600, 0x15e2600, 0x15e4600,
+  0x15e6600, 0x15e8600, 0x15ea600, 0x15ec600, 0x15ee600, 0x15f0600,
+  0x15f2600, 0x15f4600, 0x15f6600, 0x15f8600, 0x15fa600, 0x15fc600,
+  0x15fe600, 0x1600600, 0x1602600, 0x1604600, 0x1606600, 0x1608600,
+  0x160a600, 0x160c600, 0x160e600, 0x1610600, 0x1612600, 0x1614600,
+  0x1616600, 0x1618600, 0x161a600, 0x161c600, 0x161e600, 0x1620600,
+  0x1622600, 0x1624600, 0x1626600, 0x1628600, 0x162a600, 0x162c600,
+  0x162e600, 0x1630600, 0x1632600, 0x1634600, 0x1636600, 0x1638600,
+  0x163a600, 0x163c600, 0x163e600, 0x1640600, 0x1642600, 0x1644600,
+  0x1646600, 0x1648600, 0x164a600, 0x164c600, 0x164e600, 0x1650600,
+  0x1652600, 0x1654600, 0x1656600, 0x1658600, 0x165a600, 0x165c600,
+  0x165e600, 0x1660600, 0x1662600, 0x1664600, 0x1666600, 0x1668600,
+  0x166a600, 0x166c600, 0x166e600, 0x1670600, 0x1672600, 0x1674600,
+  0x1676600, 0x1678600, 0x167a600, 0x167c600, 0x167e600, 0x1680600,
+  0x1682600, 0x1684600, 0x1686600, 0x1688600, 0x168a600, 0x168c600,
+  0x168e600, 0x1690600, 0x1692600, 0x1694600, 0x1696600, 0x1698600,
+  0x169a600, 0x169c600, 0x169e600, 0x16a0600, 0x16a2600, 0x16a4600,
+  0x16a6600, 0x16a8600, 0x16aa600, 0x16ac600, 0x16ae600, 0x16b0600,
+  0x16b2600, 0x16b4600, 0x16b6600, 0x16b8600, 0x16ba600, 0x16bc600,
+  0x16be600, 0x16c0600, 0x16c2600, 0x16c4600, 0x16c6600, 0x16c8600,
+  0x16ca600, 0x16cc600, 0x16ce600, 0x16d0600, 0x16d2600, 0x16d4600,
+  0x16d6600, 0x16d8600, 0x16da600, 0x16dc600, 0x16de600, 0x16e0600,
+  0x16e2600, 0x16e4600, 0x16e6600, 0x16e8600, 0x16ea600, 0x16ec600,
+  0x16ee600, 0x16f0600, 0x16f2600, 0x16f4600, 0x16f6600, 0x16f8600,
+  0x16fa600, 0x16fc600, 0x16fe600, 0x1700600, 0x1702600, 0x1704600,
+  0x1706600, 0x1708600, 0x170a600, 0x170c600, 0x170e600, 0x1710600,
+  0x1712600, 0x1714600, 0x1716600, 0x1718600, 0x171a600, 0x171c600,
+  0x171e600, 0x1720600, 0x1722600, 0x1724600, 0x1726600, 0x1728600,
+  0x172a600, 0x172c600, 0x172e600, 0x1730600, 0x1732600, 0x1734600,
+  0x1736600, 0x1738600, 0x173a600, 0x173c600, 0x173e600, 0x1740600,
+  0x1742600, 0x1744600, 0x1746600, 0x1748600, 0x174a600, 0x174c600,
+  0x174e600, 0x1750600, 0x1752600, 0x1754600, 0x1756600, 0x1758600,
+  0x175a600, 0x175c600, 0x175e600, 0x1760600, 0x1762600, 0x1764600,
+  0x1766600, 0x1768600, 0x176a600, 0x176c600, 0x176e600, 0x1770600,
+  0x1772600, 0x1774600, 0x1776600, 0x1778600, 0x177a600, 0x177c600,
+  0x177e600, 0x1780600, 0x1782600, 0x1784600, 0x1786600, 0x1788600,
+  0x178a600, 0x178c600, 0x178e600, 0x1790600, 0x1792600, 0x1794600,
+  0x1796600, 0x1798600, 0x179a600, 0x179c600, 0x179e600, 0x17a0600,
+  0x17a2600, 0x17a4600, 0x17a6600, 0x17a8600, 0x17aa600, 0x17ac600,
+  0x17ae600, 0x17b0600, 0x17b2600, 0x17b4600, 0x17b6600, 0x17b8600,
+  0x17ba600, 0x17bc600, 0x17be600, 0x17c0600, 0x17c2600, 0x17c4600,
+  0x17c6600, 0x17c8600, 0x17ca600, 0x17cc600, 0x17ce600, 0x17d0600,
+  0x17d2600, 0x17d4600, 0x17d6600, 0x17d8600, 0x17da600, 0x17dc600,
+  0x17de600, 0x17e0600, 0x17e2600, 0x17e4600, 0x17e6600, 0x17e8600,
+  0x17ea600, 0x17ec600, 0x17ee600, 0x17f0600, 0x17f2600, 0x17f4600,
+  0x17f6600, 0x17f8600, 0x17fa600, 0x17fc600, 0x17fe600, 0x1800600,
+  0x1802600, 0x1804600, 0x1806600, 0x1808600, 0x180a600, 0x180c600,
+  0x180e600, 0x1810600, 0x1812600, 0x1814600, 0x1816600, 0x1818600,
+  0x181a600, 0x181c600, 0x181e600, 0x1820600, 0x1822600, 0x1824600,
+  0x1826600, 0x1828600, 0x182a600, 0x182c600, 0x182e600, 0x1830600,
+  0x1832600, 0x1834600, 0x1836600, 0x1838600, 0x183a600, 0x183c600,
+  0x183e600, 0x1840600, 0x1842600, 0x1844600, 0x1846600, 0x1848600,
+  0x184a600, 0x184c600, 0x184e600, 0x1850600, 0x1852600, 0x1854600,
+  0x1856600, 0x1858600, 0x185a600, 0x185c600, 0x185e600, 0x1860600,
+  0x1862600, 0x1864600, 0x1866600, 0x1868600, 0x186a600, 0x186c600,
+  0x186e600, 0x1870600, 0x1872600, 0x1874600, 0x1876600, 0x1878600,
+  0x187a600, 0x187c600, 0x187e600, 0x1880600, 0x1882600, 0x1884600,
+  0x1886600, 0x1888600, 0x188a600, 0x188c600, 0x188e600, 0x1890600,
+  0x1892600, 0x1894600, 0x1896600, 0x1898600, 0x189a600, 0x189c600,
+  0x189e600, 0x18a0600, 0x18a2600, 0x18a4600, 0x18a6600, 0x18a8600,
+  0x18aa600, 0x18ac600, 0x18ae600, 0x18b0600, 0x18b2600, 0x18b4600,
+  0x18b6600, 0x18b8600, 0x18ba600, 0x18bc600, 0x18be600, 0x18c0600,
+  0x18c2600, 0x18c4600, 0x18c6600, 0x18c8600, 0x18ca600, 0x18cc600,
+  0x18ce600, 0x18d0600, 0x18d2600, 0x18d4600, 0x18d6600, 0x18d8600,
+  0x18da600, 0x18dc600, 0x18de600, 0x18e0600, 0x18e2600, 0x18e4600,
+  0x18e6600, 0x18e8600, 0x18ea600, 0x18ec600, 0x18ee600, 0x18f0600,
+  0x18f2600, 0x18f4600, 0x18f6600, 0x18f8600, 0x18fa600, 0x18fc600,
+  0x18fe600, 0x1900600, 0x1902600, 0x1904600, 0x1906600, 0x1908600,
+  0x190a600, 0x190c600, 0x190e600, 0x1910600, 0x1912600, 0x1914600,
+  0x1916600, 0x1918600, 0x191a600, 0x191c600, 0x191e600, 0x1920600,
+  0x1922600, 0x1924600, 0x1926600, 0x1928600, 0x192a600, 0x192c600,
+  0x192e600, 0x1930600, 0x1932600, 0x1934600, 0x1936600, 0x1938600,
+  0x193a600, 0x193c600, 0x193e600, 0x1940600, 0x1942600, 0x1944600,
+  0x1946600, 0x1948600, 0x194a600, 0x194c600, 0x194e600, 0x1950600,
+  0x1952600, 0x1954600, 0x1956600, 0x1958600, 0x195a600, 0x195c600,
+  0x195e600, 0x1960600, 0x1962600, 0x1964600, 0x1966600, 0x1968600,
+  0x196a600, 0x196c600, 0x196e600, 0x1970600, 0x1972600, 0x1974600,
+  0x1976600, 0x1978600, 0x197a600, 0x197c600, 0x197e600, 0x1980600,
+  0x1982600, 0x1984600, 0x1986600,
+};
+
+static const uint32_t swNfcDecompositions[3268] = {
+  0x41, 0x300, 0x41, 0x301, 0x41, 0x302, 0x41, 0x303,
+  0x41, 0x308, 0x41, 0x30a, 0x43, 0x327, 0x45, 0x300,
+  0x45, 0x301, 0x45, 0x302, 0x45, 0x308, 0x49, 0x300,
+  0x49, 0x301, 0x49, 0x302, 0x49, 0x308, 0x4e, 0x303,
+  0x4f, 0x300, 0x4f, 0x301, 0x4f, 0x302, 0x4f, 0x303,
+  0x4f, 0x308, 0x55, 0x300, 0x55, 0x301, 0x55, 0x302,
+  0x55, 0x308, 0x59, 0x301, 0x61, 0x300, 0x61, 0x301,
+  0x61, 0x302, 0x61, 0x303, 0x61, 0x308, 0x61, 0x30a,
+  0x63, 0x327, 0x65, 0x300, 0x65, 0x301, 0x65, 0x302,
+  0x65, 0x308, 0x69, 0x300, 0x69, 0x301, 0x69, 0x302,
+  0x69, 0x308, 0x6e, 0x303, 0x6f, 0x300, 0x6f, 0x301,
+  0x6f, 0x302, 0x6f, 0x303, 0x6f, 0x308, 0x75, 0x300,
+  0x75, 0x301, 0x75, 0x302, 0x75, 0x308, 0x79, 0x301,
+  0x79, 0x308, 0x41, 0x304, 0x61, 0x304, 0x41, 0x306,
+  0x61, 0x306, 0x41, 0x328, 0x61, 0x328, 0x43, 0x301,
+  0x63, 0x301, 0x43, 0x302, 0x63, 0x302, 0x43, 0x307,
+  0x63, 0x307, 0x43, 0x30c, 0x63, 0x30c, 0x44, 0x30c,
+  0x64, 0x30c, 0x45, 0x304, 0x65, 0x304, 0x45, 0x306,
+  0x65, 0x306, 0x45, 0x307, 0x65, 0x307, 0x45, 0x328,
+  0x65, 0x328, 0x45, 0x30c, 0x65, 0x30c, 0x47, 0x302,
+  0x67, 0x302, 0x47, 0x306, 0x67, 0x306, 0x47, 0x307,
+  0x67, 0x307, 0x47, 0x327, 0x67, 0x327, 0x48, 0x302,
+  0x68, 0x302, 0x49, 0x303, 0x69, 0x303, 0x49, 0x304,
+  0x69, 0x304, 0x49, 0x306, 0x69, 0x306, 0x49, 0x328,
+  0x69, 0x328, 0x49, 0x307, 0x4a, 0x302, 0x6a, 0x302,
+  0x4b, 0x327, 0x6b, 0x327, 0x4c, 0x301, 0x6c, 0x301,
+  0x4c, 0x327, 0x6c, 0x327, 0x4c, 0x30c, 0x6c, 0x30c,
+  0x4e, 0x301, 0x6e, 0x301, 0x4e, 0x327, 0x6e, 0x327,
+  0x4e, 0x30c, 0x6e, 0x30c, 0x4f, 0x304, 0x6f, 0x304,
+  0x4f, 0x306, 0x6f, 0x306, 0x4f, 0x30b, 0x6f, 0x30b,
+  0x52, 0x301, 0x72, 0x301, 0x52, 0x327, 0x72, 0x327,
+  0x52, 0x30c, 0x72, 0x30c, 0x53, 0x301, 0x73, 0x301,
+  0x53, 0x302, 0x73, 0x302, 0x53, 0x327, 0x73, 0x327,
+  0x53, 0x30c, 0x73, 0x30c, 0x54, 0x327, 0x74, 0x327,
+  0x54, 0x30c, 0x74, 0x30c, 0x55, 0x303, 0x75, 0x303,
+  0x55, 0x304, 0x75, 0x304, 0x55, 0x306, 0x75, 0x306,
+  0x55, 0x30a, 0x75, 0x30a, 0x55, 0x30b, 0x75, 0x30b,
+  0x55, 0x328, 0x75, 0x328, 0x57, 0x302, 0x77, 0x302,
+  0x59, 0x302, 0x79, 0x302, 0x59, 0x308, 0x5a, 0x301,
+  0x7a, 0x301, 0x5a, 0x307, 0x7a, 0x307, 0x5a, 0x30c,
+  0x7a, 0x30c, 0x4f, 0x31b, 0x6f, 0x31b, 0x55, 0x31b,
+  0x75, 0x31b, 0x41, 0x30c, 0x61, 0x30c, 0x49, 0x30c,
+  0x69, 0x30c, 0x4f, 0x30c, 0x6f, 0x30c, 0x55, 0x30c,
+  0x75, 0x30c, 0x55, 0x308, 0x304, 0x75, 0x308, 0x304,
+  0x55, 0x308, 0x301, 0x75, 0x308, 0x301, 0x55, 0x308,
+  0x30c, 0x75, 0x308, 0x30c, 0x55, 0x308, 0x300, 0x75,
+  0x308, 0x300, 0x41, 0x308, 0x304, 0x61, 0x308, 0x304,
+  0x41, 0x307, 0x304, 0x61, 0x307, 0x304, 0xc6, 0x304,
+  0xe6, 0x304, 0x47, 0x30c, 0x67, 0x30c, 0x4b, 0x30c,
+  0x6b, 0x30c, 0x4f, 0x328, 0x6f, 0x328, 0x4f, 0x328,
+  0x304, 0x6f, 0x328, 0x304, 0x1b7, 0x30c, 0x292, 0x30c,
+  0x6a, 0x30c, 0x47, 0x301, 0x67, 0x301, 0x4e, 0x300,
+  0x6e, 0x300, 0x41, 0x30a, 0x301, 0x61, 0x30a, 0x301,
+  0xc6, 0x301, 0xe6, 0x301, 0xd8, 0x301, 0xf8, 0x301,
+  0x41, 0x30f, 0x61, 0x30f, 0x41, 0x311, 0x61, 0x311,
+  0x45, 0x30f, 0x65, 0x30f, 0x45, 0x311, 0x65, 0x311,
+  0x49, 0x30f, 0x69, 0x30f, 0x49, 0x311, 0x69, 0x311,
+  0x4f, 0x30f, 0x6f, 0x30f, 0x4f, 0x311, 0x6f, 0x311,
+  0x52, 0x30f, 0x72, 0x30f, 0x52, 0x311, 0x72, 0x311,
+  0x55, 0x30f, 0x75, 0x30f, 0x55, 0x311, 0x75, 0x311,
+  0x53, 0x326, 0x73, 0x326, 0x54, 0x326, 0x74, 0x326,
+  0x48, 0x30c, 0x68, 0x30c, 0x41, 0x307, 0x61, 0x307,
+  0x45, 0x327, 0x65, 0x327, 0x4f, 0x308, 0x304, 0x6f,
+  0x308, 0x304, 0x4f, 0x303, 0x304, 0x6f, 0x303, 0x304,
+  0x4f, 0x307, 0x6f, 0x307, 0x4f, 0x307, 0x304, 0x6f,
+  0x307, 0x304, 0x59, 0x304, 0x79, 0x304, 0x300, 0x301,
+  0x313, 0x308, 0x301, 0x2b9, 0x3b, 0xa8, 0x301, 0x391,
+  0x301, 0xb7, 0x395, 0x301, 0x397, 0x301, 0x399, 0x301,
+  0x39f, 0x301, 0x3a5, 0x301, 0x3a9, 0x301, 0x3b9, 0x308,
+  0x301, 0x399, 0x308, 0x3a5, 0x308, 0x3b1, 0x301, 0x3b5,
+  0x301, 0x3b7, 0x301, 0x3b9, 0x301, 0x3c5, 0x308, 0x301,
+  0x3b9, 0x308, 0x3c5, 0x308, 0x3bf, 0x301, 0x3c5, 0x301,
+  0x3c9, 0x301, 0x3d2, 0x301, 0x3d2, 0x308, 0x415, 0x300,
+  0x415, 0x308, 0x413, 0x301, 0x406, 0x308, 0x41a, 0x301,
+  0x418, 0x300, 0x423, 0x306, 0x418, 0x306, 0x438, 0x306,
+  0x435, 0x300, 0x435, 0x308, 0x433, 0x301, 0x456, 0x308,
+  0x43a, 0x301, 0x438, 0x300, 0x443, 0x306, 0x474, 0x30f,
+  0x475, 0x30f, 0x416, 0x306, 0x436, 0x306, 0x410, 0x306,
+  0x430, 0x306, 0x410, 0x308, 0x430, 0x308, 0x415, 0x306,
+  0x435, 0x306, 0x4d8, 0x308, 0x4d9, 0x308, 0x416, 0x308,
+  0x436, 0x308, 0x417, 0x308, 0x437, 0x308, 0x418, 0x304,
+  0x438, 0x304, 0x418, 0x308, 0x438, 0x308, 0x41e, 0x308,
+  0x43e, 0x308, 0x4e8, 0x308, 0x4e9, 0x308, 0x42d, 0x308,
+  0x44d, 0x308, 0x423, 0x304, 0x443, 0x304, 0x423, 0x308,
+  0x443, 0x308, 0x423, 0x30b, 0x443, 0x30b, 0x427, 0x308,
+  0x447, 0x308, 0x42b, 0x308, 0x44b, 0x308, 0x627, 0x653,
+  0x627, 0x654, 0x648, 0x654, 0x627, 0x655, 0x64a, 0x654,
+  0x6d5, 0x654, 0x6c1, 0x654, 0x6d2, 0x654, 0x928, 0x93c,
+  0x930, 0x93c, 0x933, 0x93c, 0x915, 0x93c, 0x916, 0x93c,
+  0x917, 0x93c, 0x91c, 0x93c, 0x921, 0x93c, 0x922, 0x93c,
+  0x92b, 0x93c, 0x92f, 0x93c, 0x9c7, 0x9be, 0x9c7, 0x9d7,
+  0x9a1, 0x9bc, 0x9a2, 0x9bc, 0x9af, 0x9bc, 0xa32, 0xa3c,
+  0xa38, 0xa3c, 0xa16, 0xa3c, 0xa17, 0xa3c, 0xa1c, 0xa3c,
+  0xa2b, 0xa3c, 0xb47, 0xb56, 0xb47, 0xb3e, 0xb47, 0xb57,
+  0xb21, 0xb3c, 0xb22, 0xb3c, 0xb92, 0xbd7, 0xbc6, 0xbbe,
+  0xbc7, 0xbbe, 0xbc6, 0xbd7, 0xc46, 0xc56, 0xcbf, 0xcd5,
+  0xcc6, 0xcd5, 0xcc6, 0xcd6, 0xcc6, 0xcc2, 0xcc6, 0xcc2,
+  0xcd5, 0xd46, 0xd3e, 0xd47, 0xd3e, 0xd46, 0xd57, 0xdd9,
+  0xdca, 0xdd9, 0xdcf, 0xdd9, 0xdcf, 0xdca, 0xdd9, 0xddf,
+  0xf42, 0xfb7, 0xf4c, 0xfb7, 0xf51, 0xfb7, 0xf56, 0xfb7,
+  0xf5b, 0xfb7, 0xf40, 0xfb5, 0xf71, 0xf72, 0xf71, 0xf74,
+  0xfb2, 0xf80, 0xfb3, 0xf80, 0xf71, 0xf80, 0xf92, 0xfb7,
+  0xf9c, 0xfb7, 0xfa1, 0xfb7, 0xfa6, 0xfb7, 0xfab, 0xfb7,
+  0xf90, 0xfb5, 0x1025, 0x102e, 0x1b05, 0x1b35, 0x1b07, 0x1b35,
+  0x1b09, 0x1b35, 0x1b0b, 0x1b35, 0x1b0d, 0x1b35, 0x1b11, 0x1b35,
+  0x1b3a, 0x1b35, 0x1b3c, 0x1b35, 0x1b3e, 0x1b35, 0x1b3f, 0x1b35,
+  0x1b42, 0x1b35, 0x41, 0x325, 0x61, 0x325, 0x42, 0x307,
+  0x62, 0x307, 0x42, 0x323, 0x62, 0x323, 0x42, 0x331,
+  0x62, 0x331, 0x43, 0x327, 0x301, 0x63, 0x327, 0x301,
+  0x44, 0x307, 0x64, 0x307, 0x44, 0x323, 0x64, 0x323,
+  0x44, 0x331, 0x64, 0x331, 0x44, 0x327, 0x64, 0x327,
+  0x44, 0x32d, 0x64, 0x32d, 0x45, 0x304, 0x300, 0x65,
+  0x304, 0x300, 0x45, 0x304, 0x301, 0x65, 0x304, 0x301,
+  0x45, 0x32d, 0x65, 0x32d, 0x45, 0x330, 0x65, 0x330,
+  0x45, 0x327, 0x306, 0x65, 0x327, 0x306, 0x46, 0x307,
+  0x66, 0x307, 0x47, 0x304, 0x67, 0x304, 0x48, 0x307,
+  0x68, 0x307, 0x48, 0x323, 0x68, 0x323, 0x48, 0x308,
+  0x68, 0x308, 0x48, 0x327, 0x68, 0x327, 0x48, 0x32e,
+  0x68, 0x32e, 0x49, 0x330, 0x69, 0x330, 0x49, 0x308,
+  0x301, 0x69, 0x308, 0x301, 0x4b, 0x301, 0x6b, 0x301,
+  0x4b, 0x323, 0x6b, 0x323, 0x4b, 0x331, 0x6b, 0x331,
+  0x4c, 0x323, 0x6c, 0x323, 0x4c, 0x323, 0x304, 0x6c,
+  0x323, 0x304, 0x4c, 0x331, 0x6c, 0x331, 0x4c, 0x32d,
+  0x6c, 0x32d, 0x4d, 0x301, 0x6d, 0x301, 0x4d, 0x307,
+  0x6d, 0x307, 0x4d, 0x323, 0x6d, 0x323, 0x4e, 0x307,
+  0x6e, 0x307, 0x4e, 0x323, 0x6e, 0x323, 0x4e, 0x331,
+  0x6e, 0x331, 0x4e, 0x32d, 0x6e, 0x32d, 0x4f, 0x303,
+  0x301, 0x6f, 0x303, 0x301, 0x4f, 0x303, 0x308, 0x6f,
+  0x303, 0x308, 0x4f, 0x304, 0x300, 0x6f, 0x304, 0x300,
+  0x4f, 0x304, 0x301, 0x6f, 0x304, 0x301, 0x50, 0x301,
+  0x70, 0x301, 0x50, 0x307, 0x70, 0x307, 0x52, 0x307,
+  0x72, 0x307, 0x52, 0x323, 0x72, 0x323, 0x52, 0x323,
+  0x304, 0x72, 0x323, 0x304, 0x52, 0x331, 0x72, 0x331,
+  0x53, 0x307, 0x73, 0x307, 0x53, 0x323, 0x73, 0x323,
+  0x53, 0x301, 0x307, 0x73, 0x301, 0x307, 0x53, 0x30c,
+  0x307, 0x73, 0x30c, 0x307, 0x53, 0x323, 0x307, 0x73,
+  0x323, 0x307, 0x54, 0x307, 0x74, 0x307, 0x54, 0x323,
+  0x74, 0x323, 0x54, 0x331, 0x74, 0x331, 0x54, 0x32d,
+  0x74, 0x32d, 0x55, 0x324, 0x75, 0x324, 0x55, 0x330,
+  0x75, 0x330, 0x55, 0x32d, 0x75, 0x32d, 0x55, 0x303,
+  0x301, 0x75, 0x303, 0x301, 0x55, 0x304, 0x308, 0x75,
+  0x304, 0x308, 0x56, 0x303, 0x76, 0x303, 0x56, 0x323,
+  0x76, 0x323, 0x57, 0x300, 0x77, 0x300, 0x57, 0x301,
+  0x77, 0x301, 0x57, 0x308, 0x77, 0x308, 0x57, 0x307,
+  0x77, 0x307, 0x57, 0x323, 0x77, 0x323, 0x58, 0x307,
+  0x78, 0x307, 0x58, 0x308, 0x78, 0x308, 0x59, 0x307,
+  0x79, 0x307, 0x5a, 0x302, 0x7a, 0x302, 0x5a, 0x323,
+  0x7a, 0x323, 0x5a, 0x331, 0x7a, 0x331, 0x68, 0x331,
+  0x74, 0x308, 0x77, 0x30a, 0x79, 0x30a, 0x17f, 0x307,
+  0x41, 0x323, 0x61, 0x323, 0x41, 0x309, 0x61, 0x309,
+  0x41, 0x302, 0x301, 0x61, 0x302, 0x301, 0x41, 0x302,
+  0x300, 0x61, 0x302, 0x300, 0x41, 0x302, 0x309, 0x61,
+  0x302, 0x309, 0x41, 0x302, 0x303, 0x61, 0x302, 0x303,
+  0x41, 0x323, 0x302, 0x61, 0x323, 0x302, 0x41, 0x306,
+  0x301, 0x61, 0x306, 0x301, 0x41, 0x306, 0x300, 0x61,
+  0x306, 0x300, 0x41, 0x306, 0x309, 0x61, 0x306, 0x309,
+  0x41, 0x306, 0x303, 0x61, 0x306, 0x303, 0x41, 0x323,
+  0x306, 0x61, 0x323, 0x306, 0x45, 0x323, 0x65, 0x323,
+  0x45, 0x309, 0x65, 0x309, 0x45, 0x303, 0x65, 0x303,
+  0x45, 0x302, 0x301, 0x65, 0x302, 0x301, 0x45, 0x302,
+  0x300, 0x65, 0x302, 0x300, 0x45, 0x302, 0x309, 0x65,
+  0x302, 0x309, 0x45, 0x302, 0x303, 0x65, 0x302, 0x303,
+  0x45, 0x323, 0x302, 0x65, 0x323, 0x302, 0x49, 0x309,
+  0x69, 0x309, 0x49, 0x323, 0x69, 0x323, 0x4f, 0x323,
+  0x6f, 0x323, 0x4f, 0x309, 0x6f, 0x309, 0x4f, 0x302,
+  0x301, 0x6f, 0x302, 0x301, 0x4f, 0x302, 0x300, 0x6f,
+  0x302, 0x300, 0x4f, 0x302, 0x309, 0x6f, 0x302, 0x309,
+  0x4f, 0x302, 0x303, 0x6f, 0x302, 0x303, 0x4f, 0x323,
+  0x302, 0x6f, 0x323, 0x302, 0x4f, 0x31b, 0x301, 0x6f,
+  0x31b, 0x301, 0x4f, 0x31b, 0x300, 0x6f, 0x31b, 0x300,
+  0x4f, 0x31b, 0x309, 0x6f, 0x31b, 0x309, 0x4f, 0x31b,
+  0x303, 0x6f, 0x31b, 0x303, 0x4f, 0x31b, 0x323, 0x6f,
+  0x31b, 0x323, 0x55, 0x323, 0x75, 0x323, 0x55, 0x309,
+  0x75, 0x309, 0x55, 0x31b, 0x301, 0x75, 0x31b, 0x301,
+  0x55, 0x31b, 0x300, 0x75, 0x31b, 0x300, 0x55, 0x31b,
+  0x309, 0x75, 0x31b, 0x309, 0x55, 0x31b, 0x303, 0x75,
+  0x31b, 0x303, 0x55, 0x31b, 0x323, 0x75, 0x31b, 0x323,
+  0x59, 0x300, 0x79, 0x300, 0x59, 0x323, 0x79, 0x323,
+  0x59, 0x309, 0x79, 0x309, 0x59, 0x303, 0x79, 0x303,
+  0x3b1, 0x313, 0x3b1, 0x314, 0x3b1, 0x313, 0x300, 0x3b1,
+  0x314, 0x300, 0x3b1, 0x313, 0x301, 0x3b1, 0x314, 0x301,
+  0x3b1, 0x313, 0x342, 0x3b1, 0x314, 0x342, 0x391, 0x313,
+  0x391, 0x314, 0x391, 0x313, 0x300, 0x391, 0x314, 0x300,
+  0x391, 0x313, 0x301, 0x391, 0x314, 0x301, 0x391, 0x313,
+  0x342, 0x391, 0x314, 0x342, 0x3b5, 0x313, 0x3b5, 0x314,
+  0x3b5, 0x313, 0x300, 0x3b5, 0x314, 0x300, 0x3b5, 0x313,
+  0x301, 0x3b5, 0x314, 0x301, 0x395, 0x313, 0x395, 0x314,
+  0x395, 0x313, 0x300, 0x395, 0x314, 0x300, 0x395, 0x313,
+  0x301, 0x395, 0x314, 0x301, 0x3b7, 0x313, 0x3b7, 0x314,
+  0x3b7, 0x313, 0x300, 0x3b7, 0x314, 0x300, 0x3b7, 0x313,
+  0x301, 0x3b7, 0x314, 0x301, 0x3b7, 0x313, 0x342, 0x3b7,
+  0x314, 0x342, 0x397, 0x313, 0x397, 0x314, 0x397, 0x313,
+  0x300, 0x397, 0x314, 0x300, 0x397, 0x313, 0x301, 0x397,
+  0x314, 0x301, 0x397, 0x313, 0x342, 0x397, 0x314, 0x342,
+  0x3b9, 0x313, 0x3b9, 0x314, 0x3b9, 0x313, 0x300, 0x3b9,
+  0x314, 0x300, 0x3b9, 0x313, 0x301, 0x3b9, 0x314, 0x301,
+  0x3b9, 0x313, 0x342, 0x3b9, 0x314, 0x342, 0x399, 0x313,
+  0x399, 0x314, 0x399, 0x313, 0x300, 0x399, 0x314, 0x300,
+  0x399, 0x313, 0x301, 0x399, 0x314, 0x301, 0x399, 0x313,
+  0x342, 0x399, 0x314, 0x342, 0x3bf, 0x313, 0x3bf, 0x314,
+  0x3bf, 0x313, 0x300, 0x3bf, 0x314, 0x300, 0x3bf, 0x313,
+  0x301, 0x3bf, 0x314, 0x301, 0x39f, 0x313, 0x39f, 0x314,
+  0x39f, 0x313, 0x300, 0x39f, 0x314, 0x300, 0x39f, 0x313,
+  0x301, 0x39f, 0x314, 0x301, 0x3c5, 0x313, 0x3c5, 0x314,
+  0x3c5, 0x313, 0x300, 0x3c5, 0x314, 0x300, 0x3c5, 0x313,
+  0x301, 0x3c5, 0x314, 0x301, 0x3c5, 0x313, 0x342, 0x3c5,
+  0x314, 0x342, 0x3a5, 0x314, 0x3a5, 0x314, 0x300, 0x3a5,
+  0x314, 0x301, 0x3a5, 0x314, 0x342, 0x3c9, 0x313, 0x3c9,
+  0x314, 0x3c9, 0x313, 0x300, 0x3c9, 0x314, 0x300, 0x3c9,
+  0x313, 0x301, 0x3c9, 0x314, 0x301, 0x3c9, 0x313, 0x342,
+  0x3c9, 0x314, 0x342, 0x3a9, 0x313, 0x3a9, 0x314, 0x3a9,
+  0x313, 0x300, 0x3a9, 0x314, 0x300, 0x3a9, 0x313, 0x301,
+  0x3a9, 0x314, 0x301, 0x3a9, 0x313, 0x342, 0x3a9, 0x314,
+  0x342, 0x3b1, 0x300, 0x3b5, 0x300, 0x3b7, 0x300, 0x3b9,
+  0x300, 0x3bf, 0x300, 0x3c5, 0x300, 0x3c9, 0x300, 0x3b1,
+  0x313, 0x345, 0x3b1, 0x314, 0x345, 0x3b1, 0x313, 0x300,
+  0x345, 0x3b1, 0x314, 0x300, 0x345, 0x3b1, 0x313, 0x301,
+  0x345, 0x3b1, 0x314, 0x301, 0x345, 0x3b1, 0x313, 0x342,
+  0x345, 0x3b1, 0x314, 0x342, 0x345, 0x391, 0x313, 0x345,
+  0x391, 0x314, 0x345, 0x391, 0x313, 0x300, 0x345, 0x391,
+  0x314, 0x300, 0x345, 0x391, 0x313, 0x301, 0x345, 0x391,
+  0x314, 0x301, 0x345, 0x391, 0x313, 0x342, 0x345, 0x391,
+  0x314, 0x342, 0x345, 0x3b7, 0x313, 0x345, 0x3b7, 0x314,
+  0x345, 0x3b7, 0x313, 0x300, 0x345, 0x3b7, 0x314, 0x300,
+  0x345, 0x3b7, 0x313, 0x301, 0x345, 0x3b7, 0x314, 0x301,
+  0x345, 0x3b7, 0x313, 0x342, 0x345, 0x3b7, 0x314, 0x342,
+  0x345, 0x397, 0x313, 0x345, 0x397, 0x314, 0x345, 0x397,
+  0x313, 0x300, 0x345, 0x397, 0x314, 0x300, 0x345, 0x397,
+  0x313, 0x301, 0x345, 0x397, 0x314, 0x301, 0x345, 0x397,
+  0x313, 0x342, 0x345, 0x397, 0x314, 0x342, 0x345, 0x3c9,
+  0x313, 0x345, 0x3c9, 0x314, 0x345, 0x3c9, 0x313, 0x300,
+  0x345, 0x3c9, 0x314, 0x300, 0x345, 0x3c9, 0x313, 0x301,
+  0x345, 0x3c9, 0x314, 0x301, 0x345, 0x3c9, 0x313, 0x342,
+  0x345, 0x3c9, 0x314, 0x342, 0x345, 0x3a9, 0x313, 0x345,
+  0x3a9, 0x314, 0x345, 0x3a9, 0x313, 0x300, 0x345, 0x3a9,
+  0x314, 0x300, 0x345, 0x3a9, 0x313, 0x301, 0x345, 0x3a9,
+  0x314, 0x301, 0x345, 0x3a9, 0x313, 0x342, 0x345, 0x3a9,
+  0x314, 0x342, 0x345, 0x3b1, 0x306, 0x3b1, 0x304, 0x3b1,
+  0x300, 0x345, 0x3b1, 0x345, 0x3b1, 0x301, 0x345, 0x3b1,
+  0x342, 0x3b1, 0x342, 0x345, 0x391, 0x306, 0x391, 0x304,
+  0x391, 0x300, 0x391, 0x345, 0x3b9, 0xa8, 0x342, 0x3b7,
+  0x300, 0x345, 0x3b7, 0x345, 0x3b7, 0x301, 0x345, 0x3b7,
+  0x342, 0x3b7, 0x342, 0x345, 0x395, 0x300, 0x397, 0x300,
+  0x397, 0x345, 0x1fbf, 0x300, 0x1fbf, 0x301, 0x1fbf, 0x342,
+  0x3b9, 0x306, 0x3b9, 0x304, 0x3b9, 0x308, 0x300, 0x3b9,
+  0x342, 0x3b9, 0x308, 0x342, 0x399, 0x306, 0x399, 0x304,
+  0x399, 0x300, 0x1ffe, 0x300, 0x1ffe, 0x301, 0x1ffe, 0x342,
+  0x3c5, 0x306, 0x3c5, 0x304, 0x3c5, 0x308, 0x300, 0x3c1,
+  0x313, 0x3c1, 0x314, 0x3c5, 0x342, 0x3c5, 0x308, 0x342,
+  0x3a5, 0x306, 0x3a5, 0x304, 0x3a5, 0x300, 0x3a1, 0x314,
+  0xa8, 0x300, 0x60, 0x3c9, 0x300, 0x345, 0x3c9, 0x345,
+  0x3c9, 0x301, 0x345, 0x3c9, 0x342, 0x3c9, 0x342, 0x345,
+  0x39f, 0x300, 0x3a9, 0x300, 0x3a9, 0x345, 0xb4, 0x2002,
+  0x2003, 0x3a9, 0x4b, 0x2190, 0x338, 0x2192, 0x338, 0x2194,
+  0x338, 0x21d0, 0x338, 0x21d4, 0x338, 0x21d2, 0x338, 0x2203,
+  0x338, 0x2208, 0x338, 0x220b, 0x338, 0x2223, 0x338, 0x2225,
+  0x338, 0x223c, 0x338, 0x2243, 0x338, 0x2245, 0x338, 0x2248,
+  0x338, 0x3d, 0x338, 0x2261, 0x338, 0x224d, 0x338, 0x3c,
+  0x338, 0x3e, 0x338, 0x2264, 0x338, 0x2265, 0x338, 0x2272,
+  0x338, 0x2273, 0x338, 0x2276, 0x338, 0x2277, 0x338, 0x227a,
+  0x338, 0x227b, 0x338, 0x2282, 0x338, 0x2283, 0x338, 0x2286,
+  0x338, 0x2287, 0x338, 0x22a2, 0x338, 0x22a8, 0x338, 0x22a9,
+  0x338, 0x22ab, 0x338, 0x227c, 0x338, 0x227d, 0x338, 0x2291,
+  0x338, 0x2292, 0x338, 0x22b2, 0x338, 0x22b3, 0x338, 0x22b4,
+  0x338, 0x22b5, 0x338, 0x3008, 0x3009, 0x2add, 0x338, 0x304b,
+  0x3099, 0x304d, 0x3099, 0x304f, 0x3099, 0x3051, 0x3099, 0x3053,
+  0x3099, 0x3055, 0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305b,
+  0x3099, 0x305d, 0x3099, 0x305f, 0x3099, 0x3061, 0x3099, 0x3064,
+  0x3099, 0x3066, 0x3099, 0x3068, 0x3099, 0x306f, 0x3099, 0x306f,
+  0x309a, 0x3072, 0x3099, 0x3072, 0x309a, 0x3075, 0x3099, 0x3075,
+  0x309a, 0x3078, 0x3099, 0x3078, 0x309a, 0x307b, 0x3099, 0x307b,
+  0x309a, 0x3046, 0x3099, 0x309d, 0x3099, 0x30ab, 0x3099, 0x30ad,
+  0x3099, 0x30af, 0x3099, 0x30b1, 0x3099, 0x30b3, 0x3099, 0x30b5,
+  0x3099, 0x30b7, 0x3099, 0x30b9, 0x3099, 0x30bb, 0x3099, 0x30bd,
+  0x3099, 0x30bf, 0x3099, 0x30c1, 0x3099, 0x30c4, 0x3099, 0x30c6,
+  0x3099, 0x30c8, 0x3099, 0x30cf, 0x3099, 0x30cf, 0x309a, 0x30d2,
+  0x3099, 0x30d2, 0x309a, 0x30d5, 0x3099, 0x30d5, 0x309a, 0x30d8,
+  0x3099, 0x30d8, 0x309a, 0x30db, 0x3099, 0x30db, 0x309a, 0x30a6,
+  0x3099, 0x30ef, 0x3099, 0x30f0, 0x3099, 0x30f1, 0x3099, 0x30f2,
+  0x3099, 0x30fd, 0x3099, 0x8c48, 0x66f4, 0x8eca, 0x8cc8, 0x6ed1,
+  0x4e32, 0x53e5, 0x9f9c, 0x5951, 0x91d1, 0x5587, 0x5948, 0x61f6,
+  0x7669, 0x7f85, 0x863f, 0x87ba, 0x88f8, 0x908f, 0x6a02, 0x6d1b,
+  0x70d9, 0x73de, 0x843d, 0x916a, 0x99f1, 0x4e82, 0x5375, 0x6b04,
+  0x721b, 0x862d, 0x9e1e, 0x5d50, 0x6feb, 0x85cd, 0x8964, 0x62c9,
+  0x81d8, 0x881f, 0x5eca, 0x6717, 0x6d6a, 0x72fc, 0x90ce, 0x4f86,
+  0x51b7, 0x52de, 0x64c4, 0x6ad3, 0x7210, 0x76e7, 0x8001, 0x8606,
+  0x865c, 0x8def, 0x9732, 0x9b6f, 0x9dfa, 0x788c, 0x797f, 0x7da0,
+  0x83c9, 0x9304, 0x9e7f, 0x8ad6, 0x58df, 0x5f04, 0x7c60, 0x807e,
+  0x7262, 0x78ca, 0x8cc2, 0x96f7, 0x58d8, 0x5c62, 0x6a13, 0x6dda,
+  0x6f0f, 0x7d2f, 0x7e37, 0x964b, 0x52d2, 0x808b, 0x51dc, 0x51cc,
+  0x7a1c, 0x7dbe, 0x83f1, 0x9675, 0x8b80, 0x62cf, 0x8afe, 0x4e39,
+  0x5be7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78fb, 0x4fbf, 0x5fa9,
+  0x4e0d, 0x6ccc, 0x6578, 0x7d22, 0x53c3, 0x585e, 0x7701, 0x8449,
+  0x8aaa, 0x6bba, 0x8fb0, 0x6c88, 0x62fe, 0x82e5, 0x63a0, 0x7565,
+  0x4eae, 0x5169, 0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2, 0x91cf,
+  0x52f5, 0x5442, 0x5973, 0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad,
+  0x9a6a, 0x9e97, 0x9ece, 0x529b, 0x66c6, 0x6b77, 0x8f62, 0x5e74,
+  0x6190, 0x6200, 0x649a, 0x6f23, 0x7149, 0x7489, 0x79ca, 0x7df4,
+  0x806f, 0x8f26, 0x84ee, 0x9023, 0x934a, 0x5217, 0x52a3, 0x54bd,
+  0x70c8, 0x88c2, 0x5ec9, 0x5ff5, 0x637b, 0x6bae, 0x7c3e, 0x7375,
+  0x4ee4, 0x56f9, 0x5dba, 0x601c, 0x73b2, 0x7469, 0x7f9a, 0x8046,
+  0x9234, 0x96f6, 0x9748, 0x9818, 0x4f8b, 0x79ae, 0x91b4, 0x96b8,
+  0x60e1, 0x4e86, 0x50da, 0x5bee, 0x5c3f, 0x6599, 0x71ce, 0x7642,
+  0x84fc, 0x907c, 0x9f8d, 0x6688, 0x962e, 0x5289, 0x677b, 0x67f3,
+  0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b, 0x7d10, 0x985e, 0x516d,
+  0x622e, 0x9678, 0x502b, 0x5d19, 0x6dea, 0x8f2a, 0x5f8b, 0x6144,
+  0x6817, 0x9686, 0x5229, 0x540f, 0x5c65, 0x6613, 0x674e, 0x68a8,
+  0x6ce5, 0x7406, 0x75e2, 0x7f79, 0x88cf, 0x88e1, 0x91cc, 0x96e2,
+  0x533f, 0x6eba, 0x541d, 0x71d0, 0x7498, 0x85fa, 0x96a3, 0x9c57,
+  0x9e9f, 0x6797, 0x6dcb, 0x81e8, 0x7acb, 0x7b20, 0x7c92, 0x72c0,
+  0x7099, 0x8b58, 0x4ec0, 0x8336, 0x523a, 0x5207, 0x5ea6, 0x62d3,
+  0x7cd6, 0x5b85, 0x6d1e, 0x66b4, 0x8f3b, 0x884c, 0x964d, 0x898b,
+  0x5ed3, 0x5140, 0x55c0, 0x585a, 0x6674, 0x51de, 0x732a, 0x76ca,
+  0x793c, 0x795e, 0x7965, 0x798f, 0x9756, 0x7cbe, 0x7fbd, 0x8612,
+  0x8af8, 0x9038, 0x90fd, 0x98ef, 0x98fc, 0x9928, 0x9db4, 0x90de,
+  0x96b7, 0x4fae, 0x50e7, 0x514d, 0x52c9, 0x52e4, 0x5351, 0x559d,
+  0x5606, 0x5668, 0x5840, 0x58a8, 0x5c64, 0x5c6e, 0x6094, 0x6168,
+  0x618e, 0x61f2, 0x654f, 0x65e2, 0x6691, 0x6885, 0x6d77, 0x6e1a,
+  0x6f22, 0x716e, 0x722b, 0x7422, 0x7891, 0x793e, 0x7949, 0x7948,
+  0x7950, 0x7956, 0x795d, 0x798d, 0x798e, 0x7a40, 0x7a81, 0x7bc0,
+  0x7e09, 0x7e41, 0x7f72, 0x8005, 0x81ed, 0x8279, 0x8457, 0x8910,
+  0x8996, 0x8b01, 0x8b39, 0x8cd3, 0x8d08, 0x8fb6, 0x96e3, 0x97ff,
+  0x983b, 0x6075, 0x242ee, 0x8218, 0x4e26, 0x51b5, 0x5168, 0x4f80,
+  0x5145, 0x5180, 0x52c7, 0x52fa, 0x5555, 0x5599, 0x55e2, 0x58b3,
+  0x5944, 0x5954, 0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69, 0x5fad,
+  0x60d8, 0x614e, 0x6108, 0x6160, 0x6234, 0x63c4, 0x641c, 0x6452,
+  0x6556, 0x671b, 0x6756, 0x6b79, 0x6edb, 0x6ecb, 0x701e, 0x77a7,
+  0x7235, 0x72af, 0x7471, 0x7506, 0x753b, 0x761d, 0x761f, 0x76db,
+  0x76f4, 0x774a, 0x7740, 0x78cc, 0x7ab1, 0x7c7b, 0x7d5b, 0x7f3e,
+  0x8352, 0x83ef, 0x8779, 0x8941, 0x8986, 0x8abf, 0x8acb, 0x8aed,
+  0x8b8a, 0x8f38, 0x9072, 0x9199, 0x9276, 0x967c, 0x97db, 0x980b,
+  0x9b12, 0x2284a, 0x22844, 0x233d5, 0x3b9d, 0x4018, 0x4039, 0x25249,
+  0x25cd0, 0x27ed3, 0x9f43, 0x9f8e, 0x5d9, 0x5b4, 0x5f2, 0x5b7,
+  0x5e9, 0x5c1, 0x5e9, 0x5c2, 0x5e9, 0x5bc, 0x5c1, 0x5e9,
+  0x5bc, 0x5c2, 0x5d0, 0x5b7, 0x5d0, 0x5b8, 0x5d0, 0x5bc,
+  0x5d1, 0x5bc, 0x5d2, 0x5bc, 0x5d3, 0x5bc, 0x5d4, 0x5bc,
+  0x5d5, 0x5bc, 0x5d6, 0x5bc, 0x5d8, 0x5bc, 0x5d9, 0x5bc,
+  0x5da, 0x5bc, 0x5db, 0x5bc, 0x5dc, 0x5bc, 0x5de, 0x5bc,
+  0x5e0, 0x5bc, 0x5e1, 0x5bc, 0x5e3, 0x5bc, 0x5e4, 0x5bc,
+  0x5e6, 0x5bc, 0x5e7, 0x5bc, 0x5e8, 0x5bc, 0x5e9, 0x5bc,
+  0x5ea, 0x5bc, 0x5d5, 0x5b9, 0x5d1, 0x5bf, 0x5db, 0x5bf,
+  0x5e4, 0x5bf, 0x11099, 0x110ba, 0x1109b, 0x110ba, 0x110a5, 0x110ba,
+  0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133e, 0x11347, 0x11357,
+  0x114b9, 0x114ba, 0x114b9, 0x114b0, 0x114b9, 0x114bd, 0x115b8, 0x115af,
+  0x115b9, 0x115af, 0x11935, 0x11930, 0x1d157, 0x1d165, 0x1d158, 0x1d165,
+  0x1d158, 0x1d165, 0x1d16e, 0x1d158, 0x1d165, 0x1d16f, 0x1d158, 0x1d165,
+  0x1d170, 0x1d158, 0x1d165, 0x1d171, 0x1d158, 0x1d165, 0x1d172, 0x1d1b9,
+  0x1d165, 0x1d1ba, 0x1d165, 0x1d1b9, 0x1d165, 0x1d16e, 0x1d1ba, 0x1d165,
+  0x1d16e, 0x1d1b9, 0x1d165, 0x1d16f, 0x1d1ba, 0x1d165, 0x1d16f, 0x4e3d,
+  0x4e38, 0x4e41, 0x20122, 0x4f60, 0x4fbb, 0x5002, 0x507a, 0x5099,
+  0x50cf, 0x349e, 0x2063a, 0x5154, 0x5164, 0x5177, 0x2051c, 0x34b9,
+  0x5167, 0x518d, 0x2054b, 0x5197, 0x51a4, 0x4ecc, 0x51ac, 0x291df,
+  0x51f5, 0x5203, 0x34df, 0x523b, 0x5246, 0x5272, 0x5277, 0x3515,
+  0x5305, 0x5306, 0x5349, 0x535a, 0x5373, 0x537d, 0x537f, 0x20a2c,
+  0x7070, 0x53ca, 0x53df, 0x20b63, 0x53eb, 0x53f1, 0x5406, 0x549e,
+  0x5438, 0x5448, 0x5468, 0x54a2, 0x54f6, 0x5510, 0x5553, 0x5563,
+  0x5584, 0x55ab, 0x55b3, 0x55c2, 0x5716, 0x5717, 0x5651, 0x5674,
+  0x58ee, 0x57ce, 0x57f4, 0x580d, 0x578b, 0x5832, 0x5831, 0x58ac,
+  0x214e4, 0x58f2, 0x58f7, 0x5906, 0x591a, 0x5922, 0x5962, 0x216a8,
+  0x216ea, 0x59ec, 0x5a1b, 0x5a27, 0x59d8, 0x5a66, 0x36ee, 0x36fc,
+  0x5b08, 0x5b3e, 0x219c8, 0x5bc3, 0x5bd8, 0x5bf3, 0x21b18, 0x5bff,
+  0x5c06, 0x5f53, 0x5c22, 0x3781, 0x5c60, 0x5cc0, 0x5c8d, 0x21de4,
+  0x5d43, 0x21de6, 0x5d6e, 0x5d6b, 0x5d7c, 0x5de1, 0x5de2, 0x382f,
+  0x5dfd, 0x5e28, 0x5e3d, 0x5e69, 0x3862, 0x22183, 0x387c, 0x5eb0,
+  0x5eb3, 0x5eb6, 0x2a392, 0x5efe, 0x22331, 0x8201, 0x5f22, 0x38c7,
+  0x232b8, 0x261da, 0x5f62, 0x5f6b, 0x38e3, 0x5f9a, 0x5fcd, 0x5fd7,
+  0x5ff9, 0x6081, 0x393a, 0x391c, 0x226d4, 0x60c7, 0x6148, 0x614c,
+  0x617a, 0x61b2, 0x61a4, 0x61af, 0x61de, 0x6210, 0x621b, 0x625d,
+  0x62b1, 0x62d4, 0x6350, 0x22b0c, 0x633d, 0x62fc, 0x6368, 0x6383,
+  0x63e4, 0x22bf1, 0x6422, 0x63c5, 0x63a9, 0x3a2e, 0x6469, 0x647e,
+  0x649d, 0x6477, 0x3a6c, 0x656c, 0x2300a, 0x65e3, 0x66f8, 0x6649,
+  0x3b19, 0x3b08, 0x3ae4, 0x5192, 0x5195, 0x6700, 0x669c, 0x80ad,
+  0x43d9, 0x6721, 0x675e, 0x6753, 0x233c3, 0x3b49, 0x67fa, 0x6785,
+  0x6852, 0x2346d, 0x688e, 0x681f, 0x6914, 0x6942, 0x69a3, 0x69ea,
+  0x6aa8, 0x236a3, 0x6adb, 0x3c18, 0x6b21, 0x238a7, 0x6b54, 0x3c4e,
+  0x6b72, 0x6b9f, 0x6bbb, 0x23a8d, 0x21d0b, 0x23afa, 0x6c4e, 0x23cbc,
+  0x6cbf, 0x6ccd, 0x6c67, 0x6d16, 0x6d3e, 0x6d69, 0x6d78, 0x6d85,
+  0x23d1e, 0x6d34, 0x6e2f, 0x6e6e, 0x3d33, 0x6ec7, 0x23ed1, 0x6df9,
+  0x6f6e, 0x23f5e, 0x23f8e, 0x6fc6, 0x7039, 0x701b, 0x3d96, 0x704a,
+  0x707d, 0x7077, 0x70ad, 0x20525, 0x7145, 0x24263, 0x719c, 0x243ab,
+  0x7228, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814, 0x737a,
+  0x738b, 0x3eac, 0x73a5, 0x3eb8, 0x7447, 0x745c, 0x7485, 0x74ca,
+  0x3f1b, 0x7524, 0x24c36, 0x753e, 0x24c92, 0x2219f, 0x7610, 0x24fa1,
+  0x24fb8, 0x25044, 0x3ffc, 0x4008, 0x250f3, 0x250f2, 0x25119, 0x25133,
+  0x771e, 0x771f, 0x778b, 0x4046, 0x4096, 0x2541d, 0x784e, 0x40e3,
+  0x25626, 0x2569a, 0x256c5, 0x79eb, 0x412f, 0x7a4a, 0x7a4f, 0x2597c,
+  0x25aa7, 0x7aee, 0x4202, 0x25bab, 0x7bc6, 0x7bc9, 0x4227, 0x25c80,
+  0x7cd2, 0x42a0, 0x7ce8, 0x7ce3, 0x7d00, 0x25f86, 0x7d63, 0x4301,
+  0x7dc7, 0x7e02, 0x7e45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262d9,
+  0x7f7a, 0x2633e, 0x7f95, 0x7ffa, 0x264da, 0x26523, 0x8060, 0x265a8,
+  0x8070, 0x2335f, 0x43d5, 0x80b2, 0x8103, 0x440b, 0x813e, 0x5ab5,
+  0x267a7, 0x267b5, 0x23393, 0x2339c, 0x8204, 0x8f9e, 0x446b, 0x8291,
+  0x828b, 0x829d, 0x52b3, 0x82b1, 0x82b3, 0x82bd, 0x82e6, 0x26b3c,
+  0x831d, 0x8363, 0x83ad, 0x8323, 0x83bd, 0x83e7, 0x8353, 0x83ca,
+  0x83cc, 0x83dc, 0x26c36, 0x26d6b, 0x26cd5, 0x452b, 0x84f1, 0x84f3,
+  0x8516, 0x273ca, 0x8564, 0x26f2c, 0x455d, 0x4561, 0x26fb1, 0x270d2,
+  0x456b, 0x8650, 0x8667, 0x8669, 0x86a9, 0x8688, 0x870e, 0x86e2,
+  0x8728, 0x876b, 0x8786, 0x45d7, 0x87e1, 0x8801, 0x45f9, 0x8860,
+  0x8863, 0x27667, 0x88d7, 0x88de, 0x4635, 0x88fa, 0x34bb, 0x278ae,
+  0x27966, 0x46be, 0x46c7, 0x8aa0, 0x8c55, 0x27ca8, 0x8cab, 0x8cc1,
+  0x8d1b, 0x8d77, 0x27f2f, 0x20804, 0x8dcb, 0x8dbc, 0x8df0, 0x208de,
+  0x8ed4, 0x285d2, 0x285ed, 0x9094, 0x90f1, 0x9111, 0x2872e, 0x911b,
+  0x9238, 0x92d7, 0x92d8, 0x927c, 0x93f9, 0x9415, 0x28bfa, 0x958b,
+  0x4995, 0x95b7, 0x28d77, 0x49e6, 0x96c3, 0x5db2, 0x9723, 0x29145,
+  0x2921a, 0x4a6e, 0x4a76, 0x97e0, 0x2940a, 0x4ab2, 0x29496, 0x9829,
+  0x295b6, 0x98e2, 0x4b33, 0x9929, 0x99a7, 0x99c2, 0x99fe, 0x4bce,
+  0x29b30, 0x9c40, 0x9cfd, 0x4cce, 0x4ced, 0x9d67, 0x2a0ce, 0x4cf8,
+  0x2a105, 0x2a20e, 0x2a291, 0x9ebb, 0x4d56, 0x9ef9, 0x9efe, 0x9f05,
+  0x9f0f, 0x9f16, 0x9f3b, 0x2a600,
+};
+
+#define SW_NFC_NUM_COMPOSITIONS 941
+
+// Sorted by the pair of characters that compose.
+static const swNfcComposition swNfcCompositions[941] = {
+  {0x3c, 0x338, 0x226e},
+  {0x3d, 0x338, 0x2260},
+  {0x3e, 0x338, 0x226f},
+  {0x41, 0x300, 0xc0},
+  {0x41, 0x301, 0xc1},
+  {0x41, 0x302, 0xc2},
+  {0x41, 0x303, 0xc3},
+  {0x41, 0x304, 0x100},
+  {0x41, 0x306, 0x102},
+  {0x41, 0x307, 0x226},
+  {0x41, 0x308, 0xc4},
+  {0x41, 0x309, 0x1ea2},
+  {0x41, 0x30a, 0xc5},
+  {0x41, 0x30c, 0x1cd},
+  {0x41, 0x30f, 0x200},
+  {0x41, 0x311, 0x202},
+  {0x41, 0x323, 0x1ea0},
+  {0x41, 0x325, 0x1e00},
+  {0x41, 0x328, 0x104},
+  {0x42, 0x307, 0x1e02},
+  {0x42, 0x323, 0x1e04},
+  {0x42, 0x331, 0x1e06},
+  {0x43, 0x301, 0x106},
+  {0x43, 0x302, 0x108},
+  {0x43, 0x307, 0x10a},
+  {0x43, 0x30c, 0x10c},
+  {0x43, 0x327, 0xc7},
+  {0x44, 0x307, 0x1e0a},
+  {0x44, 0x30c, 0x10e},
+  {0x44, 0x323, 0x1e0c},
+  {0x44, 0x327, 0x1e10},
+  {0x44, 0x32d, 0x1e12},
+  {0x44, 0x331, 0x1e0e},
+  {0x45, 0x300, 0xc8},
+  {0x45, 0x301, 0xc9},
+  {0x45, 0x302, 0xca},
+  {0x45, 0x303, 0x1ebc},
+  {0x45, 0x304, 0x112},
+  {0x45, 0x306, 0x114},
+  {0x45, 0x307, 0x116},
+  {0x45, 0x308, 0xcb},
+  {0x45, 0x309, 0x1eba},
+  {0x45, 0x30c, 0x11a},
+  {0x45, 0x30f, 0x204},
+  {0x45, 0x311, 0x206},
+  {0x45, 0x323, 0x1eb8},
+  {0x45, 0x327, 0x228},
+  {0x45, 0x328, 0x118},
+  {0x45, 0x32d, 0x1e18},
+  {0x45, 0x330, 0x1e1a},
+  {0x46, 0x307, 0x1e1e},
+  {0x47, 0x301, 0x1f4},
+  {0x47, 0x302, 0x11c},
+  {0x47, 0x304, 0x1e20},
+  {0x47, 0x306, 0x11e},
+  {0x47, 0x307, 0x120},
+  {0x47, 0x30c, 0x1e6},
+  {0x47, 0x327, 0x122},
+  {0x48, 0x302, 0x124},
+  {0x48, 0x307, 0x1e22},
+  {0x48, 0x308, 0x1e26},
+  {0x48, 0x30c, 0x21e},
+  {0x48, 0x323, 0x1e24},
+  {0x48, 0x327, 0x1e28},
+  {0x48, 0x32e, 0x1e2a},
+  {0x49, 0x300, 0xcc},
+  {0x49, 0x301, 0xcd},
+  {0x49, 0x302, 0xce},
+  {0x49, 0x303, 0x128},
+  {0x49, 0x304, 0x12a},
+  {0x49, 0x306, 0x12c},
+  {0x49, 0x307, 0x130},
+  {0x49, 0x308, 0xcf},
+  {0x49, 0x309, 0x1ec8},
+  {0x49, 0x30c, 0x1cf},
+  {0x49, 0x30f, 0x208},
+  {0x49, 0x311, 0x20a},
+  {0x49, 0x323, 0x1eca},
+  {0x49, 0x328, 0x12e},
+  {0x49, 0x330, 0x1e2c},
+  {0x4a, 0x302, 0x134},
+  {0x4b, 0x301, 0x1e30},
+  {0x4b, 0x30c, 0x1e8},
+  {0x4b, 0x323, 0x1e32},
+  {0x4b, 0x327, 0x136},
+  {0x4b, 0x331, 0x1e34},
+  {0x4c, 0x301, 0x139},
+  {0x4c, 0x30c, 0x13d},
+  {0x4c, 0x323, 0x1e36},
+  {0x4c, 0x327, 0x13b},
+  {0x4c, 0x32d, 0x1e3c},
+  {0x4c, 0x331, 0x1e3a},
+  {0x4d, 0x301, 0x1e3e},
+  {0x4d, 0x307, 0x1e40},
+  {0x4d, 0x323, 0x1e42},
+  {0x4e, 0x300, 0x1f8},
+  {0x4e, 0x301, 0x143},
+  {0x4e, 0x303, 0xd1},
+  {0x4e, 0x307, 0x1e44},
+  {0x4e, 0x30c, 0x147},
+  {0x4e, 0x323, 0x1e46},
+  {0x4e, 0x327, 0x145},
+  {0x4e, 0x32d, 0x1e4a},
+  {0x4e, 0x331, 0x1e48},
+  {0x4f, 0x300, 0xd2},
+  {0x4f, 0x301, 0xd3},
+  {0x4f, 0x302, 0xd4},
+  {0x4f, 0x303, 0xd5},
+  {0x4f, 0x304, 0x14c},
+  {0x4f, 0x306, 0x14e},
+  {0x4f, 0x307, 0x22e},
+  {0x4f, 0x308, 0xd6},
+  {0x4f, 0x309, 0x1ece},
+  {0x4f, 0x30b, 0x150},
+  {0x4f, 0x30c, 0x1d1},
+  {0x4f, 0x30f, 0x20c},
+  {0x4f, 0x311, 0x20e},
+  {0x4f, 0x31b, 0x1a0},
+  {0x4f, 0x323, 0x1ecc},
+  {0x4f, 0x328, 0x1ea},
+  {0x50, 0x301, 0x1e54},
+  {0x50, 0x307, 0x1e56},
+  {0x52, 0x301, 0x154},
+  {0x52, 0x307, 0x1e58},
+  {0x52, 0x30c, 0x158},
+  {0x52, 0x30f, 0x210},
+  {0x52, 0x311, 0x212},
+  {0x52, 0x323, 0x1e5a},
+  {0x52, 0x327, 0x156},
+  {0x52, 0x331, 0x1e5e},
+  {0x53, 0x301, 0x15a},
+  {0x53, 0x302, 0x15c},
+  {0x53, 0x307, 0x1e60},
+  {0x53, 0x30c, 0x160},
+  {0x53, 0x323, 0x1e62},
+  {0x53, 0x326, 0x218},
+  {0x53, 0x327, 0x15e},
+  {0x54, 0x307, 0x1e6a},
+  {0x54, 0x30c, 0x164},
+  {0x54, 0x323, 0x1e6c},
+  {0x54, 0x326, 0x21a},
+  {0x54, 0x327, 0x162},
+  {0x54, 0x32d, 0x1e70},
+  {0x54, 0x331, 0x1e6e},
+  {0x55, 0x300, 0xd9},
+  {0x55, 0x301, 0xda},
+  {0x55, 0x302, 0xdb},
+  {0x55, 0x303, 0x168},
+  {0x55, 0x304, 0x16a},
+  {0x55, 0x306, 0x16c},
+  {0x55, 0x308, 0xdc},
+  {0x55, 0x309, 0x1ee6},
+  {0x55, 0x30a, 0x16e},
+  {0x55, 0x30b, 0x170},
+  {0x55, 0x30c, 0x1d3},
+  {0x55, 0x30f, 0x214},
+  {0x55, 0x311, 0x216},
+  {0x55, 0x31b, 0x1af},
+  {0x55, 0x323, 0x1ee4},
+  {0x55, 0x324, 0x1e72},
+  {0x55, 0x328, 0x172},
+  {0x55, 0x32d, 0x1e76},
+  {0x55, 0x330, 0x1e74},
+  {0x56, 0x303, 0x1e7c},
+  {0x56, 0x323, 0x1e7e},
+  {0x57, 0x300, 0x1e80},
+  {0x57, 0x301, 0x1e82},
+  {0x57, 0x302, 0x174},
+  {0x57, 0x307, 0x1e86},
+  {0x57, 0x308, 0x1e84},
+  {0x57, 0x323, 0x1e88},
+  {0x58, 0x307, 0x1e8a},
+  {0x58, 0x308, 0x1e8c},
+  {0x59, 0x300, 0x1ef2},
+  {0x59, 0x301, 0xdd},
+  {0x59, 0x302, 0x176},
+  {0x59, 0x303, 0x1ef8},
+  {0x59, 0x304, 0x232},
+  {0x59, 0x307, 0x1e8e},
+  {0x59, 0x308, 0x178},
+  {0x59, 0x309, 0x1ef6},
+  {0x59, 0x323, 0x1ef4},
+  {0x5a, 0x301, 0x179},
+  {0x5a, 0x302, 0x1e90},
+  {0x5a, 0x307, 0x17b},
+  {0x5a, 0x30c, 0x17d},
+  {0x5a, 0x323, 0x1e92},
+  {0x5a, 0x331, 0x1e94},
+  {0x61, 0x300, 0xe0},
+  {0x61, 0x301, 0xe1},
+  {0x61, 0x302, 0xe2},
+  {0x61, 0x303, 0xe3},
+  {0x61, 0x304, 0x101},
+  {0x61, 0x306, 0x103},
+  {0x61, 0x307, 0x227},
+  {0x61, 0x308, 0xe4},
+  {0x61, 0x309, 0x1ea3},
+  {0x61, 0x30a, 0xe5},
+  {0x61, 0x30c, 0x1ce},
+  {0x61, 0x30f, 0x201},
+  {0x61, 0x311, 0x203},
+  {0x61, 0x323, 0x1ea1},
+  {0x61, 0x325, 0x1e01},
+  {0x61, 0x328, 0x105},
+  {0x62, 0x307, 0x1e03},
+  {0x62, 0x323, 0x1e05},
+  {0x62, 0x331, 0x1e07},
+  {0x63, 0x301, 0x107},
+  {0x63, 0x302, 0x109},
+  {0x63, 0x307, 0x10b},
+  {0x63, 0x30c, 0x10d},
+  {0x63, 0x327, 0xe7},
+  {0x64, 0x307, 0x1e0b},
+  {0x64, 0x30c, 0x10f},
+  {0x64, 0x323, 0x1e0d},
+  {0x64, 0x327, 0x1e11},
+  {0x64, 0x32d, 0x1e13},
+  {0x64, 0x331, 0x1e0f},
+  {0x65, 0x300, 0xe8},
+  {0x65, 0x301, 0xe9},
+  {0x65, 0x302, 0xea},
+  {0x65, 0x303, 0x1ebd},
+  {0x65, 0x304, 0x113},
+  {0x65, 0x306, 0x115},
+  {0x65, 0x307, 0x117},
+  {0x65, 0x308, 0xeb},
+  {0x65, 0x309, 0x1ebb},
+  {0x65, 0x30c, 0x11b},
+  {0x65, 0x30f, 0x205},
+  {0x65, 0x311, 0x207},
+  {0x65, 0x323, 0x1eb9},
+  {0x65, 0x327, 0x229},
+  {0x65, 0x328, 0x119},
+  {0x65, 0x32d, 0x1e19},
+  {0x65, 0x330, 0x1e1b},
+  {0x66, 0x307, 0x1e1f},
+  {0x67, 0x301, 0x1f5},
+  {0x67, 0x302, 0x11d},
+  {0x67, 0x304, 0x1e21},
+  {0x67, 0x306, 0x11f},
+  {0x67, 0x307, 0x121},
+  {0x67, 0x30c, 0x1e7},
+  {0x67, 0x327, 0x123},
+  {0x68, 0x302, 0x125},
+  {0x68, 0x307, 0x1e23},
+  {0x68, 0x308, 0x1e27},
+  {0x68, 0x30c, 0x21f},
+  {0x68, 0x323, 0x1e25},
+  {0x68, 0x327, 0x1e29},
+  {0x68, 0x32e, 0x1e2b},
+  {0x68, 0x331, 0x1e96},
+  {0x69, 0x300, 0xec},
+  {0x69, 0x301, 0xed},
+  {0x69, 0x302, 0xee},
+  {0x69, 0x303, 0x129},
+  {0x69, 0x304, 0x12b},
+  {0x69, 0x306, 0x12d},
+  {0x69, 0x308, 0xef},
+  {0x69, 0x309, 0x1ec9},
+  {0x69, 0x30c, 0x1d0},
+  {0x69, 0x30f, 0x209},
+  {0x69, 0x311, 0x20b},
+  {0x69, 0x323, 0x1ecb},
+  {0x69, 0x328, 0x12f},
+  {0x69, 0x330, 0x1e2d},
+  {0x6a, 0x302, 0x135},
+  {0x6a, 0x30c, 0x1f0},
+  {0x6b, 0x301, 0x1e31},
+  {0x6b, 0x30c, 0x1e9},
+  {0x6b, 0x323, 0x1e33},
+  {0x6b, 0x327, 0x137},
+  {0x6b, 0x331, 0x1e35},
+  {0x6c, 0x301, 0x13a},
+  {0x6c, 0x30c, 0x13e},
+  {0x6c, 0x323, 0x1e37},
+  {0x6c, 0x327, 0x13c},
+  {0x6c, 0x32d, 0x1e3d},
+  {0x6c, 0x331, 0x1e3b},
+  {0x6d, 0x301, 0x1e3f},
+  {0x6d, 0x307, 0x1e41},
+  {0x6d, 0x323, 0x1e43},
+  {0x6e, 0x300, 0x1f9},
+  {0x6e, 0x301, 0x144},
+  {0x6e, 0x303, 0xf1},
+  {0x6e, 0x307, 0x1e45},
+  {0x6e, 0x30c, 0x148},
+  {0x6e, 0x323, 0x1e47},
+  {0x6e, 0x327, 0x146},
+  {0x6e, 0x32d, 0x1e4b},
+  {0x6e, 0x331, 0x1e49},
+  {0x6f, 0x300, 0xf2},
+  {0x6f, 0x301, 0xf3},
+  {0x6f, 0x302, 0xf4},
+  {0x6f, 0x303, 0xf5},
+  {0x6f, 0x304, 0x14d},
+  {0x6f, 0x306, 0x14f},
+  {0x6f, 0x307, 0x22f},
+  {0x6f, 0x308, 0xf6},
+  {0x6f, 0x309, 0x1ecf},
+  {0x6f, 0x30b, 0x151},
+  {0x6f, 0x30c, 0x1d2},
+  {0x6f, 0x30f, 0x20d},
+  {0x6f, 0x311, 0x20f},
+  {0x6f, 0x31b, 0x1a1},
+  {0x6f, 0x323, 0x1ecd},
+  {0x6f, 0x328, 0x1eb},
+  {0x70, 0x301, 0x1e55},
+  {0x70, 0x307, 0x1e57},
+  {0x72, 0x301, 0x155},
+  {0x72, 0x307, 0x1e59},
+  {0x72, 0x30c, 0x159},
+  {0x72, 0x30f, 0x211},
+  {0x72, 0x311, 0x213},
+  {0x72, 0x323, 0x1e5b},
+  {0x72, 0x327, 0x157},
+  {0x72, 0x331, 0x1e5f},
+  {0x73, 0x301, 0x15b},
+  {0x73, 0x302, 0x15d},
+  {0x73, 0x307, 0x1e61},
+  {0x73, 0x30c, 0x161},
+  {0x73, 0x323, 0x1e63},
+  {0x73, 0x326, 0x219},
+  {0x73, 0x327, 0x15f},
+  {0x74, 0x307, 0x1e6b},
+  {0x74, 0x308, 0x1e97},
+  {0x74, 0x30c, 0x165},
+  {0x74, 0x323, 0x1e6d},
+  {0x74, 0x326, 0x21b},
+  {0x74, 0x327, 0x163},
+  {0x74, 0x32d, 0x1e71},
+  {0x74, 0x331, 0x1e6f},
+  {0x75, 0x300, 0xf9},
+  {0x75, 0x301, 0xfa},
+  {0x75, 0x302, 0xfb},
+  {0x75, 0x303, 0x169},
+  {0x75, 0x304, 0x16b},
+  {0x75, 0x306, 0x16d},
+  {0x75, 0x308, 0xfc},
+  {0x75, 0x309, 0x1ee7},
+  {0x75, 0x30a, 0x16f},
+  {0x75, 0x30b, 0x171},
+  {0x75, 0x30c, 0x1d4},
+  {0x75, 0x30f, 0x215},
+  {0x75, 0x311, 0x217},
+  {0x75, 0x31b, 0x1b0},
+  {0x75, 0x323, 0x1ee5},
+  {0x75, 0x324, 0x1e73},
+  {0x75, 0x328, 0x173},
+  {0x75, 0x32d, 0x1e77},
+  {0x75, 0x330, 0x1e75},
+  {0x76, 0x303, 0x1e7d},
+  {0x76, 0x323, 0x1e7f},
+  {0x77, 0x300, 0x1e81},
+  {0x77, 0x301, 0x1e83},
+  {0x77, 0x302, 0x175},
+  {0x77, 0x307, 0x1e87},
+  {0x77, 0x308, 0x1e85},
+  {0x77, 0x30a, 0x1e98},
+  {0x77, 0x323, 0x1e89},
+  {0x78, 0x307, 0x1e8b},
+  {0x78, 0x308, 0x1e8d},
+  {0x79, 0x300, 0x1ef3},
+  {0x79, 0x301, 0xfd},
+  {0x79, 0x302, 0x177},
+  {0x79, 0x303, 0x1ef9},
+  {0x79, 0x304, 0x233},
+  {0x79, 0x307, 0x1e8f},
+  {0x79, 0x308, 0xff},
+  {0x79, 0x309, 0x1ef7},
+  {0x79, 0x30a, 0x1e99},
+  {0x79, 0x323, 0x1ef5},
+  {0x7a, 0x301, 0x17a},
+  {0x7a, 0x302, 0x1e91},
+  {0x7a, 0x307, 0x17c},
+  {0x7a, 0x30c, 0x17e},
+  {0x7a, 0x323, 0x1e93},
+  {0x7a, 0x331, 0x1e95},
+  {0xa8, 0x300, 0x1fed},
+  {0xa8, 0x301, 0x385},
+  {0xa8, 0x342, 0x1fc1},
+  {0xc2, 0x300, 0x1ea6},
+  {0xc2, 0x301, 0x1ea4},
+  {0xc2, 0x303, 0x1eaa},
+  {0xc2, 0x309, 0x1ea8},
+  {0xc4, 0x304, 0x1de},
+  {0xc5, 0x301, 0x1fa},
+  {0xc6, 0x301, 0x1fc},
+  {0xc6, 0x304, 0x1e2},
+  {0xc7, 0x301, 0x1e08},
+  {0xca, 0x300, 0x1ec0},
+  {0xca, 0x301, 0x1ebe},
+  {0xca, 0x303, 0x1ec4},
+  {0xca, 0x309, 0x1ec2},
+  {0xcf, 0x301, 0x1e2e},
+  {0xd4, 0x300, 0x1ed2},
+  {0xd4, 0x301, 0x1ed0},
+  {0xd4, 0x303, 0x1ed6},
+  {0xd4, 0x309, 0x1ed4},
+  {0xd5, 0x301, 0x1e4c},
+  {0xd5, 0x304, 0x22c},
+  {0xd5, 0x308, 0x1e4e},
+  {0xd6, 0x304, 0x22a},
+  {0xd8, 0x301, 0x1fe},
+  {0xdc, 0x300, 0x1db},
+  {0xdc, 0x301, 0x1d7},
+  {0xdc, 0x304, 0x1d5},
+  {0xdc, 0x30c, 0x1d9},
+  {0xe2, 0x300, 0x1ea7},
+  {0xe2, 0x301, 0x1ea5},
+  {0xe2, 0x303, 0x1eab},
+  {0xe2, 0x309, 0x1ea9},
+  {0xe4, 0x304, 0x1df},
+  {0xe5, 0x301, 0x1fb},
+  {0xe6, 0x301, 0x1fd},
+  {0xe6, 0x304, 0x1e3},
+  {0xe7, 0x301, 0x1e09},
+  {0xea, 0x300, 0x1ec1},
+  {0xea, 0x301, 0x1ebf},
+  {0xea, 0x303, 0x1ec5},
+  {0xea, 0x309, 0x1ec3},
+  {0xef, 0x301, 0x1e2f},
+  {0xf4, 0x300, 0x1ed3},
+  {0xf4, 0x301, 0x1ed1},
+  {0xf4, 0x303, 0x1ed7},
+  {0xf4, 0x309, 0x1ed5},
+  {0xf5, 0x301, 0x1e4d},
+  {0xf5, 0x304, 0x22d},
+  {0xf5, 0x308, 0x1e4f},
+  {0xf6, 0x304, 0x22b},
+  {0xf8, 0x301, 0x1ff},
+  {0xfc, 0x300, 0x1dc},
+  {0xfc, 0x301, 0x1d8},
+  {0xfc, 0x304, 0x1d6},
+  {0xfc, 0x30c, 0x1da},
+  {0x102, 0x300, 0x1eb0},
+  {0x102, 0x301, 0x1eae},
+  {0x102, 0x303, 0x1eb4},
+  {0x102, 0x309, 0x1eb2},
+  {0x103, 0x300, 0x1eb1},
+  {0x103, 0x301, 0x1eaf},
+  {0x103, 0x303, 0x1eb5},
+  {0x103, 0x309, 0x1eb3},
+  {0x112, 0x300, 0x1e14},
+  {0x112, 0x301, 0x1e16},
+  {0x113, 0x300, 0x1e15},
+  {0x113, 0x301, 0x1e17},
+  {0x14c, 0x300, 0x1e50},
+  {0x14c, 0x301, 0x1e52},
+  {0x14d, 0x300, 0x1e51},
+  {0x14d, 0x301, 0x1e53},
+  {0x15a, 0x307, 0x1e64},
+  {0x15b, 0x307, 0x1e65},
+  {0x160, 0x307, 0x1e66},
+  {0x161, 0x307, 0x1e67},
+  {0x168, 0x301, 0x1e78},
+  {0x169, 0x301, 0x1e79},
+  {0x16a, 0x308, 0x1e7a},
+  {0x16b, 0x308, 0x1e7b},
+  {0x17f, 0x307, 0x1e9b},
+  {0x1a0, 0x300, 0x1edc},
+  {0x1a0, 0x301, 0x1eda},
+  {0x1a0, 0x303, 0x1ee0},
+  {0x1a0, 0x309, 0x1ede},
+  {0x1a0, 0x323, 0x1ee2},
+  {0x1a1, 0x300, 0x1edd},
+  {0x1a1, 0x301, 0x1edb},
+  {0x1a1, 0x303, 0x1ee1},
+  {0x1a1, 0x309, 0x1edf},
+  {0x1a1, 0x323, 0x1ee3},
+  {0x1af, 0x300, 0x1eea},
+  {0x1af, 0x301, 0x1ee8},
+  {0x1af, 0x303, 0x1eee},
+  {0x1af, 0x309, 0x1eec},
+  {0x1af, 0x323, 0x1ef0},
+  {0x1b0, 0x300, 0x1eeb},
+  {0x1b0, 0x301, 0x1ee9},
+  {0x1b0, 0x303, 0x1eef},
+  {0x1b0, 0x309, 0x1eed},
+  {0x1b0, 0x323, 0x1ef1},
+  {0x1b7, 0x30c, 0x1ee},
+  {0x1ea, 0x304, 0x1ec},
+  {0x1eb, 0x304, 0x1ed},
+  {0x226, 0x304, 0x1e0},
+  {0x227, 0x304, 0x1e1},
+  {0x228, 0x306, 0x1e1c},
+  {0x229, 0x306, 0x1e1d},
+  {0x22e, 0x304, 0x230},
+  {0x22f, 0x304, 0x231},
+  {0x292, 0x30c, 0x1ef},
+  {0x391, 0x300, 0x1fba},
+  {0x391, 0x301, 0x386},
+  {0x391, 0x304, 0x1fb9},
+  {0x391, 0x306, 0x1fb8},
+  {0x391, 0x313, 0x1f08},
+  {0x391, 0x314, 0x1f09},
+  {0x391, 0x345, 0x1fbc},
+  {0x395, 0x300, 0x1fc8},
+  {0x395, 0x301, 0x388},
+  {0x395, 0x313, 0x1f18},
+  {0x395, 0x314, 0x1f19},
+  {0x397, 0x300, 0x1fca},
+  {0x397, 0x301, 0x389},
+  {0x397, 0x313, 0x1f28},
+  {0x397, 0x314, 0x1f29},
+  {0x397, 0x345, 0x1fcc},
+  {0x399, 0x300, 0x1fda},
+  {0x399, 0x301, 0x38a},
+  {0x399, 0x304, 0x1fd9},
+  {0x399, 0x306, 0x1fd8},
+  {0x399, 0x308, 0x3aa},
+  {0x399, 0x313, 0x1f38},
+  {0x399, 0x314, 0x1f39},
+  {0x39f, 0x300, 0x1ff8},
+  {0x39f, 0x301, 0x38c},
+  {0x39f, 0x313, 0x1f48},
+  {0x39f, 0x314, 0x1f49},
+  {0x3a1, 0x314, 0x1fec},
+  {0x3a5, 0x300, 0x1fea},
+  {0x3a5, 0x301, 0x38e},
+  {0x3a5, 0x304, 0x1fe9},
+  {0x3a5, 0x306, 0x1fe8},
+  {0x3a5, 0x308, 0x3ab},
+  {0x3a5, 0x314, 0x1f59},
+  {0x3a9, 0x300, 0x1ffa},
+  {0x3a9, 0x301, 0x38f},
+  {0x3a9, 0x313, 0x1f68},
+  {0x3a9, 0x314, 0x1f69},
+  {0x3a9, 0x345, 0x1ffc},
+  {0x3ac, 0x345, 0x1fb4},
+  {0x3ae, 0x345, 0x1fc4},
+  {0x3b1, 0x300, 0x1f70},
+  {0x3b1, 0x301, 0x3ac},
+  {0x3b1, 0x304, 0x1fb1},
+  {0x3b1, 0x306, 0x1fb0},
+  {0x3b1, 0x313, 0x1f00},
+  {0x3b1, 0x314, 0x1f01},
+  {0x3b1, 0x342, 0x1fb6},
+  {0x3b1, 0x345, 0x1fb3},
+  {0x3b5, 0x300, 0x1f72},
+  {0x3b5, 0x301, 0x3ad},
+  {0x3b5, 0x313, 0x1f10},
+  {0x3b5, 0x314, 0x1f11},
+  {0x3b7, 0x300, 0x1f74},
+  {0x3b7, 0x301, 0x3ae},
+  {0x3b7, 0x313, 0x1f20},
+  {0x3b7, 0x314, 0x1f21},
+  {0x3b7, 0x342, 0x1fc6},
+  {0x3b7, 0x345, 0x1fc3},
+  {0x3b9, 0x300, 0x1f76},
+  {0x3b9, 0x301, 0x3af},
+  {0x3b9, 0x304, 0x1fd1},
+  {0x3b9, 0x306, 0x1fd0},
+  {0x3b9, 0x308, 0x3ca},
+  {0x3b9, 0x313, 0x1f30},
+  {0x3b9, 0x314, 0x1f31},
+  {0x3b9, 0x342, 0x1fd6},
+  {0x3bf, 0x300, 0x1f78},
+  {0x3bf, 0x301, 0x3cc},
+  {0x3bf, 0x313, 0x1f40},
+  {0x3bf, 0x314, 0x1f41},
+  {0x3c1, 0x313, 0x1fe4},
+  {0x3c1, 0x314, 0x1fe5},
+  {0x3c5, 0x300, 0x1f7a},
+  {0x3c5, 0x301, 0x3cd},
+  {0x3c5, 0x304, 0x1fe1},
+  {0x3c5, 0x306, 0x1fe0},
+  {0x3c5, 0x308, 0x3cb},
+  {0x3c5, 0x313, 0x1f50},
+  {0x3c5, 0x314, 0x1f51},
+  {0x3c5, 0x342, 0x1fe6},
+  {0x3c9, 0x300, 0x1f7c},
+  {0x3c9, 0x301, 0x3ce},
+  {0x3c9, 0x313, 0x1f60},
+  {0x3c9, 0x314, 0x1f61},
+  {0x3c9, 0x342, 0x1ff6},
+  {0x3c9, 0x345, 0x1ff3},
+  {0x3ca, 0x300, 0x1fd2},
+  {0x3ca, 0x301, 0x390},
+  {0x3ca, 0x342, 0x1fd7},
+  {0x3cb, 0x300, 0x1fe2},
+  {0x3cb, 0x301, 0x3b0},
+  {0x3cb, 0x342, 0x1fe7},
+  {0x3ce, 0x345, 0x1ff4},
+  {0x3d2, 0x301, 0x3d3},
+  {0x3d2, 0x308, 0x3d4},
+  {0x406, 0x308, 0x407},
+  {0x410, 0x306, 0x4d0},
+  {0x410, 0x308, 0x4d2},
+  {0x413, 0x301, 0x403},
+  {0x415, 0x300, 0x400},
+  {0x415, 0x306, 0x4d6},
+  {0x415, 0x308, 0x401},
+  {0x416, 0x306, 0x4c1},
+  {0x416, 0x308, 0x4dc},
+  {0x417, 0x308, 0x4de},
+  {0x418, 0x300, 0x40d},
+  {0x418, 0x304, 0x4e2},
+  {0x418, 0x306, 0x419},
+  {0x418, 0x308, 0x4e4},
+  {0x41a, 0x301, 0x40c},
+  {0x41e, 0x308, 0x4e6},
+  {0x423, 0x304, 0x4ee},
+  {0x423, 0x306, 0x40e},
+  {0x423, 0x308, 0x4f0},
+  {0x423, 0x30b, 0x4f2},
+  {0x427, 0x308, 0x4f4},
+  {0x42b, 0x308, 0x4f8},
+  {0x42d, 0x308, 0x4ec},
+  {0x430, 0x306, 0x4d1},
+  {0x430, 0x308, 0x4d3},
+  {0x433, 0x301, 0x453},
+  {0x435, 0x300, 0x450},
+  {0x435, 0x306, 0x4d7},
+  {0x435, 0x308, 0x451},
+  {0x436, 0x306, 0x4c2},
+  {0x436, 0x308, 0x4dd},
+  {0x437, 0x308, 0x4df},
+  {0x438, 0x300, 0x45d},
+  {0x438, 0x304, 0x4e3},
+  {0x438, 0x306, 0x439},
+  {0x438, 0x308, 0x4e5},
+  {0x43a, 0x301, 0x45c},
+  {0x43e, 0x308, 0x4e7},
+  {0x443, 0x304, 0x4ef},
+  {0x443, 0x306, 0x45e},
+  {0x443, 0x308, 0x4f1},
+  {0x443, 0x30b, 0x4f3},
+  {0x447, 0x308, 0x4f5},
+  {0x44b, 0x308, 0x4f9},
+  {0x44d, 0x308, 0x4ed},
+  {0x456, 0x308, 0x457},
+  {0x474, 0x30f, 0x476},
+  {0x475, 0x30f, 0x477},
+  {0x4d8, 0x308, 0x4da},
+  {0x4d9, 0x308, 0x4db},
+  {0x4e8, 0x308, 0x4ea},
+  {0x4e9, 0x308, 0x4eb},
+  {0x627, 0x653, 0x622},
+  {0x627, 0x654, 0x623},
+  {0x627, 0x655, 0x625},
+  {0x648, 0x654, 0x624},
+  {0x64a, 0x654, 0x626},
+  {0x6c1, 0x654, 0x6c2},
+  {0x6d2, 0x654, 0x6d3},
+  {0x6d5, 0x654, 0x6c0},
+  {0x928, 0x93c, 0x929},
+  {0x930, 0x93c, 0x931},
+  {0x933, 0x93c, 0x934},
+  {0x9c7, 0x9be, 0x9cb},
+  {0x9c7, 0x9d7, 0x9cc},
+  {0xb47, 0xb3e, 0xb4b},
+  {0xb47, 0xb56, 0xb48},
+  {0xb47, 0xb57, 0xb4c},
+  {0xb92, 0xbd7, 0xb94},
+  {0xbc6, 0xbbe, 0xbca},
+  {0xbc6, 0xbd7, 0xbcc},
+  {0xbc7, 0xbbe, 0xbcb},
+  {0xc46, 0xc56, 0xc48},
+  {0xcbf, 0xcd5, 0xcc0},
+  {0xcc6, 0xcc2, 0xcca},
+  {0xcc6, 0xcd5, 0xcc7},
+  {0xcc6, 0xcd6, 0xcc8},
+  {0xcca, 0xcd5, 0xccb},
+  {0xd46, 0xd3e, 0xd4a},
+  {0xd46, 0xd57, 0xd4c},
+  {0xd47, 0xd3e, 0xd4b},
+  {0xdd9, 0xdca, 0xdda},
+  {0xdd9, 0xdcf, 0xddc},
+  {0xdd9, 0xddf, 0xdde},
+  {0xddc, 0xdca, 0xddd},
+  {0x1025, 0x102e, 0x1026},
+  {0x1b05, 0x1b35, 0x1b06},
+  {0x1b07, 0x1b35, 0x1b08},
+  {0x1b09, 0x1b35, 0x1b0a},
+  {0x1b0b, 0x1b35, 0x1b0c},
+  {0x1b0d, 0x1b35, 0x1b0e},
+  {0x1b11, 0x1b35, 0x1b12},
+  {0x1b3a, 0x1b35, 0x1b3b},
+  {0x1b3c, 0x1b35, 0x1b3d},
+  {0x1b3e, 0x1b35, 0x1b40},
+  {0x1b3f, 0x1b35, 0x1b41},
+  {0x1b42, 0x1b35, 0x1b43},
+  {0x1e36, 0x304, 0x1e38},
+  {0x1e37, 0x304, 0x1e39},
+  {0x1e5a, 0x304, 0x1e5c},
+  {0x1e5b, 0x304, 0x1e5d},
+  {0x1e62, 0x307, 0x1e68},
+  {0x1e63, 0x307, 0x1e69},
+  {0x1ea0, 0x302, 0x1eac},
+  {0x1ea0, 0x306, 0x1eb6},
+  {0x1ea1, 0x302, 0x1ead},
+  {0x1ea1, 0x306, 0x1eb7},
+  {0x1eb8, 0x302, 0x1ec6},
+  {0x1eb9, 0x302, 0x1ec7},
+  {0x1ecc, 0x302, 0x1ed8},
+  {0x1ecd, 0x302, 0x1ed9},
+  {0x1f00, 0x300, 0x1f02},
+  {0x1f00, 0x301, 0x1f04},
+  {0x1f00, 0x342, 0x1f06},
+  {0x1f00, 0x345, 0x1f80},
+  {0x1f01, 0x300, 0x1f03},
+  {0x1f01, 0x301, 0x1f05},
+  {0x1f01, 0x342, 0x1f07},
+  {0x1f01, 0x345, 0x1f81},
+  {0x1f02, 0x345, 0x1f82},
+  {0x1f03, 0x345, 0x1f83},
+  {0x1f04, 0x345, 0x1f84},
+  {0x1f05, 0x345, 0x1f85},
+  {0x1f06, 0x345, 0x1f86},
+  {0x1f07, 0x345, 0x1f87},
+  {0x1f08, 0x300, 0x1f0a},
+  {0x1f08, 0x301, 0x1f0c},
+  {0x1f08, 0x342, 0x1f0e},
+  {0x1f08, 0x345, 0x1f88},
+  {0x1f09, 0x300, 0x1f0b},
+  {0x1f09, 0x301, 0x1f0d},
+  {0x1f09, 0x342, 0x1f0f},
+  {0x1f09, 0x345, 0x1f89},
+  {0x1f0a, 0x345, 0x1f8a},
+  {0x1f0b, 0x345, 0x1f8b},
+  {0x1f0c, 0x345, 0x1f8c},
+  {0x1f0d, 0x345, 0x1f8d},
+  {0x1f0e, 0x345, 0x1f8e},
+  {0x1f0f, 0x345, 0x1f8f},
+  {0x1f10, 0x300, 0x1f12},
+  {0x1f10, 0x301, 0x1f14},
+  {0x1f11, 0x300, 0x1f13},
+  {0x1f11, 0x301, 0x1f15},
+  {0x1f18, 0x300, 0x1f1a},
+  {0x1f18, 0x301, 0x1f1c},
+  {0x1f19, 0x300, 0x1f1b},
+  {0x1f19, 0x301, 0x1f1d},
+  {0x1f20, 0x300, 0x1f22},
+  {0x1f20, 0x301, 0x1f24},
+  {0x1f20, 0x342, 0x1f26},
+  {0x1f20, 0x345, 0x1f90},
+  {0x1f21, 0x300, 0x1f23},
+  {0x1f21, 0x301, 0x1f25},
+  {0x1f21, 0x342, 0x1f27},
+  {0x1f21, 0x345, 0x1f91},
+  {0x1f22, 0x345, 0x1f92},
+  {0x1f23, 0x345, 0x1f93},
+  {0x1f24, 0x345, 0x1f94},
+  {0x1f25, 0x345, 0x1f95},
+  {0x1f26, 0x345, 0x1f96},
+  {0x1f27, 0x345, 0x1f97},
+  {0x1f28, 0x300, 0x1f2a},
+  {0x1f28, 0x301, 0x1f2c},
+  {0x1f28, 0x342, 0x1f2e},
+  {0x1f28, 0x345, 0x1f98},
+  {0x1f29, 0x300, 0x1f2b},
+  {0x1f29, 0x301, 0x1f2d},
+  {0x1f29, 0x342, 0x1f2f},
+  {0x1f29, 0x345, 0x1f99},
+  {0x1f2a, 0x345, 0x1f9a},
+  {0x1f2b, 0x345, 0x1f9b},
+  {0x1f2c, 0x345, 0x1f9c},
+  {0x1f2d, 0x345, 0x1f9d},
+  {0x1f2e, 0x345, 0x1f9e},
+  {0x1f2f, 0x345, 0x1f9f},
+  {0x1f30, 0x300, 0x1f32},
+  {0x1f30, 0x301, 0x1f34},
+  {0x1f30, 0x342, 0x1f36},
+  {0x1f31, 0x300, 0x1f33},
+  {0x1f31, 0x301, 0x1f35},
+  {0x1f31, 0x342, 0x1f37},
+  {0x1f38, 0x300, 0x1f3a},
+  {0x1f38, 0x301, 0x1f3c},
+  {0x1f38, 0x342, 0x1f3e},
+  {0x1f39, 0x300, 0x1f3b},
+  {0x1f39, 0x301, 0x1f3d},
+  {0x1f39, 0x342, 0x1f3f},
+  {0x1f40, 0x300, 0x1f42},
+  {0x1f40, 0x301, 0x1f44},
+  {0x1f41, 0x300, 0x1f43},
+  {0x1f41, 0x301, 0x1f45},
+  {0x1f48, 0x300, 0x1f4a},
+  {0x1f48, 0x301, 0x1f4c},
+  {0x1f49, 0x300, 0x1f4b},
+  {0x1f49, 0x301, 0x1f4d},
+  {0x1f50, 0x300, 0x1f52},
+  {0x1f50, 0x301, 0x1f54},
+  {0x1f50, 0x342, 0x1f56},
+  {0x1f51, 0x300, 0x1f53},
+  {0x1f51, 0x301, 0x1f55},
+  {0x1f51, 0x342, 0x1f57},
+  {0x1f59, 0x300, 0x1f5b},
+  {0x1f59, 0x301, 0x1f5d},
+  {0x1f59, 0x342, 0x1f5f},
+  {0x1f60, 0x300, 0x1f62},
+  {0x1f60, 0x301, 0x1f64},
+  {0x1f60, 0x342, 0x1f66},
+  {0x1f60, 0x345, 0x1fa0},
+  {0x1f61, 0x300, 0x1f63},
+  {0x1f61, 0x301, 0x1f65},
+  {0x1f61, 0x342, 0x1f67},
+  {0x1f61, 0x345, 0x1fa1},
+  {0x1f62, 0x345, 0x1fa2},
+  {0x1f63, 0x345, 0x1fa3},
+  {0x1f64, 0x345, 0x1fa4},
+  {0x1f65, 0x345, 0x1fa5},
+  {0x1f66, 0x345, 0x1fa6},
+  {0x1f67, 0x345, 0x1fa7},
+  {0x1f68, 0x300, 0x1f6a},
+  {0x1f68, 0x301, 0x1f6c},
+  {0x1f68, 0x342, 0x1f6e},
+  {0x1f68, 0x345, 0x1fa8},
+  {0x1f69, 0x300, 0x1f6b},
+  {0x1f69, 0x301, 0x1f6d},
+  {0x1f69, 0x342, 0x1f6f},
+  {0x1f69, 0x345, 0x1fa9},
+  {0x1f6a, 0x345, 0x1faa},
+  {0x1f6b, 0x345, 0x1fab},
+  {0x1f6c, 0x345, 0x1fac},
+  {0x1f6d, 0x345, 0x1fad},
+  {0x1f6e, 0x345, 0x1fae},
+  {0x1f6f, 0x345, 0x1faf},
+  {0x1f70, 0x345, 0x1fb2},
+  {0x1f74, 0x345, 0x1fc2},
+  {0x1f7c, 0x345, 0x1ff2},
+  {0x1fb6, 0x345, 0x1fb7},
+  {0x1fbf, 0x300, 0x1fcd},
+  {0x1fbf, 0x301, 0x1fce},
+  {0x1fbf, 0x342, 0x1fcf},
+  {0x1fc6, 0x345, 0x1fc7},
+  {0x1ff6, 0x345, 0x1ff7},
+  {0x1ffe, 0x300, 0x1fdd},
+  {0x1ffe, 0x301, 0x1fde},
+  {0x1ffe, 0x342, 0x1fdf},
+  {0x2190, 0x338, 0x219a},
+  {0x2192, 0x338, 0x219b},
+  {0x2194, 0x338, 0x21ae},
+  {0x21d0, 0x338, 0x21cd},
+  {0x21d2, 0x338, 0x21cf},
+  {0x21d4, 0x338, 0x21ce},
+  {0x2203, 0x338, 0x2204},
+  {0x2208, 0x338, 0x2209},
+  {0x220b, 0x338, 0x220c},
+  {0x2223, 0x338, 0x2224},
+  {0x2225, 0x338, 0x2226},
+  {0x223c, 0x338, 0x2241},
+  {0x2243, 0x338, 0x2244},
+  {0x2245, 0x338, 0x2247},
+  {0x2248, 0x338, 0x2249},
+  {0x224d, 0x338, 0x226d},
+  {0x2261, 0x338, 0x2262},
+  {0x2264, 0x338, 0x2270},
+  {0x2265, 0x338, 0x2271},
+  {0x2272, 0x338, 0x2274},
+  {0x2273, 0x338, 0x2275},
+  {0x2276, 0x338, 0x2278},
+  {0x2277, 0x338, 0x2279},
+  {0x227a, 0x338, 0x2280},
+  {0x227b, 0x338, 0x2281},
+  {0x227c, 0x338, 0x22e0},
+  {0x227d, 0x338, 0x22e1},
+  {0x2282, 0x338, 0x2284},
+  {0x2283, 0x338, 0x2285},
+  {0x2286, 0x338, 0x2288},
+  {0x2287, 0x338, 0x2289},
+  {0x2291, 0x338, 0x22e2},
+  {0x2292, 0x338, 0x22e3},
+  {0x22a2, 0x338, 0x22ac},
+  {0x22a8, 0x338, 0x22ad},
+  {0x22a9, 0x338, 0x22ae},
+  {0x22ab, 0x338, 0x22af},
+  {0x22b2, 0x338, 0x22ea},
+  {0x22b3, 0x338, 0x22eb},
+  {0x22b4, 0x338, 0x22ec},
+  {0x22b5, 0x338, 0x22ed},
+  {0x3046, 0x3099, 0x3094},
+  {0x304b, 0x3099, 0x304c},
+  {0x304d, 0x3099, 0x304e},
+  {0x304f, 0x3099, 0x3050},
+  {0x3051, 0x3099, 0x3052},
+  {0x3053, 0x3099, 0x3054},
+  {0x3055, 0x3099, 0x3056},
+  {0x3057, 0x3099, 0x3058},
+  {0x3059, 0x3099, 0x305a},
+  {0x305b, 0x3099, 0x305c},
+  {0x305d, 0x3099, 0x305e},
+  {0x305f, 0x3099, 0x3060},
+  {0x3061, 0x3099, 0x3062},
+  {0x3064, 0x3099, 0x3065},
+  {0x3066, 0x3099, 0x3067},
+  {0x3068, 0x3099, 0x3069},
+  {0x306f, 0x3099, 0x3070},
+  {0x306f, 0x309a, 0x3071},
+  {0x3072, 0x3099, 0x3073},
+  {0x3072, 0x309a, 0x3074},
+  {0x3075, 0x3099, 0x3076},
+  {0x3075, 0x309a, 0x3077},
+  {0x3078, 0x3099, 0x3079},
+  {0x3078, 0x309a, 0x307a},
+  {0x307b, 0x3099, 0x307c},
+  {0x307b, 0x309a, 0x307d},
+  {0x309d, 0x3099, 0x309e},
+  {0x30a6, 0x3099, 0x30f4},
+  {0x30ab, 0x3099, 0x30ac},
+  {0x30ad, 0x3099, 0x30ae},
+  {0x30af, 0x3099, 0x30b0},
+  {0x30b1, 0x3099, 0x30b2},
+  {0x30b3, 0x3099, 0x30b4},
+  {0x30b5, 0x3099, 0x30b6},
+  {0x30b7, 0x3099, 0x30b8},
+  {0x30b9, 0x3099, 0x30ba},
+  {0x30bb, 0x3099, 0x30bc},
+  {0x30bd, 0x3099, 0x30be},
+  {0x30bf, 0x3099, 0x30c0},
+  {0x30c1, 0x3099, 0x30c2},
+  {0x30c4, 0x3099, 0x30c5},
+  {0x30c6, 0x3099, 0x30c7},
+  {0x30c8, 0x3099, 0x30c9},
+  {0x30cf, 0x3099, 0x30d0},
+  {0x30cf, 0x309a, 0x30d1},
+  {0x30d2, 0x3099, 0x30d3},
+  {0x30d2, 0x309a, 0x30d4},
+  {0x30d5, 0x3099, 0x30d6},
+  {0x30d5, 0x309a, 0x30d7},
+  {0x30d8, 0x3099, 0x30d9},
+  {0x30d8, 0x309a, 0x30da},
+  {0x30db, 0x3099, 0x30dc},
+  {0x30db, 0x309a, 0x30dd},
+  {0x30ef, 0x3099, 0x30f7},
+  {0x30f0, 0x3099, 0x30f8},
+  {0x30f1, 0x3099, 0x30f9},
+  {0x30f2, 0x3099, 0x30fa},
+  {0x30fd, 0x3099, 0x30fe},
+  {0x11099, 0x110ba, 0x1109a},
+  {0x1109b, 0x110ba, 0x1109c},
+  {0x110a5, 0x110ba, 0x110ab},
+  {0x11131, 0x11127, 0x1112e},
+  {0x11132, 0x11127, 0x1112f},
+  {0x11347, 0x1133e, 0x1134b},
+  {0x11347, 0x11357, 0x1134c},
+  {0x114b9, 0x114b0, 0x114bc},
+  {0x114b9, 0x114ba, 0x114bb},
+  {0x114b9, 0x114bd, 0x114be},
+  {0x115b8, 0x115af, 0x115ba},
+  {0x115b9, 0x115af, 0x115bb},
+  {0x11935, 0x11930, 0x11938},
+};
@@ -26,6 +26,7 @@
  */
 
 
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -35,13 +36,19 @@
 #include "engine.h"
 
 /* adaptation layer defines */
-#define PICO_MEM_SIZE     2500000
+// Enough pico memory for one voice and its engine.
+#define PICO_MEM_SIZE_PER_VOICE 2500000
+// How many voices to keep loaded, unless SW_PICO_VOICES says otherwise.
+#define DEFAULT_CACHED_VOICES 3
 #define DummyLen 100000000
 
 /* string constants */
 #define MAX_OUTBUF_SIZE   512
+// Text is fed to pico a sentence at a time, so the first audio comes out before
+// the rest of the text is read, and a cancel does not wait for the whole
+// document.  Longer sentences are split at a space.
+#define MAX_SLICE_LEN 1024
 static const char *PICO_LINGWARE_PATH = "/usr/share/pico/lang";
-static const char *PICO_VOICE_NAME = "PicoVoice";
 
 /* supported voices
    Pico does not seperately specify the voice and locale.   */
@@ -51,17 +58,27 @@ static char *picoInternalTaLingware[] = {"en-US_ta.bin", "en-GB_ta.bin", "de-DE_
 static char *picoInternalSgLingware[] = {"en-US_lh0_sg.bin", "en-GB_kh0_sg.bin", "de-DE_gl0_sg.bin", "es-ES_zl0_sg.bin", "fr-FR_nk0_sg.bin", "it-IT_cm0_sg.bin"};
 static int picoNumSupportedVoices = 6;
 
+// A loaded voice: its two lingware resources, its voice definition, and an
+// engine for it.  Several are kept loaded, so switching languages back and
+// forth does not read the lingware from disk each time.
+typedef struct {
+  int langIndex;  // -1 if the slot is empty.
+  pico_Resource taResource;
+  pico_Resource sgResource;
+  bool haveDefinition;
+  pico_Engine engine;
+  char voiceName[PICO_MAX_VOICE_NAME_SIZE];
+  uint64_t lastUsed;
+} picoVoice;
+
 /* adapation layer global variables */
 static void *picoMemArea = NULL;
 static pico_System picoSystem = NULL;
-static pico_Resource picoTaResource = NULL;
-static pico_Resource picoSgResource = NULL;
-static pico_Resource picoUtppResource = NULL;
+static picoVoice *picoVoices = NULL;
+static int picoNumCachedVoices = 0;
+static uint64_t picoUseCounter = 0;
+// The engine of the selected voice.
 static pico_Engine picoEngine = NULL;
-static char *picoTaFileName = NULL;
-static char *picoSgFileName = NULL;
-static char *picoTaResourceName = NULL;
-static char *picoSgResourceName = NULL;
 static char *picoSynthdataPath = NULL;
 
 // Find the language index of the named voice.  If it does not exist, return -1.
@@ -76,142 +93,221 @@ static int findLanguageIndex(const char *name) {
   return -1;
 }
 
-// Load a voice.
-static bool loadVoice(const char *name) {
-  bool foundLanguage = true;
-  int langIndex = findLanguageIndex(name);
-  if (langIndex == -1) {
-    foundLanguage = false;
-    langIndex = 0; // Load the default voice
-  }
+// Print a pico error message.
+static void reportError(int ret, const char *what) {
   pico_Retstring outMessage;
-  char *fileName;
-  int ret;
+  pico_getSystemStatusMessage(picoSystem, ret, outMessage);
+  fprintf(stderr, "Cannot %s (%i): %s\n", what, ret, outMessage);
+}
 
-  // Load the text analysis Lingware resource file.
-  fileName = picoInternalTaLingware[langIndex];
-  picoTaFileName = (char *)swCalloc(strlen(picoSynthdataPath) + strlen(fileName) + 1, sizeof(char));
-  strcpy((char *)picoTaFileName, picoSynthdataPath);
-  strcat((char *)picoTaFileName, fileName);
-  ret = pico_loadResource(picoSystem, (pico_Char *)picoTaFileName, &picoTaResource);
+// Load a lingware resource file from the data directory.  Return the pico status.
+static int loadResource(const char *fileName, pico_Resource *resource, const char *what) {
+  char *path = swCatStrings(picoSynthdataPath, fileName);
+  int ret = pico_loadResource(picoSystem, (pico_Char *)path, resource);
+  swFree(path);
   if (ret) {
-    pico_getSystemStatusMessage(picoSystem, ret, outMessage);
-    fprintf(stderr, "Cannot load text analysis resource file (%i): %s\n", ret, outMessage);
-    return false;
+    reportError(ret, what);
+    *resource = NULL;
   }
-  /* Load the signal generation Lingware resource file. */
-  fileName = picoInternalSgLingware[langIndex];
-  picoSgFileName = (char *)swCalloc(strlen(picoSynthdataPath) + strlen(fileName) + 1, sizeof(char));
-  strcpy((char *)picoSgFileName, picoSynthdataPath);
-  strcat((char *)picoSgFileName, fileName);
-  ret = pico_loadResource(picoSystem, (pico_Char *)picoSgFileName, &picoSgResource);
+  return ret;
+}
+
+// Add a loaded resource to the voice definition.  Return the pico status.
+static int addResource(picoVoice *voice, pico_Resource resource, const char *what) {
+  char resourceName[PICO_MAX_RESOURCE_NAME_SIZE];
+  int ret = pico_getResourceName(picoSystem, resource, resourceName);
   if (ret) {
-    pico_getSystemStatusMessage(picoSystem, ret, outMessage);
-    fprintf(stderr, "Cannot load signal generation Lingware resource file (%i): %s\n", ret, outMessage);
-    return false;
+    reportError(ret, "get the resource name");
+    return ret;
   }
-  /* Get the text analysis resource name. */
-  picoTaResourceName = (char *)swCalloc(PICO_MAX_RESOURCE_NAME_SIZE, sizeof(char));
-  ret = pico_getResourceName(picoSystem, picoTaResource, (char *)picoTaResourceName);
+  ret = pico_addResourceToVoiceDefinition(picoSystem, (pico_Char *)voice->voiceName,
+      (pico_Char *)resourceName);
   if (ret) {
-    pico_getSystemStatusMessage(picoSystem, ret, outMessage);
-    fprintf(stderr, "Cannot get the text analysis resource name (%i): %s\n", ret, outMessage);
-    return false;
+    reportError(ret, what);
   }
-  /* Get the signal generation resource name. */
-  picoSgResourceName = (char *)swCalloc(PICO_MAX_RESOURCE_NAME_SIZE, sizeof(char));
-  ret = pico_getResourceName(picoSystem, picoSgResource, (char *)picoSgResourceName);
-  if (ret) {
-    pico_getSystemStatusMessage(picoSystem, ret, outMessage);
-    fprintf(stderr, "Cannot get the signal generation resource name (%i): %s\n", ret, outMessage);
-    return false;
+  return ret;
+}
+
+// Unload a voice, and free its slot.  This works on partly loaded voices.
+static void unloadVoice(picoVoice *voice) {
+  if (voice->engine) {
+    if (picoEngine == voice->engine) {
+      picoEngine = NULL;
+    }
+    pico_disposeEngine(picoSystem, &voice->engine);
+    voice->engine = NULL;
   }
-  /* Create a voice definition.   */
-  ret = pico_createVoiceDefinition(picoSystem, (pico_Char *)PICO_VOICE_NAME);
-  if (ret) {
-    pico_getSystemStatusMessage(picoSystem, ret, outMessage);
-    fprintf(stderr, "Cannot create voice definition (%i): %s\n", ret, outMessage);
-    return false;
+  if (voice->haveDefinition) {
+    pico_releaseVoiceDefinition(picoSystem, (pico_Char *)voice->voiceName);
+    voice->haveDefinition = false;
   }
-  /* Add the text analysis resource to the voice. */
-  ret = pico_addResourceToVoiceDefinition(picoSystem, (pico_Char *)PICO_VOICE_NAME, (pico_Char *)picoTaResourceName);
-  if (ret) {
-    pico_getSystemStatusMessage(picoSystem, ret, outMessage);
-    fprintf(stderr, "Cannot add the text analysis resource to the voice (%i): %s\n", ret, outMessage);
-    return false;
+  if (voice->sgResource) {
+    pico_unloadResource(picoSystem, &voice->sgResource);
+    voice->sgResource = NULL;
   }
-  /* Add the signal generation resource to the voice. */
-  ret = pico_addResourceToVoiceDefinition(picoSystem, (pico_Char *)PICO_VOICE_NAME, (pico_Char *)picoSgResourceName);
-  if (ret) {
-    pico_getSystemStatusMessage(picoSystem, ret, outMessage);
-    fprintf(stderr, "Cannot add the signal generation resource to the voice (%i): %s\n", ret, outMessage);
-    return false;
+  if (voice->taResource) {
+    pico_unloadResource(picoSystem, &voice->taResource);
+    voice->taResource = NULL;
+  }
+  voice->langIndex = -1;
+}
+
+// Load a voice into an empty slot.  Return the pico status, and on failure,
+// leave the slot empty.
+static int loadVoice(picoVoice *voice, int langIndex) {
+  int ret;
+
+  voice->langIndex = langIndex;
+  // Each cached voice needs its own voice definition name.
+  snprintf(voice->voiceName, PICO_MAX_VOICE_NAME_SIZE, "PicoVoice%d", langIndex);
+  ret = loadResource(picoInternalTaLingware[langIndex], &voice->taResource,
+      "load text analysis resource file");
+  if (!ret) {
+    ret = loadResource(picoInternalSgLingware[langIndex], &voice->sgResource,
+        "load signal generation Lingware resource file");
+  }
+  if (!ret) {
+    ret = pico_createVoiceDefinition(picoSystem, (pico_Char *)voice->voiceName);
+    if (ret) {
+      reportError(ret, "create voice definition");
+    } else {
+      voice->haveDefinition = true;
+    }
+  }
+  if (!ret) {
+    ret = addResource(voice, voice->taResource, "add the text analysis resource to the voice");
+  }
+  if (!ret) {
+    ret = addResource(voice, voice->sgResource, "add the signal generation resource to the voice");
+  }
+  if (!ret) {
+    ret = pico_newEngine(picoSystem, (pico_Char *)voice->voiceName, &voice->engine);
+    if (ret) {
+      reportError(ret, "create a new pico engine");
+      voice->engine = NULL;
+    }
   }
-  /* Create a new Pico engine. */
-  ret = pico_newEngine(picoSystem, (pico_Char *)PICO_VOICE_NAME, &picoEngine);
   if (ret) {
-    pico_getSystemStatusMessage(picoSystem, ret, outMessage);
-    fprintf(stderr, "Cannot create a new pico engine (%i): %s\n", ret, outMessage);
-    return false;
+    unloadVoice(voice);
   }
-  return foundLanguage;
+  return ret;
 }
 
-// Unload a voice.
-static void unloadVoice(void) {
-  if (picoEngine) {
-    pico_disposeEngine(picoSystem, &picoEngine);
-    pico_releaseVoiceDefinition(picoSystem, (pico_Char *)PICO_VOICE_NAME);
-    picoEngine = NULL;
+// Return the least recently used loaded voice, or NULL if none are loaded.
+static picoVoice *findLeastRecentlyUsed(void) {
+  picoVoice *oldest = NULL;
+  for (int i = 0; i < picoNumCachedVoices; i++) {
+    picoVoice *voice = picoVoices + i;
+    if (voice->langIndex != -1 && (oldest == NULL || voice->lastUsed < oldest->lastUsed)) {
+      oldest = voice;
+    }
+  }
+  return oldest;
+}
+
+// Make a voice the selected one, loading it if it is not cached.  The new voice
+// is loaded before any other is unloaded, so a voice that fails to load, for
+// example because its lingware is not installed, leaves the selected voice
+// speaking.  Only if pico runs out of memory are the least recently used voices
+// unloaded to make room.  Once the new voice is loaded, if the cache is full,
+// the least recently used voice is unloaded to free its slot.
+static bool selectVoice(int langIndex) {
+  picoVoice *slot = NULL;
+  int selectedLangIndex = -1;
+  for (int i = 0; i < picoNumCachedVoices; i++) {
+    picoVoice *voice = picoVoices + i;
+    if (voice->langIndex == langIndex) {
+      voice->lastUsed = ++picoUseCounter;
+      picoEngine = voice->engine;
+      return true;
+    }
+    if (voice->langIndex != -1 && voice->engine == picoEngine) {
+      selectedLangIndex = voice->langIndex;
+    }
   }
-  if (picoUtppResource) {
-    pico_unloadResource(picoSystem, &picoUtppResource);
-    picoUtppResource = NULL;
+  picoVoice newVoice = {.langIndex = -1};
+  int ret = loadVoice(&newVoice, langIndex);
+  while (ret == PICO_EXC_OUT_OF_MEM) {
+    picoVoice *victim = findLeastRecentlyUsed();
+    if (victim == NULL) {
+      break;
+    }
+    unloadVoice(victim);
+    ret = loadVoice(&newVoice, langIndex);
+  }
+  if (ret) {
+    // If the selected voice was unloaded to make room, bring it back.
+    if (picoEngine == NULL && selectedLangIndex != -1) {
+      selectVoice(selectedLangIndex);
+    }
+    return false;
   }
-  if (picoSgResource) {
-    pico_unloadResource(picoSystem, &picoSgResource);
-    picoSgResource = NULL;
+  for (int i = 0; i < picoNumCachedVoices && slot == NULL; i++) {
+    if (picoVoices[i].langIndex == -1) {
+      slot = picoVoices + i;
+    }
+  }
+  if (slot == NULL) {
+    slot = findLeastRecentlyUsed();
+    unloadVoice(slot);
   }
-  if (picoTaResource) {
-    pico_unloadResource(picoSystem, &picoTaResource);
-    picoTaResource = NULL;
+  *slot = newVoice;
+  slot->lastUsed = ++picoUseCounter;
+  picoEngine = slot->engine;
+  return true;
+}
+
+// Read SW_PICO_VOICES, the number of voices to keep loaded.
+static int readNumCachedVoices(void) {
+  const char *value = getenv("SW_PICO_VOICES");
+  int numVoices = value != NULL? atoi(value) : DEFAULT_CACHED_VOICES;
+  if (numVoices < 1) {
+    return 1;
   }
+  return numVoices > picoNumSupportedVoices? picoNumSupportedVoices : numVoices;
 }
 
 // Initialize the engine.
 bool swInitializeEngine(const char *synthdataPath) {
-  pico_Retstring outMessage;
   int ret;
   int length;
+  char *langPath;
 
   if (synthdataPath == NULL) {
-    synthdataPath = PICO_LINGWARE_PATH;
+    langPath = swCopyString(PICO_LINGWARE_PATH);
   } else {
-    synthdataPath = swCatStrings(synthdataPath, "/lang");
+    langPath = swCatStrings(synthdataPath, "/lang");
   }
-  length = strlen(synthdataPath);
-  picoSynthdataPath = (char *)swCalloc(length + 2, sizeof(char));
-  strcpy(picoSynthdataPath, synthdataPath);
-  if (length == 0 || synthdataPath[length - 1] != '/') {
-    strcpy(picoSynthdataPath + length, "/");
+  length = strlen(langPath);
+  picoSynthdataPath = swCatStrings(langPath, length == 0 || langPath[length - 1] != '/'? "/" : "");
+  swFree(langPath);
+  picoNumCachedVoices = readNumCachedVoices();
+  picoVoices = (picoVoice *)swCalloc(picoNumCachedVoices, sizeof(picoVoice));
+  for (int i = 0; i < picoNumCachedVoices; i++) {
+    picoVoices[i].langIndex = -1;
   }
-  picoMemArea = malloc(PICO_MEM_SIZE);
-  ret = pico_initialize(picoMemArea, PICO_MEM_SIZE, &picoSystem);
+  size_t memSize = (size_t)picoNumCachedVoices*PICO_MEM_SIZE_PER_VOICE;
+  picoMemArea = swCalloc(memSize, sizeof(char));
+  ret = pico_initialize(picoMemArea, memSize, &picoSystem);
   if (ret) {
-    pico_getSystemStatusMessage(picoSystem, ret, outMessage);
-    fprintf(stderr, "Cannot initialize pico (%i): %s\n", ret, outMessage);
+    reportError(ret, "initialize pico");
     return false;
   }
-  return loadVoice("US English");
+  return selectVoice(0);
 }
 
 // Close the TTS Engine.
 bool swCloseEngine(void) {
-  unloadVoice();
+  for (int i = 0; i < picoNumCachedVoices; i++) {
+    unloadVoice(picoVoices + i);
+  }
   if (picoSystem) {
     pico_terminate(&picoSystem);
     picoSystem = NULL;
   }
+  swFree(picoVoices);
+  swFree(picoMemArea);
+  swFree(picoSynthdataPath);
   return true;
 }
 
@@ -249,10 +345,14 @@ bool swUseSonicPitch(void) {
   return true;
 }
 
-// Select a voice.
+// Select a voice.  Unknown voices select the default voice, and return false.
 bool swSetVoice(const char *voice) {
-  unloadVoice();
-  return loadVoice(voice);
+  int langIndex = findLanguageIndex(voice);
+  if (langIndex == -1) {
+    selectVoice(0);
+    return false;
+  }
+  return selectVoice(langIndex);
 }
 
 // Speed support is poor in PicoTTS, so let libsonic do it.
@@ -270,32 +370,87 @@ bool swSetSSML(bool value) {
   return true;
 }
 
-// Speak the text.  Block until finished.
-bool swSpeakText(const char *text) {
-  pico_Int16 textRemaining = strlen(text) + 1; // Includes terminating ‘\0’
-  pico_Int16 bytesSent, bytesReceived, outDataType;
-  pico_Char *inp = (pico_Char *)text;
-  short *data;
-  unsigned char outBuffer[MAX_OUTBUF_SIZE];
-  int status, numSamples;
-
-  while(textRemaining) {
-    status = pico_putTextUtf8(picoEngine, inp, textRemaining, &bytesSent);
-    textRemaining -= bytesSent;
-    inp += bytesSent;
-    do {
-      status = pico_getData(picoEngine, (void *)outBuffer, MAX_OUTBUF_SIZE - 1,
-          &bytesReceived, &outDataType);
-      if (bytesReceived) {
-        // Forward to audio device.
-        data = (short *)(void *)outBuffer;
-        numSamples = bytesReceived >> 1;
-        if (!swProcessAudio(data, numSamples)) {
-          pico_resetEngine(picoEngine, PICO_RESET_SOFT);
-          return true; // Abort synthesis
-        }
+// Pass pico's audio to the client until pico needs more text.  Return false if
+// the client cancelled.
+static bool drainAudio(void) {
+  short outBuffer[MAX_OUTBUF_SIZE/2];
+  pico_Int16 bytesReceived, outDataType;
+  int status;
+
+  do {
+    status = pico_getData(picoEngine, (void *)outBuffer, MAX_OUTBUF_SIZE, &bytesReceived,
+        &outDataType);
+    if (bytesReceived && !swProcessAudio(outBuffer, bytesReceived >> 1)) {
+      return false;
+    }
+  } while(status == PICO_STEP_BUSY);
+  return true;
+}
+
+// Feed text to pico, draining its audio whenever its input buffer fills.
+// Return false if the client cancelled.
+static bool putText(const char *text, size_t length) {
+  while (length != 0) {
+    pico_Int16 bytesSent;
+    if (pico_putTextUtf8(picoEngine, (const pico_Char *)text, length, &bytesSent)) {
+      fprintf(stderr, "Unable to send text to pico\n");
+      return true;
+    }
+    text += bytesSent;
+    length -= bytesSent;
+    if (!drainAudio()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Return the length of the first slice of text: up to and including the space
+// after a '.', '!' or '?'.  Slices are at most MAX_SLICE_LEN long, and end at a
+// space, or failing that, a UTF-8 character boundary.
+static size_t findSliceEnd(const char *text, size_t length) {
+  size_t limit = length < MAX_SLICE_LEN? length : MAX_SLICE_LEN;
+  size_t lastSpace = 0;
+  for (size_t i = 0; i < limit; i++) {
+    char c = text[i];
+    if (isspace((uint8_t)c)) {
+      if (i > 0 && (text[i - 1] == '.' || text[i - 1] == '!' || text[i - 1] == '?')) {
+        return i + 1;
       }
-    } while(status == PICO_STEP_BUSY);
+      lastSpace = i + 1;
+    }
+  }
+  if (limit == length) {
+    return length;
+  }
+  if (lastSpace != 0) {
+    return lastSpace;
+  }
+  while (limit > 1 && ((uint8_t)text[limit] & 0xc0) == 0x80) {
+    limit--;
+  }
+  return limit;
+}
+
+// Speak the text.  Block until finished.  On a cancel, reset pico, which drops
+// whatever text it has not spoken yet.
+bool swSpeakText(const char *text) {
+  size_t length = strlen(text);
+  bool cancelled = false;
+
+  if (picoEngine == NULL) {
+    fprintf(stderr, "No pico voice is loaded\n");
+    return false;
+  }
+  while (length != 0 && !cancelled) {
+    size_t sliceLength = findSliceEnd(text, length);
+    cancelled = !putText(text, sliceLength) || swSynthesisCancelled();
+    text += sliceLength;
+    length -= sliceLength;
+  }
+  // The terminating '\0' makes pico speak the last sentence.
+  if (cancelled || !putText("", 1)) {
+    pico_resetEngine(picoEngine, PICO_RESET_SOFT);
   }
   return true;
 }
@@ -0,0 +1,105 @@
+/* In-process plugin wrapper for engines.
+
+Link an engine with this file instead of engine.c, with -shared -fPIC
+-fvisibility=hidden, to build it as a plugin.  Only swGetPlugin is exported, so
+the plugin's copies of util.c and the engine's globals never clash with the
+client's.  See plugin.h.
+
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "engine.h"
+#include "plugin.h"
+
+static swPluginAudioCallback audioCallback;
+static void *audioContext;
+static bool initialized = false;
+static bool useANSI = false;
+// Set when the client cancels the current utterance.
+static bool cancelled = false;
+
+// Switch to ANSI rather than UTF-8.
+void swSwitchToANSI(void) {
+  useANSI = true;
+}
+
+// Pass synthesized samples to the client.  Return false if the client cancelled.
+bool swProcessAudio(int16_t *data, uint32_t numSamples) {
+  if (cancelled) {
+    return false;
+  }
+  if (!audioCallback(audioContext, data, numSamples)) {
+    cancelled = true;
+    return false;
+  }
+  return true;
+}
+
+// Return true if the client has cancelled the current utterance.
+bool swSynthesisCancelled(void) {
+  return cancelled;
+}
+
+// Initialize the engine, unless another client in this process is using it.
+static bool initializeEngine(const char *synthdataPath, swPluginAudioCallback callback,
+    void *context) {
+  if (initialized) {
+    return false;
+  }
+  audioCallback = callback;
+  audioContext = context;
+  initialized = swInitializeEngine(synthdataPath);
+  return initialized;
+}
+
+// Close the engine.
+static bool closeEngine(void) {
+  initialized = false;
+  return swCloseEngine();
+}
+
+// Return true if the engine switched to ANSI.
+static bool usesANSI(void) {
+  return useANSI;
+}
+
+// Speak text, which is already in the engine's encoding.
+static bool speakText(const char *text) {
+  cancelled = false;
+  return swSpeakText(text);
+}
+
+// Speak a character.
+static bool speakChar(uint32_t unicodeChar) {
+  cancelled = false;
+  return swSpeakChar(unicodeChar);
+}
+
+static const swPlugin plugin = {
+  SW_PLUGIN_ABI_VERSION,
+  sizeof(swPlugin),
+  initializeEngine,
+  closeEngine,
+  swGetSampleRate,
+  usesANSI,
+  swGetVoices,
+  swGetVoiceVariants,
+  swFreeStringList,
+  swUseSonicSpeed,
+  swUseSonicPitch,
+  swSetVoice,
+  swSetVoiceVariant,
+  swSetSpeed,
+  swSetPitch,
+  swSetSSML,
+  speakText,
+  speakChar,
+  swGetAllocStats
+};
+
+// Return the plugin's function table.
+__attribute__((visibility("default"))) const swPlugin *swGetPlugin(void) {
+  return &plugin;
+}
@@ -0,0 +1,59 @@
+// In-process engine plugins.
+//
+// Engines normally run as a separate process, sw_<engine>, which speaks the
+// protocol in engine.c over pipes.  An engine that is safe to load into the
+// client can also be built as a plugin, sw_<engine>.so, in the same directory.
+// It is the same engine source linked with plugin.c instead of engine.c.  When
+// swStart finds a plugin with a matching ABI version, it loads it instead of
+// starting the process, and audio goes straight from the engine to the client's
+// callback, with no hex, no pipes and no copies.
+
+#ifndef SW_PLUGIN_H
+#define SW_PLUGIN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "util.h"
+
+// Change this whenever swPlugin changes.
+#define SW_PLUGIN_ABI_VERSION 1
+// The one symbol a plugin exports, a swGetPluginFunc.
+#define SW_PLUGIN_SYMBOL "swGetPlugin"
+
+// Called with each buffer of synthesized samples.  Return false to cancel.
+typedef bool (*swPluginAudioCallback)(void *context, int16_t *samples, uint32_t numSamples);
+
+// The engine functions in engine.h, called directly.
+typedef struct {
+  uint32_t abiVersion;
+  // sizeof(swPlugin) in the plugin.
+  uint32_t size;
+  // Return false if the engine fails to start, or is already in use, since a
+  // plugin's engine state is global.
+  bool (*initializeEngine)(const char *synthdataPath, swPluginAudioCallback callback,
+      void *context);
+  bool (*closeEngine)(void);
+  uint32_t (*getSampleRate)(void);
+  // Return true if the engine called swSwitchToANSI.
+  bool (*usesANSI)(void);
+  // Lists returned by getVoices and getVoiceVariants must be freed with
+  // freeStringList, since the plugin has its own allocator.
+  char **(*getVoices)(uint32_t *numVoices);
+  char **(*getVoiceVariants)(uint32_t *numVariants);
+  void (*freeStringList)(char **strings, uint32_t numStrings);
+  bool (*useSonicSpeed)(void);
+  bool (*useSonicPitch)(void);
+  bool (*setVoice)(const char *voice);
+  bool (*setVoiceVariant)(const char *variant);
+  bool (*setSpeed)(float speed);
+  bool (*setPitch)(float pitch);
+  bool (*setSSML)(bool value);
+  bool (*speakText)(const char *text);
+  bool (*speakChar)(uint32_t unicodeChar);
+  void (*getAllocStats)(swAllocStats *stats);
+} swPlugin;
+
+typedef const swPlugin *(*swGetPluginFunc)(void);
+
+#endif  // SW_PLUGIN_H
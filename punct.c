@@ -0,0 +1,157 @@
+// Compiled punctuation tables.  See punct.h for the format.
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "punct.h"
+#include "util.h"
+
+// Return the size of the header and page indexes, which come before the pages.
+static size_t pagesOffset(void) {
+  return sizeof(swPunctHeader) + SW_PUNCT_NUM_PAGE_INDEXES*sizeof(uint16_t);
+}
+
+// Build a table image from entries, which need not be sorted.  Return NULL and
+// print an error if an entry is invalid.  The caller frees the image with
+// swFree.
+void *swPunctBuildImage(const swPunctEntry *entries, uint32_t numEntries, size_t *size) {
+  uint16_t *pageIndexes = swCalloc(SW_PUNCT_NUM_PAGE_INDEXES, sizeof(uint16_t));
+  // Page 0 is the shared empty page.
+  uint32_t numPages = 1;
+  uint32_t namesSize = 1;  // Offset 0 means no name.
+  for (uint32_t i = 0; i < numEntries; i++) {
+    const swPunctEntry *entry = entries + i;
+    size_t nameLen = strlen(entry->name);
+    if (entry->unicodeChar >= 0x110000 || entry->level < 1 || entry->level > 3 ||
+        nameLen == 0 || nameLen > SW_PUNCT_MAX_NAME_LEN) {
+      fprintf(stderr, "Invalid punctuation entry for U+%04X\n", entry->unicodeChar);
+      swFree(pageIndexes);
+      return NULL;
+    }
+    uint32_t pageIndex = entry->unicodeChar >> SW_PUNCT_PAGE_BITS;
+    if (pageIndexes[pageIndex] == 0) {
+      pageIndexes[pageIndex] = numPages++;
+    }
+    namesSize += nameLen + 1;
+  }
+  *size = pagesOffset() + numPages*SW_PUNCT_PAGE_SIZE*sizeof(uint32_t) + namesSize;
+  uint8_t *image = swCalloc(*size, sizeof(uint8_t));
+  swPunctHeader *header = (swPunctHeader *)image;
+  header->magic = SW_PUNCT_MAGIC;
+  header->version = SW_PUNCT_VERSION;
+  header->numPages = numPages;
+  header->namesSize = namesSize;
+  memcpy(image + sizeof(swPunctHeader), pageIndexes,
+      SW_PUNCT_NUM_PAGE_INDEXES*sizeof(uint16_t));
+  uint32_t *pages = (uint32_t *)(image + pagesOffset());
+  uint8_t *names = (uint8_t *)(pages + numPages*SW_PUNCT_PAGE_SIZE);
+  uint32_t namePos = 1;
+  for (uint32_t i = 0; i < numEntries; i++) {
+    const swPunctEntry *entry = entries + i;
+    uint32_t page = pageIndexes[entry->unicodeChar >> SW_PUNCT_PAGE_BITS];
+    uint32_t *slot = pages + (page << SW_PUNCT_PAGE_BITS) +
+        (entry->unicodeChar & (SW_PUNCT_PAGE_SIZE - 1));
+    if (*slot != 0) {
+      fprintf(stderr, "Duplicate punctuation entry for U+%04X\n", entry->unicodeChar);
+      swFree(pageIndexes);
+      swFree(image);
+      return NULL;
+    }
+    size_t nameLen = strlen(entry->name);
+    *slot = (namePos << 2) | entry->level;
+    names[namePos] = nameLen;
+    memcpy(names + namePos + 1, entry->name, nameLen);
+    namePos += nameLen + 1;
+  }
+  swFree(pageIndexes);
+  return image;
+}
+
+// Check that the image is a table, and that every entry points inside it.  Set
+// the table's pointers.
+static bool checkImage(swPunctTable table) {
+  const swPunctHeader *header = table->data;
+  if (table->size < pagesOffset() || header->magic != SW_PUNCT_MAGIC ||
+      header->version != SW_PUNCT_VERSION || header->numPages == 0 ||
+      header->numPages > SW_PUNCT_NUM_PAGE_INDEXES + 1) {
+    return false;
+  }
+  size_t pagesSize = (size_t)header->numPages*SW_PUNCT_PAGE_SIZE*sizeof(uint32_t);
+  if (table->size != pagesOffset() + pagesSize + header->namesSize) {
+    return false;
+  }
+  const uint8_t *data = table->data;
+  table->pageIndexes = (const uint16_t *)(data + sizeof(swPunctHeader));
+  table->pages = (const uint32_t *)(data + pagesOffset());
+  table->names = data + pagesOffset() + pagesSize;
+  for (uint32_t i = 0; i < SW_PUNCT_NUM_PAGE_INDEXES; i++) {
+    if (table->pageIndexes[i] >= header->numPages) {
+      return false;
+    }
+  }
+  for (uint32_t i = 0; i < header->numPages*SW_PUNCT_PAGE_SIZE; i++) {
+    uint32_t entry = table->pages[i];
+    uint32_t offset = entry >> 2;
+    if (entry != 0 && (offset == 0 || offset >= header->namesSize ||
+        offset + 1 + table->names[offset] > header->namesSize ||
+        table->names[offset] > SW_PUNCT_MAX_NAME_LEN)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Use an image built by swPunctBuildImage.  The table takes ownership of it.
+swPunctTable swPunctOpenImage(void *image, size_t size) {
+  swPunctTable table = swCalloc(1, sizeof(struct swPunctTableSt));
+  table->data = image;
+  table->size = size;
+  if (!checkImage(table)) {
+    swPunctFree(table);
+    return NULL;
+  }
+  return table;
+}
+
+// Map a compiled table file into memory.  Return NULL if it cannot be read or
+// is not a valid table.
+swPunctTable swPunctLoad(const char *fileName) {
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0) {
+    return NULL;
+  }
+  struct stat status;
+  if (fstat(fd, &status) != 0 || status.st_size == 0) {
+    close(fd);
+    return NULL;
+  }
+  void *data = mmap(NULL, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return NULL;
+  }
+  swPunctTable table = swCalloc(1, sizeof(struct swPunctTableSt));
+  table->data = data;
+  table->size = status.st_size;
+  table->mapped = true;
+  if (!checkImage(table)) {
+    swLogWarn("Invalid punctuation table %s\n", fileName);
+    swPunctFree(table);
+    return NULL;
+  }
+  return table;
+}
+
+// Free the table, unmapping its file.
+void swPunctFree(swPunctTable table) {
+  if (table->mapped) {
+    munmap(table->data, table->size);
+  } else {
+    swFree(table->data);
+  }
+  swFree(table);
+}
@@ -0,0 +1,88 @@
+// Compiled punctuation tables.
+//
+// Each language's punctuation names are written in punctuation/<code>.txt, and
+// compiled by genpunct into share/speechsw/punctuation/<code>.swp at build
+// time.  A compiled table is mapped straight into memory.  It is a two-level
+// lookup over all of Unicode: the high bits of a code point select a page of
+// 256 entries, and pages with no names all share page 0.  An entry holds the
+// character's punctuation level and the offset of its name, so a lookup is two
+// loads.
+
+#ifndef SW_PUNCT_H
+#define SW_PUNCT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SW_PUNCT_MAGIC 0x54435057  // "WPCT" in little-endian byte order.
+#define SW_PUNCT_VERSION 1
+#define SW_PUNCT_PAGE_BITS 8
+#define SW_PUNCT_PAGE_SIZE (1 << SW_PUNCT_PAGE_BITS)
+#define SW_PUNCT_NUM_PAGE_INDEXES (0x110000 >> SW_PUNCT_PAGE_BITS)
+// Names longer than this are rejected, so the text pipeline can bound how much
+// one character expands to.
+#define SW_PUNCT_MAX_NAME_LEN 63
+
+// The file starts with this header, followed by uint16_t page indexes for every
+// page of Unicode, then numPages pages of uint32_t entries, then the names.  An
+// entry is 0 for a character with no name, or else the offset of the name in
+// the names block shifted left 2, ORed with the punctuation level at which it
+// is spoken: 1 for some, 2 for most, 3 for all.  Each name is a length byte
+// followed by that many bytes of UTF-8.  Numbers are in native byte order,
+// since tables are built on the machine that uses them.
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t numPages;
+  uint32_t namesSize;
+} swPunctHeader;
+
+// One source entry, as read from a punctuation/<code>.txt file.
+typedef struct {
+  uint32_t unicodeChar;
+  uint8_t level;
+  const char *name;
+} swPunctEntry;
+
+typedef struct swPunctTableSt {
+  const uint16_t *pageIndexes;
+  const uint32_t *pages;
+  const uint8_t *names;
+  void *data;
+  size_t size;
+  bool mapped;
+} *swPunctTable;
+
+// Build a table image from entries, which need not be sorted.  Return NULL and
+// print an error if an entry is invalid.  The caller frees the image with
+// swFree.
+void *swPunctBuildImage(const swPunctEntry *entries, uint32_t numEntries, size_t *size);
+// Use an image built by swPunctBuildImage.  The table takes ownership of it.
+swPunctTable swPunctOpenImage(void *image, size_t size);
+// Map a compiled table file into memory.  Return NULL if it cannot be read or
+// is not a valid table.
+swPunctTable swPunctLoad(const char *fileName);
+void swPunctFree(swPunctTable table);
+
+// Look up a character's name.  Return NULL if it has none.  Otherwise set
+// *level to the lowest punctuation level at which it is spoken, and *length to
+// the length of the name.
+static inline const char *swPunctLookup(swPunctTable table, uint32_t unicodeChar,
+    uint8_t *level, uint32_t *length) {
+  if (unicodeChar >= 0x110000) {
+    return NULL;
+  }
+  uint32_t page = table->pageIndexes[unicodeChar >> SW_PUNCT_PAGE_BITS];
+  uint32_t entry = table->pages[(page << SW_PUNCT_PAGE_BITS) |
+      (unicodeChar & (SW_PUNCT_PAGE_SIZE - 1))];
+  if (entry == 0) {
+    return NULL;
+  }
+  const uint8_t *name = table->names + (entry >> 2);
+  *level = entry & 3;
+  *length = *name;
+  return (const char *)name + 1;
+}
+
+#endif  // SW_PUNCT_H
@@ -0,0 +1,76 @@
+// Streaming sample rate conversion by linear interpolation.  See resample.h.
+//
+// The position of the next output sample is kept in input samples, relative to
+// the start of the next buffer, in 32.32 fixed point.  Position -1 is the last
+// sample of the previous buffer, which is kept so output samples between
+// buffers can be interpolated.
+
+#include <stdint.h>
+
+#include "resample.h"
+#include "util.h"
+
+struct swResamplerSt {
+  uint32_t inputRate;
+  uint32_t outputRate;
+  uint64_t step;  // Input samples per output sample, in 32.32 fixed point.
+  int64_t position;
+  int16_t lastSample;
+  int16_t *buffer;
+  uint32_t bufferSize;
+};
+
+// Create a resampler.
+swResampler swResamplerCreate(uint32_t inputRate, uint32_t outputRate) {
+  swResampler resampler = swCalloc(1, sizeof(struct swResamplerSt));
+  resampler->inputRate = inputRate;
+  resampler->outputRate = outputRate;
+  resampler->step = ((uint64_t)inputRate << 32) / outputRate;
+  return resampler;
+}
+
+// Free a resampler.
+void swResamplerFree(swResampler resampler) {
+  swFree(resampler->buffer);
+  swFree(resampler);
+}
+
+// Forget the samples of the previous utterance.
+void swResamplerReset(swResampler resampler) {
+  resampler->position = 0;
+  resampler->lastSample = 0;
+}
+
+// Convert a buffer of samples.
+uint32_t swResample(swResampler resampler, int16_t *samples, uint32_t numSamples,
+    int16_t **output) {
+  if (resampler->inputRate == resampler->outputRate) {
+    *output = samples;
+    return numSamples;
+  }
+  if (numSamples == 0) {
+    *output = resampler->buffer;
+    return 0;
+  }
+  uint32_t maxSamples = ((uint64_t)(numSamples + 1) << 32) / resampler->step + 1;
+  if (maxSamples > resampler->bufferSize) {
+    resampler->bufferSize = maxSamples;
+    resampler->buffer = swRealloc(resampler->buffer, maxSamples, sizeof(int16_t));
+  }
+  int64_t end = (int64_t)(numSamples - 1) << 32;
+  int64_t position = resampler->position;
+  uint32_t numOutput = 0;
+  // Interpolate between sample i and i + 1, where i may be -1, the last sample.
+  while (position < end) {
+    int64_t i = position >> 32;
+    int64_t fraction = position & 0xffffffff;
+    int32_t s0 = i < 0? resampler->lastSample : samples[i];
+    int32_t s1 = samples[i + 1];
+    resampler->buffer[numOutput++] = s0 + (((s1 - s0) * fraction) >> 32);
+    position += resampler->step;
+  }
+  resampler->position = position - ((int64_t)numSamples << 32);
+  resampler->lastSample = samples[numSamples - 1];
+  *output = resampler->buffer;
+  return numOutput;
+}
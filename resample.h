@@ -0,0 +1,26 @@
+// Streaming sample rate conversion.
+//
+// Engines run at their own rates, from 11025 Hz for Voxin to 22050 Hz for
+// espeak.  When audio from several engines is played as one stream, it has to
+// be converted to one rate.  This is linear interpolation, which is cheap and
+// good enough for speech, and keeps its state between buffers so an utterance
+// can be converted as it is synthesized.
+
+#ifndef SW_RESAMPLE_H
+#define SW_RESAMPLE_H
+
+#include <stdint.h>
+
+typedef struct swResamplerSt *swResampler;
+
+swResampler swResamplerCreate(uint32_t inputRate, uint32_t outputRate);
+void swResamplerFree(swResampler resampler);
+// Forget the samples of the previous utterance.
+void swResamplerReset(swResampler resampler);
+// Convert a buffer of samples.  Return the number of output samples, in a
+// buffer owned by the resampler, which is valid until the next call.  If the
+// rates are the same, the input is returned.
+uint32_t swResample(swResampler resampler, int16_t *samples, uint32_t numSamples,
+    int16_t **output);
+
+#endif  // SW_RESAMPLE_H
@@ -0,0 +1,877 @@
+// Route speech to several engines by latency class and language.  See
+// router.h.
+//
+// Each route, and each language added, has a worker: an engine, a thread, and
+// a queue of requests.  Requests are speech or settings, and a worker runs its
+// requests in order, so a setting applies to speech queued after it.
+// Cancelling bumps the router's generation, and drops queued speech.  Speech
+// from an older generation is cancelled at its next callback.
+//
+// Text in several scripts is split into runs, which are queued as a group on
+// the workers for their languages, and synthesized in parallel.  The audio of
+// the group's first unfinished run, its head, goes straight to the callback,
+// and later runs are buffered until they become the head.  Whoever finishes the
+// head run flushes the buffered runs after it, and then the next group.
+
+#include <ctype.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>  // For strncasecmp.
+
+#include "resample.h"
+#include "router.h"
+#include "script.h"
+#include "speechsw.h"
+#include "util.h"
+
+typedef enum {
+  SW_REQUEST_SPEAK,
+  SW_REQUEST_CHAR,
+  SW_REQUEST_SPEED,
+  SW_REQUEST_PITCH,
+  SW_REQUEST_PUNCTUATION,
+  SW_REQUEST_VOICE
+} swRequestType;
+
+typedef struct swGroupSt *swGroup;
+typedef struct swRunSt *swRun;
+typedef struct swRequestSt *swRequest;
+
+// One run of a group, and its audio buffered until it becomes the head.
+struct swRunSt {
+  swGroup group;
+  swEngine engine;
+  int16_t *samples;
+  uint32_t numSamples;
+  uint32_t allocatedSamples;
+  bool done;
+};
+
+struct swGroupSt {
+  swGroup next;  // The group to play after this one.
+  struct swRunSt *runs;
+  uint32_t numRuns;
+  uint32_t head;
+  // Set while a thread is flushing the group, or a group before it is playing.
+  bool flushing;
+  uint32_t generation;
+};
+
+struct swRequestSt {
+  swRequest next;
+  swRequestType type;
+  char *text;  // Text, character or voice.
+  size_t bytes;
+  bool isUTF8;
+  float value;
+  swPunctuationLevel level;
+  uint32_t generation;
+  swRun run;  // Set if the text is one run of a group.
+  // Bits for the routes whose engines could not speak this character.
+  uint32_t refusedRoutes;
+};
+
+typedef struct {
+  swRouter router;
+  swRoute route;  // SW_NUM_ROUTES for a language's worker.
+  char *languageCode;  // Set for a language's worker.
+  swEngine engine;  // NULL if the engine failed to start.
+  swResampler resampler;
+  char **voices;
+  uint32_t numVoices;
+  pthread_t thread;
+  swRequest firstRequest;
+  swRequest lastRequest;
+  bool busy;
+  // Set when the engine could not speak an ASCII letter or digit, so it cannot
+  // speak characters at all, and they go elsewhere.
+  bool lacksChar;
+  // The generation of the request being spoken, its run, if it is part of a
+  // group, and its samples so far.
+  uint32_t generation;
+  swRun run;
+  uint64_t numSamples;
+} swWorker;
+
+struct swRouterSt {
+  // The first SW_NUM_ROUTES workers are the routes, and the rest languages.
+  swWorker **workers;
+  uint32_t numWorkers;
+  char *libDirectory;
+  swCallback callback;
+  void *callbackContext;
+  uint32_t sampleRate;
+  size_t shortLength;
+  char *scriptLanguages[SW_NUM_SCRIPTS];
+  // Settings for engines started by swRouterAddLanguage.
+  float speed;
+  float pitch;
+  swPunctuationLevel punctuation;
+  bool punctuationSet;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  // Protects groups, and the runs in them.
+  pthread_mutex_t groupMutex;
+  swGroup lastGroup;
+  uint32_t generation;
+  bool stopping;
+};
+
+// The language each script is spoken in by default.  Latin text, and text in
+// scripts without a language, goes to the routes.
+static const char *defaultScriptLanguages[SW_NUM_SCRIPTS] = {
+  [SW_SCRIPT_GREEK] = "el",
+  [SW_SCRIPT_CYRILLIC] = "ru",
+  [SW_SCRIPT_ARMENIAN] = "hy",
+  [SW_SCRIPT_HEBREW] = "he",
+  [SW_SCRIPT_ARABIC] = "ar",
+  [SW_SCRIPT_DEVANAGARI] = "hi",
+  [SW_SCRIPT_THAI] = "th",
+  [SW_SCRIPT_GEORGIAN] = "ka",
+  [SW_SCRIPT_HANGUL] = "ko",
+  [SW_SCRIPT_KANA] = "ja",
+  [SW_SCRIPT_HAN] = "zh",
+};
+
+// Return the router's generation, which swRouterCancel changes.
+static uint32_t currentGeneration(swRouter router) {
+  return __atomic_load_n(&router->generation, __ATOMIC_SEQ_CST);
+}
+
+// Free a group and its buffered audio.
+static void freeGroup(swGroup group) {
+  for (uint32_t i = 0; i < group->numRuns; i++) {
+    swFree(group->runs[i].samples);
+  }
+  swFree(group->runs);
+  swFree(group);
+}
+
+// Play the buffered audio of a group from its head, and of the groups after it
+// once it is done.  Stop at a run that is still being synthesized; its worker
+// plays the rest.  Call with the group mutex held, and the group's flushing
+// flag set.  The mutex is released.
+static void flushGroups(swRouter router, swGroup group) {
+  while (group != NULL) {
+    bool stale = group->generation != currentGeneration(router);
+    while (group->head < group->numRuns) {
+      swRun run = group->runs + group->head;
+      if (run->numSamples != 0) {
+        int16_t *samples = run->samples;
+        uint32_t numSamples = run->numSamples;
+        run->samples = NULL;
+        run->numSamples = 0;
+        run->allocatedSamples = 0;
+        pthread_mutex_unlock(&router->groupMutex);
+        if (!stale) {
+          router->callback(run->engine, samples, numSamples, false, router->callbackContext);
+        }
+        swFree(samples);
+        pthread_mutex_lock(&router->groupMutex);
+      } else if (run->done) {
+        group->head++;
+      } else {
+        group->flushing = false;
+        pthread_mutex_unlock(&router->groupMutex);
+        return;
+      }
+    }
+    pthread_mutex_unlock(&router->groupMutex);
+    router->callback(group->runs[group->numRuns - 1].engine, NULL, 0, stale,
+        router->callbackContext);
+    pthread_mutex_lock(&router->groupMutex);
+    // Groups queued until now wait for this one, with their flushing flag set.
+    swGroup nextGroup = group->next;
+    if (router->lastGroup == group) {
+      router->lastGroup = NULL;
+    }
+    freeGroup(group);
+    group = nextGroup;
+  }
+  pthread_mutex_unlock(&router->groupMutex);
+}
+
+// Pass a run's samples to the callback if it is the head of its group, and
+// otherwise buffer them.  Return true to cancel.
+static bool runAudio(swWorker *worker, int16_t *samples, uint32_t numSamples, bool cancel) {
+  swRouter router = worker->router;
+  swRun run = worker->run;
+  swGroup group = run->group;
+  pthread_mutex_lock(&router->groupMutex);
+  if (group->runs + group->head == run && !group->flushing) {
+    pthread_mutex_unlock(&router->groupMutex);
+    return router->callback(worker->engine, samples, numSamples, cancel,
+        router->callbackContext);
+  }
+  if (run->numSamples + numSamples > run->allocatedSamples) {
+    run->allocatedSamples = (run->numSamples + numSamples) << 1;
+    run->samples = swRealloc(run->samples, run->allocatedSamples, sizeof(int16_t));
+  }
+  memcpy(run->samples + run->numSamples, samples, numSamples * sizeof(int16_t));
+  run->numSamples += numSamples;
+  pthread_mutex_unlock(&router->groupMutex);
+  return false;
+}
+
+// Mark a run done, and if it was the head of its group, play what follows it.
+static void finishRun(swRouter router, swRun run) {
+  swGroup group = run->group;
+  pthread_mutex_lock(&router->groupMutex);
+  run->done = true;
+  if (group->runs + group->head == run && !group->flushing) {
+    group->flushing = true;
+    flushGroups(router, group);
+  } else {
+    pthread_mutex_unlock(&router->groupMutex);
+  }
+}
+
+// Convert samples to the router's rate and pass them on, and count them.  The
+// end of each request is reported by the worker, since a character it cannot
+// speak is passed on.
+static bool workerCallback(swEngine engine, int16_t *samples, uint32_t numSamples,
+    bool cancel, void *callbackContext) {
+  swWorker *worker = callbackContext;
+  swRouter router = worker->router;
+  bool stale = worker->generation != currentGeneration(router);
+  if (numSamples == 0) {
+    return stale;
+  }
+  worker->numSamples += numSamples;
+  numSamples = swResample(worker->resampler, samples, numSamples, &samples);
+  if (numSamples == 0) {
+    return stale;
+  }
+  bool cancelled;
+  if (worker->run != NULL) {
+    cancelled = runAudio(worker, samples, numSamples, cancel || stale);
+  } else {
+    cancelled = router->callback(engine, samples, numSamples, cancel || stale,
+        router->callbackContext);
+  }
+  return cancelled || stale;
+}
+
+// Find the worker for a route.  If its engine did not start, or charOnly is set
+// and it cannot speak characters, or refused this one, as marked in
+// refusedRoutes, try the later routes, and then the earlier ones.  Call with
+// the mutex held.
+static swWorker *findWorker(swRouter router, swRoute route, bool charOnly,
+    uint32_t refusedRoutes) {
+  for (uint32_t i = 0; i < SW_NUM_ROUTES; i++) {
+    int32_t r = route + i < SW_NUM_ROUTES? route + i : SW_NUM_ROUTES - 1 - i;
+    swWorker *worker = router->workers[r];
+    if (worker->engine != NULL && !(charOnly && (worker->lacksChar ||
+        (refusedRoutes & (1 << r)) != 0))) {
+      return worker;
+    }
+  }
+  return NULL;
+}
+
+// Return true if a language code, like "zh-cn", is the given language, like
+// "zh" or "zh-cn".
+static bool sameLanguage(const char *code, const char *languageCode) {
+  size_t length = strlen(languageCode);
+  return !strncasecmp(code, languageCode, length) &&
+      (code[length] == '\0' || code[length] == '-');
+}
+
+// Find the worker added for a language, or return NULL.
+static swWorker *findLanguageWorker(swRouter router, const char *languageCode) {
+  if (languageCode == NULL) {
+    return NULL;
+  }
+  for (uint32_t i = SW_NUM_ROUTES; i < router->numWorkers; i++) {
+    swWorker *worker = router->workers[i];
+    if (sameLanguage(worker->languageCode, languageCode)) {
+      return worker;
+    }
+  }
+  return NULL;
+}
+
+// Create a request.
+static swRequest createRequest(swRequestType type, const char *text, size_t bytes) {
+  swRequest request = swCalloc(1, sizeof(struct swRequestSt));
+  request->type = type;
+  if (text != NULL) {
+    request->text = swCalloc(bytes + 1, sizeof(char));
+    memcpy(request->text, text, bytes);
+    request->bytes = bytes;
+  }
+  return request;
+}
+
+// Free a request.
+static void freeRequest(swRequest request) {
+  swFree(request->text);
+  swFree(request);
+}
+
+// Add a request to a worker's queue, at the front if urgent.  Call with the
+// mutex held.
+static void addRequest(swWorker *worker, swRequest request, bool urgent) {
+  if (worker->firstRequest == NULL) {
+    worker->firstRequest = request;
+    worker->lastRequest = request;
+  } else if (urgent) {
+    request->next = worker->firstRequest;
+    worker->firstRequest = request;
+  } else {
+    worker->lastRequest->next = request;
+    worker->lastRequest = request;
+  }
+  pthread_cond_broadcast(&worker->router->cond);
+}
+
+// Queue a character on the first engine that can speak characters.  If none
+// can, speak it as text on the character route's engine.  Call with the mutex
+// held.
+static bool routeChar(swRouter router, swRequest request, bool urgent) {
+  swWorker *worker = findWorker(router, SW_ROUTE_CHAR, true, request->refusedRoutes);
+  if (worker == NULL) {
+    worker = findWorker(router, SW_ROUTE_CHAR, false, 0);
+    if (worker == NULL) {
+      freeRequest(request);
+      return false;
+    }
+    request->type = SW_REQUEST_SPEAK;
+    request->isUTF8 = true;
+  }
+  addRequest(worker, request, urgent);
+  return true;
+}
+
+// Queue a copy of a setting request on every engine.
+static void addSetting(swRouter router, swRequest setting) {
+  pthread_mutex_lock(&router->mutex);
+  for (uint32_t i = 0; i < router->numWorkers; i++) {
+    swWorker *worker = router->workers[i];
+    if (worker->engine != NULL) {
+      swRequest request = createRequest(setting->type, setting->text, setting->bytes);
+      request->value = setting->value;
+      request->level = setting->level;
+      addRequest(worker, request, false);
+    }
+  }
+  pthread_mutex_unlock(&router->mutex);
+  freeRequest(setting);
+}
+
+// Speak a request's text or character.  Return false if it was a character the
+// engine could not speak, and was passed on to another engine.
+static bool speakRequest(swWorker *worker, swRequest request) {
+  swRouter router = worker->router;
+  swEngine engine = worker->engine;
+  worker->generation = request->generation;
+  worker->run = request->run;
+  worker->numSamples = 0;
+  swResamplerReset(worker->resampler);
+  if (request->type == SW_REQUEST_SPEAK) {
+    swSpeak(engine, request->text, request->isUTF8);
+  } else {
+    bool spoken = swSpeakChar(engine, request->text, request->bytes);
+    // The engine says whether it could speak the character.  Pico cannot speak
+    // any, and ibmtts only ANSI ones.  A false result after a cancel is not a
+    // refusal.
+    if (!spoken && request->generation == currentGeneration(router)) {
+      pthread_mutex_lock(&router->mutex);
+      request->refusedRoutes |= 1 << worker->route;
+      if (request->bytes == 1 && isalnum((uint8_t)request->text[0])) {
+        swLogDebug("Route %u cannot speak characters\n", worker->route);
+        worker->lacksChar = true;
+      }
+      // This engine is still there to speak it as text, so this succeeds.
+      routeChar(router, request, true);
+      pthread_mutex_unlock(&router->mutex);
+      return false;
+    }
+  }
+  worker->run = NULL;
+  return true;
+}
+
+// Run one request on the worker's engine.  Return false if it was a character
+// the engine could not speak, and was passed on to another engine.
+static bool runRequest(swWorker *worker, swRequest request) {
+  swRouter router = worker->router;
+  swEngine engine = worker->engine;
+  switch (request->type) {
+  case SW_REQUEST_SPEAK:
+  case SW_REQUEST_CHAR:
+    break;
+  case SW_REQUEST_SPEED:
+    swSetSpeed(engine, request->value);
+    return true;
+  case SW_REQUEST_PITCH:
+    swSetPitch(engine, request->value);
+    return true;
+  case SW_REQUEST_PUNCTUATION:
+    swSetPunctuation(engine, request->level);
+    return true;
+  case SW_REQUEST_VOICE:
+    swSetVoice(engine, request->text);
+    return true;
+  }
+  bool stale = request->generation != currentGeneration(router);
+  if (!stale && !speakRequest(worker, request)) {
+    return false;
+  }
+  if (request->run != NULL) {
+    // Runs of cancelled groups still finish, so the groups are freed.
+    finishRun(router, request->run);
+  } else if (!stale) {
+    router->callback(engine, NULL, 0, worker->generation != currentGeneration(router),
+        router->callbackContext);
+  }
+  return true;
+}
+
+// Run the worker's requests until the router stops and the queue is empty.
+static void *runWorker(void *arg) {
+  swWorker *worker = arg;
+  swRouter router = worker->router;
+  pthread_mutex_lock(&router->mutex);
+  while (true) {
+    while (!router->stopping && worker->firstRequest == NULL) {
+      pthread_cond_wait(&router->cond, &router->mutex);
+    }
+    if (worker->firstRequest == NULL) {
+      break;
+    }
+    swRequest request = worker->firstRequest;
+    worker->firstRequest = request->next;
+    request->next = NULL;
+    worker->busy = true;
+    pthread_mutex_unlock(&router->mutex);
+    if (runRequest(worker, request)) {
+      freeRequest(request);
+    }
+    pthread_mutex_lock(&router->mutex);
+    worker->busy = false;
+    pthread_cond_broadcast(&router->cond);
+  }
+  pthread_mutex_unlock(&router->mutex);
+  return NULL;
+}
+
+// Read the short message length from SW_SHORT_MESSAGE_LEN.
+static size_t readShortLength(void) {
+  const char *value = getenv("SW_SHORT_MESSAGE_LEN");
+  if (value == NULL) {
+    return SW_DEFAULT_SHORT_MESSAGE_LEN;
+  }
+  char *end;
+  long length = strtol(value, &end, 10);
+  if (*value == '\0' || *end != '\0' || length < 0) {
+    swLogWarn("Ignoring invalid SW_SHORT_MESSAGE_LEN: %s\n", value);
+    return SW_DEFAULT_SHORT_MESSAGE_LEN;
+  }
+  return length;
+}
+
+// Create a worker and start its engine.  Its thread is started by startWorker.
+static swWorker *createWorker(swRouter router, const char *libDirectory,
+    const char *engineName, swRoute route) {
+  swWorker *worker = swCalloc(1, sizeof(swWorker));
+  worker->router = router;
+  worker->route = route;
+  worker->engine = swStart(libDirectory, engineName, workerCallback, worker);
+  if (worker->engine == NULL) {
+    swLogWarn("Unable to start engine %s\n", engineName);
+    return worker;
+  }
+  worker->voices = swListVoices(worker->engine, &worker->numVoices);
+  return worker;
+}
+
+// Start a worker's thread, converting its engine's audio to the router's rate.
+// On failure, stop its engine.
+static bool startWorker(swWorker *worker) {
+  swRouter router = worker->router;
+  worker->resampler = swResamplerCreate(swGetSampleRate(worker->engine), router->sampleRate);
+  if (pthread_create(&worker->thread, NULL, runWorker, worker) != 0) {
+    swLogWarn("Unable to start a thread for route %u\n", worker->route);
+    swResamplerFree(worker->resampler);
+    worker->resampler = NULL;
+    swFreeStringList(worker->voices, worker->numVoices);
+    worker->voices = NULL;
+    swStop(worker->engine);
+    worker->engine = NULL;
+    return false;
+  }
+  return true;
+}
+
+// Start a router with an engine for each route.
+swRouter swRouterStart(const char *libDirectory, const char *engineNames[SW_NUM_ROUTES],
+    swCallback callback, void *callbackContext) {
+  const char *firstName = NULL;
+  for (uint32_t r = 0; r < SW_NUM_ROUTES && firstName == NULL; r++) {
+    firstName = engineNames[r];
+  }
+  if (firstName == NULL) {
+    swLogWarn("swRouterStart: No engines named\n");
+    return NULL;
+  }
+  swRouter router = swCalloc(1, sizeof(struct swRouterSt));
+  router->libDirectory = libDirectory != NULL? swCopyString(libDirectory) : NULL;
+  router->callback = callback;
+  router->callbackContext = callbackContext;
+  router->shortLength = readShortLength();
+  router->speed = 1.0f;
+  router->pitch = 1.0f;
+  for (uint32_t s = 0; s < SW_NUM_SCRIPTS; s++) {
+    if (defaultScriptLanguages[s] != NULL) {
+      router->scriptLanguages[s] = swCopyString(defaultScriptLanguages[s]);
+    }
+  }
+  pthread_mutex_init(&router->mutex, NULL);
+  pthread_cond_init(&router->cond, NULL);
+  pthread_mutex_init(&router->groupMutex, NULL);
+  router->workers = swCalloc(SW_NUM_ROUTES, sizeof(swWorker *));
+  router->numWorkers = SW_NUM_ROUTES;
+  const char *name = firstName;
+  for (uint32_t r = 0; r < SW_NUM_ROUTES; r++) {
+    if (engineNames[r] != NULL) {
+      name = engineNames[r];
+    }
+    swWorker *worker = createWorker(router, libDirectory, name, r);
+    router->workers[r] = worker;
+    // Play everything at the highest rate, so no engine loses quality.
+    if (worker->engine != NULL && swGetSampleRate(worker->engine) > router->sampleRate) {
+      router->sampleRate = swGetSampleRate(worker->engine);
+    }
+  }
+  bool started = false;
+  for (uint32_t r = 0; r < SW_NUM_ROUTES; r++) {
+    swWorker *worker = router->workers[r];
+    if (worker->engine != NULL && startWorker(worker)) {
+      started = true;
+    }
+  }
+  if (!started) {
+    swRouterStop(router);
+    return NULL;
+  }
+  return router;
+}
+
+// Start an engine for a language.
+bool swRouterAddLanguage(swRouter router, const char *languageCode, const char *engineName,
+    const char *voice) {
+  swWorker *worker = createWorker(router, router->libDirectory, engineName, SW_NUM_ROUTES);
+  if (worker->engine == NULL) {
+    swFree(worker);
+    return false;
+  }
+  worker->languageCode = swCopyString(languageCode);
+  if (voice == NULL) {
+    for (uint32_t i = 0; i < worker->numVoices && voice == NULL; i++) {
+      const char *code = strrchr(worker->voices[i], ',');
+      if (code != NULL && sameLanguage(code + 1, languageCode)) {
+        voice = worker->voices[i];
+      }
+    }
+    if (voice == NULL) {
+      swLogWarn("Engine %s has no voice for %s\n", engineName, languageCode);
+    }
+  }
+  if (voice != NULL && !swSetVoice(worker->engine, voice)) {
+    swLogWarn("Engine %s rejected voice %s\n", engineName, voice);
+    swFreeStringList(worker->voices, worker->numVoices);
+    swStop(worker->engine);
+    swFree(worker->languageCode);
+    swFree(worker);
+    return false;
+  }
+  swSetSpeed(worker->engine, router->speed);
+  swSetPitch(worker->engine, router->pitch);
+  if (router->punctuationSet) {
+    swSetPunctuation(worker->engine, router->punctuation);
+  }
+  if (!startWorker(worker)) {
+    swFree(worker->languageCode);
+    swFree(worker);
+    return false;
+  }
+  pthread_mutex_lock(&router->mutex);
+  router->workers = swRealloc(router->workers, router->numWorkers + 1, sizeof(swWorker *));
+  router->workers[router->numWorkers++] = worker;
+  pthread_mutex_unlock(&router->mutex);
+  return true;
+}
+
+// Set the language spoken for text in a script.
+void swRouterSetScriptLanguage(swRouter router, swScript script, const char *languageCode) {
+  if (script >= SW_NUM_SCRIPTS) {
+    return;
+  }
+  pthread_mutex_lock(&router->mutex);
+  swFree(router->scriptLanguages[script]);
+  router->scriptLanguages[script] = languageCode != NULL? swCopyString(languageCode) : NULL;
+  pthread_mutex_unlock(&router->mutex);
+}
+
+// Drop a worker's queued speech, keeping its settings.  Runs of groups are kept,
+// and skipped by the worker, so their groups finish.  Call with the mutex held.
+static void dropSpeech(swWorker *worker) {
+  swRequest prevRequest = NULL;
+  swRequest request = worker->firstRequest;
+  while (request != NULL) {
+    swRequest nextRequest = request->next;
+    if ((request->type == SW_REQUEST_SPEAK || request->type == SW_REQUEST_CHAR) &&
+        request->run == NULL) {
+      if (prevRequest == NULL) {
+        worker->firstRequest = nextRequest;
+      } else {
+        prevRequest->next = nextRequest;
+      }
+      freeRequest(request);
+    } else {
+      prevRequest = request;
+    }
+    request = nextRequest;
+  }
+  worker->lastRequest = prevRequest;
+}
+
+// Cancel all speech, stop the engines and free the router.
+void swRouterStop(swRouter router) {
+  swRouterCancel(router);
+  pthread_mutex_lock(&router->mutex);
+  router->stopping = true;
+  pthread_cond_broadcast(&router->cond);
+  pthread_mutex_unlock(&router->mutex);
+  for (uint32_t i = 0; i < router->numWorkers; i++) {
+    swWorker *worker = router->workers[i];
+    if (worker->engine != NULL) {
+      // The worker finishes its queue, which is only settings and cancelled runs.
+      pthread_join(worker->thread, NULL);
+      swResamplerFree(worker->resampler);
+      swFreeStringList(worker->voices, worker->numVoices);
+      swStop(worker->engine);
+    }
+    swFree(worker->languageCode);
+    swFree(worker);
+  }
+  for (uint32_t s = 0; s < SW_NUM_SCRIPTS; s++) {
+    swFree(router->scriptLanguages[s]);
+  }
+  swFree(router->workers);
+  swFree(router->libDirectory);
+  pthread_mutex_destroy(&router->groupMutex);
+  pthread_cond_destroy(&router->cond);
+  pthread_mutex_destroy(&router->mutex);
+  swFree(router);
+}
+
+// Split text into runs by script, and find the worker for each.  Runs in a
+// row for the same worker are joined.  Return the number of runs.  Call with
+// the mutex held.
+static uint32_t splitText(swRouter router, const char *text, size_t bytes,
+    swWorker *defaultWorker, swScriptRun **runs, swWorker ***runWorkers) {
+  uint32_t numRuns = swSplitScripts(text, bytes, runs);
+  swWorker **workers = swCalloc(numRuns, sizeof(swWorker *));
+  uint32_t numJoined = 0;
+  for (uint32_t i = 0; i < numRuns; i++) {
+    swScriptRun *run = *runs + i;
+    swWorker *worker = findLanguageWorker(router, router->scriptLanguages[run->script]);
+    if (worker == NULL) {
+      worker = defaultWorker;
+    }
+    if (numJoined > 0 && workers[numJoined - 1] == worker) {
+      (*runs)[numJoined - 1].length += run->length;
+    } else {
+      (*runs)[numJoined] = *run;
+      workers[numJoined++] = worker;
+    }
+  }
+  *runWorkers = workers;
+  return numJoined;
+}
+
+// Queue the runs of text in several languages as a group.  Call with the mutex
+// held.
+static void addGroup(swRouter router, const char *text, bool isUTF8, swScriptRun *runs,
+    swWorker **workers, uint32_t numRuns) {
+  swGroup group = swCalloc(1, sizeof(struct swGroupSt));
+  group->runs = swCalloc(numRuns, sizeof(struct swRunSt));
+  group->numRuns = numRuns;
+  group->generation = router->generation;
+  for (uint32_t i = 0; i < numRuns; i++) {
+    swRun run = group->runs + i;
+    run->group = group;
+    run->engine = workers[i]->engine;
+    swRequest request = createRequest(SW_REQUEST_SPEAK, text + runs[i].start, runs[i].length);
+    request->isUTF8 = isUTF8;
+    request->generation = group->generation;
+    request->run = run;
+    addRequest(workers[i], request, false);
+  }
+  pthread_mutex_lock(&router->groupMutex);
+  if (router->lastGroup != NULL) {
+    // Wait for the group before to finish playing.
+    router->lastGroup->next = group;
+    group->flushing = true;
+  }
+  router->lastGroup = group;
+  pthread_mutex_unlock(&router->groupMutex);
+}
+
+// Queue text for the short or long message engine, or split it by language.
+bool swRouterSpeak(swRouter router, const char *text, bool isUTF8) {
+  size_t bytes = strlen(text);
+  swRoute route = bytes <= router->shortLength? SW_ROUTE_SHORT : SW_ROUTE_LONG;
+  pthread_mutex_lock(&router->mutex);
+  swWorker *worker = findWorker(router, route, false, 0);
+  if (worker == NULL) {
+    pthread_mutex_unlock(&router->mutex);
+    return false;
+  }
+  if (router->numWorkers > SW_NUM_ROUTES && bytes != 0) {
+    // Text in one run is queued as a group too, so its audio is not passed to
+    // the callback before that of groups queued earlier.
+    swScriptRun *runs;
+    swWorker **workers;
+    uint32_t numRuns;
+    if (isUTF8) {
+      numRuns = splitText(router, text, bytes, worker, &runs, &workers);
+    } else {
+      runs = swCalloc(1, sizeof(swScriptRun));
+      runs->length = bytes;
+      workers = swCalloc(1, sizeof(swWorker *));
+      workers[0] = worker;
+      numRuns = 1;
+    }
+    if (numRuns != 0) {
+      addGroup(router, text, isUTF8, runs, workers, numRuns);
+    }
+    swFree(runs);
+    swFree(workers);
+    if (numRuns != 0) {
+      pthread_mutex_unlock(&router->mutex);
+      return true;
+    }
+  }
+  swRequest request = createRequest(SW_REQUEST_SPEAK, text, bytes);
+  request->isUTF8 = isUTF8;
+  request->generation = router->generation;
+  addRequest(worker, request, false);
+  pthread_mutex_unlock(&router->mutex);
+  return true;
+}
+
+// Queue one UTF-8 character for the character engine.
+bool swRouterSpeakChar(swRouter router, const char *utf8Char, size_t bytes) {
+  swRequest request = createRequest(SW_REQUEST_CHAR, utf8Char, bytes);
+  pthread_mutex_lock(&router->mutex);
+  request->generation = router->generation;
+  bool result = routeChar(router, request, false);
+  pthread_mutex_unlock(&router->mutex);
+  return result;
+}
+
+// Cancel all queued and playing speech on every engine.
+void swRouterCancel(swRouter router) {
+  pthread_mutex_lock(&router->mutex);
+  __atomic_add_fetch(&router->generation, 1, __ATOMIC_SEQ_CST);
+  for (uint32_t i = 0; i < router->numWorkers; i++) {
+    dropSpeech(router->workers[i]);
+  }
+  pthread_mutex_unlock(&router->mutex);
+}
+
+// Wait until every engine has finished its queue.
+void swRouterWait(swRouter router) {
+  pthread_mutex_lock(&router->mutex);
+  bool idle = false;
+  while (!idle) {
+    idle = true;
+    for (uint32_t i = 0; i < router->numWorkers; i++) {
+      swWorker *worker = router->workers[i];
+      if (worker->busy || worker->firstRequest != NULL) {
+        idle = false;
+      }
+    }
+    if (!idle) {
+      pthread_cond_wait(&router->cond, &router->mutex);
+    }
+  }
+  pthread_mutex_unlock(&router->mutex);
+}
+
+// Return the engine speaking a route.
+swEngine swRouterGetEngine(swRouter router, swRoute route) {
+  pthread_mutex_lock(&router->mutex);
+  swWorker *worker = findWorker(router, route, false, 0);
+  pthread_mutex_unlock(&router->mutex);
+  return worker != NULL? worker->engine : NULL;
+}
+
+// Return the sample rate of audio passed to the callback.
+uint32_t swRouterGetSampleRate(swRouter router) {
+  return router->sampleRate;
+}
+
+// Set the speed on every engine.
+void swRouterSetSpeed(swRouter router, float speed) {
+  router->speed = speed;
+  swRequest request = createRequest(SW_REQUEST_SPEED, NULL, 0);
+  request->value = speed;
+  addSetting(router, request);
+}
+
+// Set the pitch on every engine.
+void swRouterSetPitch(swRouter router, float pitch) {
+  router->pitch = pitch;
+  swRequest request = createRequest(SW_REQUEST_PITCH, NULL, 0);
+  request->value = pitch;
+  addSetting(router, request);
+}
+
+// Set the punctuation level on every engine.
+void swRouterSetPunctuation(swRouter router, swPunctuationLevel level) {
+  router->punctuation = level;
+  router->punctuationSet = true;
+  swRequest request = createRequest(SW_REQUEST_PUNCTUATION, NULL, 0);
+  request->level = level;
+  addSetting(router, request);
+}
+
+// Select the first voice of each route's engine that speaks the language.
+bool swRouterSetLanguage(swRouter router, const char *languageCode) {
+  bool found = false;
+  for (uint32_t r = 0; r < SW_NUM_ROUTES; r++) {
+    swWorker *worker = router->workers[r];
+    if (worker->engine == NULL) {
+      continue;
+    }
+    for (uint32_t i = 0; i < worker->numVoices; i++) {
+      const char *code = strrchr(worker->voices[i], ',');
+      if (code != NULL && sameLanguage(code + 1, languageCode)) {
+        swRouterSetVoice(router, r, worker->voices[i]);
+        found = true;
+        break;
+      }
+    }
+  }
+  return found;
+}
+
+// Select a voice on one route's engine.
+void swRouterSetVoice(swRouter router, swRoute route, const char *voice) {
+  swRequest request = createRequest(SW_REQUEST_VOICE, voice, strlen(voice));
+  pthread_mutex_lock(&router->mutex);
+  swWorker *worker = findWorker(router, route, false, 0);
+  if (worker != NULL) {
+    addRequest(worker, request, false);
+  } else {
+    freeRequest(request);
+  }
+  pthread_mutex_unlock(&router->mutex);
+}
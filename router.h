@@ -0,0 +1,96 @@
+// Routing speech to several engines by latency class and language.
+//
+// A screen reader wants different engines for different jobs: a fast formant
+// synth like espeak to echo keys, and a slower, nicer one like Voxin to read
+// text.  A router starts one engine for each class of request: single
+// characters, short messages, and long text.  Each engine has its own thread
+// and queue, so the engines run concurrently, and a key echo never waits behind
+// a paragraph.  The same engine may be named for several classes; each class
+// still gets its own engine process.
+//
+// If a class's engine fails to start, or cannot speak single characters, like
+// pico, its requests fall back to the next class, and then the one before.
+// Speed, pitch, punctuation and language are set on every engine, so they stay
+// as consistent as the engines allow.
+//
+// Engines can also be added for languages.  Text is then split into runs by
+// script, see script.h, and each run in a language with an engine goes to that
+// engine, and the rest to the short or long message engine.  The runs are
+// synthesized in parallel, and their audio is passed to the callback in order.
+// Once a language has an engine, all text passed to swRouterSpeak is queued this
+// way, so its audio follows that of text queued before it.  All audio is
+// converted to the highest sample rate of the routes' engines.
+
+#ifndef SW_ROUTER_H
+#define SW_ROUTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "script.h"
+#include "speechsw.h"
+
+// Text up to this many bytes is a short message, unless SW_SHORT_MESSAGE_LEN is
+// set in the environment.
+#define SW_DEFAULT_SHORT_MESSAGE_LEN 80
+
+typedef enum {
+  SW_ROUTE_CHAR,
+  SW_ROUTE_SHORT,
+  SW_ROUTE_LONG,
+  SW_NUM_ROUTES
+} swRoute;
+
+typedef struct swRouterSt *swRouter;
+
+// Start a router with the engine named for each route, indexed by swRoute.  A
+// NULL name uses the engine of the previous route, or of the first one named.
+// The callback is called from the engines' threads, so calls for different
+// engines overlap, and the engine passed to it tells which one the samples are
+// from.  As with swStart, it gets 0 samples at the end of each request, or of
+// all the runs of split text.  Return NULL if no engine starts.
+swRouter swRouterStart(const char *libDirectory, const char *engineNames[SW_NUM_ROUTES],
+    swCallback callback, void *callbackContext);
+// Cancel all speech, stop the engines and free the router.
+void swRouterStop(swRouter router);
+// Queue text for the short or long message engine, depending on its length, and
+// return without waiting.  UTF-8 text with runs in languages that have engines
+// is split between them.
+bool swRouterSpeak(swRouter router, const char *text, bool isUTF8);
+// Queue one UTF-8 character for the character engine, and return without
+// waiting.
+bool swRouterSpeakChar(swRouter router, const char *utf8Char, size_t bytes);
+// Cancel all queued and playing speech on every engine.  Settings still queued
+// are applied.
+void swRouterCancel(swRouter router);
+// Wait until every engine has finished its queue.
+void swRouterWait(swRouter router);
+// Return the engine speaking a route.  Only call swEngine functions on it
+// between swRouterWait and the next request.
+swEngine swRouterGetEngine(swRouter router, swRoute route);
+// Return the sample rate of audio passed to the callback.
+uint32_t swRouterGetSampleRate(swRouter router);
+// Start an engine for text in a language, like "zh".  If voice is NULL, the
+// engine's first voice for the language is used.  Return false if the engine
+// fails to start, or does not list the voice.
+bool swRouterAddLanguage(swRouter router, const char *languageCode, const char *engineName,
+    const char *voice);
+// Set the language of text in a script, or NULL to speak it on the routes.  By
+// default, Latin text is spoken on the routes, Han is "zh", kana is "ja",
+// Hangul is "ko", Cyrillic is "ru", and so on.
+void swRouterSetScriptLanguage(swRouter router, swScript script, const char *languageCode);
+// Set the speed on every engine, as a factor of its default speed.
+void swRouterSetSpeed(swRouter router, float speed);
+// Set the pitch on every engine, as a factor of its default pitch.
+void swRouterSetPitch(swRouter router, float pitch);
+// Set the punctuation level on every engine.
+void swRouterSetPunctuation(swRouter router, swPunctuationLevel level);
+// Select the first voice of each engine that speaks the language, like "en" or
+// "en-us".  Engines with no such voice keep their voice.  Return false if no
+// engine has one.
+bool swRouterSetLanguage(swRouter router, const char *languageCode);
+// Select a voice on one route's engine.
+void swRouterSetVoice(swRouter router, swRoute route, const char *voice);
+
+#endif  // SW_ROUTER_H
@@ -0,0 +1,149 @@
+// Split text into runs of one Unicode script.  See script.h.
+//
+// Scripts are found with a binary search of the blocks below.  Only the
+// scripts that engines have voices for are listed, and everything else,
+// including symbols and scripts not listed, is common.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "script.h"
+#include "util.h"
+
+typedef struct {
+  uint32_t first;
+  uint32_t last;
+  swScript script;
+} swScriptRange;
+
+// Sorted, non-overlapping blocks of letters.
+static const swScriptRange scriptRanges[] = {
+  {0x00c0, 0x00d6, SW_SCRIPT_LATIN},
+  {0x00d8, 0x00f6, SW_SCRIPT_LATIN},
+  {0x00f8, 0x024f, SW_SCRIPT_LATIN},
+  {0x0370, 0x03ff, SW_SCRIPT_GREEK},
+  {0x0400, 0x052f, SW_SCRIPT_CYRILLIC},
+  {0x0531, 0x058f, SW_SCRIPT_ARMENIAN},
+  {0x0591, 0x05ff, SW_SCRIPT_HEBREW},
+  {0x0600, 0x06ff, SW_SCRIPT_ARABIC},
+  {0x0750, 0x077f, SW_SCRIPT_ARABIC},
+  {0x0900, 0x097f, SW_SCRIPT_DEVANAGARI},
+  {0x0e00, 0x0e7f, SW_SCRIPT_THAI},
+  {0x10a0, 0x10ff, SW_SCRIPT_GEORGIAN},
+  {0x1100, 0x11ff, SW_SCRIPT_HANGUL},
+  {0x1e00, 0x1eff, SW_SCRIPT_LATIN},
+  {0x1f00, 0x1fff, SW_SCRIPT_GREEK},
+  {0x2e80, 0x2fdf, SW_SCRIPT_HAN},
+  {0x3005, 0x3007, SW_SCRIPT_HAN},
+  {0x3041, 0x30ff, SW_SCRIPT_KANA},
+  {0x3131, 0x318f, SW_SCRIPT_HANGUL},
+  {0x31f0, 0x31ff, SW_SCRIPT_KANA},
+  {0x3400, 0x4dbf, SW_SCRIPT_HAN},
+  {0x4e00, 0x9fff, SW_SCRIPT_HAN},
+  {0xac00, 0xd7af, SW_SCRIPT_HANGUL},
+  {0xf900, 0xfaff, SW_SCRIPT_HAN},
+  {0xff66, 0xff9f, SW_SCRIPT_KANA},
+  {0x20000, 0x2ffff, SW_SCRIPT_HAN},
+};
+
+static const char *scriptNames[SW_NUM_SCRIPTS] = {
+  "Common", "Latin", "Greek", "Cyrillic", "Armenian", "Hebrew", "Arabic",
+  "Devanagari", "Thai", "Georgian", "Hangul", "Kana", "Han"
+};
+
+// Return the script of a character.
+swScript swGetScript(uint32_t unicodeChar) {
+  if (unicodeChar < 0x80) {
+    uint32_t lower = unicodeChar | 0x20;
+    return lower >= 'a' && lower <= 'z'? SW_SCRIPT_LATIN : SW_SCRIPT_COMMON;
+  }
+  uint32_t low = 0;
+  uint32_t high = sizeof(scriptRanges)/sizeof(scriptRanges[0]);
+  while (low < high) {
+    uint32_t mid = (low + high) >> 1;
+    const swScriptRange *range = scriptRanges + mid;
+    if (unicodeChar < range->first) {
+      high = mid;
+    } else if (unicodeChar > range->last) {
+      low = mid + 1;
+    } else {
+      return range->script;
+    }
+  }
+  return SW_SCRIPT_COMMON;
+}
+
+// Return the name of a script.
+const char *swGetScriptName(swScript script) {
+  return script < SW_NUM_SCRIPTS? scriptNames[script] : "Unknown";
+}
+
+// Make Han runs next to kana into kana, and join neighbouring runs of the same
+// script.  Return the new number of runs.
+static uint32_t mergeRuns(swScriptRun *runs, uint32_t numRuns) {
+  for (uint32_t i = 0; i < numRuns; i++) {
+    if (runs[i].script == SW_SCRIPT_HAN &&
+        ((i > 0 && runs[i - 1].script == SW_SCRIPT_KANA) ||
+        (i + 1 < numRuns && runs[i + 1].script == SW_SCRIPT_KANA))) {
+      runs[i].script = SW_SCRIPT_KANA;
+    }
+  }
+  uint32_t numMerged = 0;
+  for (uint32_t i = 0; i < numRuns; i++) {
+    if (numMerged > 0 && runs[numMerged - 1].script == runs[i].script) {
+      runs[numMerged - 1].length += runs[i].length;
+    } else {
+      runs[numMerged++] = runs[i];
+    }
+  }
+  return numMerged;
+}
+
+// Split UTF-8 text into runs of one script.
+uint32_t swSplitScripts(const char *text, size_t length, swScriptRun **runs) {
+  uint32_t allocatedRuns = 8;
+  uint32_t numRuns = 0;
+  swScriptRun *newRuns = swCalloc(allocatedRuns, sizeof(swScriptRun));
+  // Common characters before the first letter join the first run.
+  size_t leadingLength = 0;
+  size_t pos = 0;
+  while (pos < length) {
+    bool valid;
+    uint32_t unicodeChar = 0;
+    uint8_t charLength = swFindUTF8LengthAndValidate(text + pos, length - pos, &valid,
+        &unicodeChar);
+    swScript script = valid? swGetScript(unicodeChar) : SW_SCRIPT_COMMON;
+    if (script == SW_SCRIPT_COMMON) {
+      if (numRuns == 0) {
+        leadingLength += charLength;
+      } else {
+        newRuns[numRuns - 1].length += charLength;
+      }
+    } else if (numRuns > 0 && newRuns[numRuns - 1].script == script) {
+      newRuns[numRuns - 1].length += charLength;
+    } else {
+      if (numRuns == allocatedRuns) {
+        allocatedRuns <<= 1;
+        newRuns = swRealloc(newRuns, allocatedRuns, sizeof(swScriptRun));
+      }
+      swScriptRun *run = newRuns + numRuns++;
+      run->start = pos;
+      run->length = charLength;
+      run->script = script;
+      if (numRuns == 1) {
+        run->start = 0;
+        run->length += leadingLength;
+      }
+    }
+    pos += charLength;
+  }
+  if (numRuns == 0) {
+    newRuns[0].start = 0;
+    newRuns[0].length = length;
+    newRuns[0].script = SW_SCRIPT_COMMON;
+    numRuns = 1;
+  }
+  *runs = newRuns;
+  return mergeRuns(newRuns, numRuns);
+}
@@ -0,0 +1,47 @@
+// Splitting text into runs of one Unicode script.
+//
+// Mixed-language text, like a Chinese name in an English sentence, is best
+// spoken by a voice for each language.  The script of each character is a good
+// guess at its language.  Spaces, digits and punctuation are common to all
+// scripts, and join the run before them.  Han characters next to kana are
+// Japanese, so they join the kana run.
+
+#ifndef SW_SCRIPT_H
+#define SW_SCRIPT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum {
+  SW_SCRIPT_COMMON,
+  SW_SCRIPT_LATIN,
+  SW_SCRIPT_GREEK,
+  SW_SCRIPT_CYRILLIC,
+  SW_SCRIPT_ARMENIAN,
+  SW_SCRIPT_HEBREW,
+  SW_SCRIPT_ARABIC,
+  SW_SCRIPT_DEVANAGARI,
+  SW_SCRIPT_THAI,
+  SW_SCRIPT_GEORGIAN,
+  SW_SCRIPT_HANGUL,
+  SW_SCRIPT_KANA,
+  SW_SCRIPT_HAN,
+  SW_NUM_SCRIPTS
+} swScript;
+
+typedef struct {
+  size_t start;  // Byte offset of the run.
+  size_t length;  // Length of the run in bytes.
+  swScript script;
+} swScriptRun;
+
+// Return the script of a character.
+swScript swGetScript(uint32_t unicodeChar);
+// Return the name of a script, like "Latin".
+const char *swGetScriptName(swScript script);
+// Split UTF-8 text into runs, and return how many there are.  Text that is all
+// common characters is one SW_SCRIPT_COMMON run.  The caller frees *runs with
+// swFree.
+uint32_t swSplitScripts(const char *text, size_t length, swScriptRun **runs);
+
+#endif  // SW_SCRIPT_H
@@ -1,125 +1,253 @@
 // This interface provides a simple library for talking to the supported voice engines.
 
-#include <signal.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 #include <strings.h>  // For strcasecmp.
+#include <ctype.h>
+#include <dlfcn.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
-#include <sonic.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <time.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include "util.h"
 #include "speechsw.h"
+#include "arena.h"
+#include "dsp.h"
+#include "lexicon.h"
+#include "nfc.h"
+#include "plugin.h"
+#include "punct.h"
+#include "trace.h"
 
 #define MAX_TEXT_LENGTH (1 << 16)
-#define SAMPLE_BUFFER_SIZE 128
+#define SCRATCH_BLOCK_SIZE (1 << 14)
+#define DEFAULT_SCRATCH_LIMIT (1 << 16)
+#define LINE_BUFFER_SIZE 256
+// The most engine processes kept for different voices.
+#define MAX_PROCESSES 16
+// Every speak command starts with this, and queued ones add an id.
+#define SPEAK_HEADER "speak\n"
 #define MAX_LANGUAGE_CODE_LEN 4
+// The engine reads lines of up to 4094 bytes.  Lines sent to it are broken
+// after a space once they reach SOFT_LINE_LENGTH, and anywhere at
+// HARD_LINE_LENGTH.
+#define SOFT_LINE_LENGTH 2048
+#define HARD_LINE_LENGTH 4000
+// Bytes checked at once by the plain-text fast path.
+#define PLAIN_BLOCK_SIZE 16
+// Room for a stuffed dot and a line break, besides the text of one step.
+#define STEP_OVERHEAD 2
+// The most one step of the text pipeline writes: a punctuation name with a
+// space on each side, or a block of plain characters.
+#define MAX_STEP_SIZE (SW_PUNCT_MAX_NAME_LEN + 2 + STEP_OVERHEAD)
+
+// Settings kept by the client, and sent to the engine only when they change.
+typedef enum {
+  SW_SETTING_VOICE = 1 << 0,
+  SW_SETTING_VARIANT = 1 << 1,
+  SW_SETTING_SPEED = 1 << 2,
+  SW_SETTING_PITCH = 1 << 3,
+  SW_SETTING_SSML = 1 << 4
+} swSetting;
+
+// Values of the settings last sent to the engine.
+typedef struct {
+  char *voice;
+  char *variant;
+  float speed;
+  float pitch;
+  bool ssml;
+} swSettings;
+
+// An engine process.  The one in use is kept in the swEngine, and the others
+// are parked in its pool, each with the voice it was last sent.
+typedef struct {
+  FILE *fin;
+  FILE *fout;
+  int pid;
+  swSettings sentSettings;
+  uint32_t settingsSent;
+  uint64_t lastUsed;
+} swProcess;
+
+// Speech queued with swSpeakQueued, or a setting sent ahead of speech, that
+// the engine has not answered yet.  For speech, setting is 0.
+typedef struct {
+  uint32_t id;
+  swSetting setting;
+  bool cancelled;
+} swQueuedSpeech;
+
+// How an ASCII character is written to the engine.  A NULL text means the
+// character is copied.
+typedef struct {
+  const char *text;
+  uint32_t length;
+} swReplacement;
 
 struct swEngineSt {
   char *name;
   FILE *fin;
   FILE *fout;
+  // Set instead of fin and fout when the engine is loaded as a plugin.
+  void *pluginHandle;
+  const swPlugin *plugin;
+  // Set when the callback cancels a plugin's utterance.
+  bool pluginCancelled;
+  // Queued speech and settings the engine has not answered, in order.
+  swQueuedSpeech *queued;
+  uint32_t numQueued;
+  uint32_t queuedSize;
+  uint32_t nextSpeechId;
   swCallback callback;
   void *callbackContext;
-  sonicStream sonic;
-  int16_t *samples;
-  uint32_t sampleBufferSize;
+  // Post-processing of the engine's samples, including Sonic.
+  swDsp dsp;
+  // Scratch memory for the current utterance: the text sent to the engine,
+  // lines read back, and decoded samples.
+  swArena scratch;
+  size_t scratchLimit;
   char *textBuffer;
   uint32_t textBufferSize;
   uint32_t textBufferPos;
   uint32_t sampleRate;
+  swEncoding encoding;
   swPunctuationLevel punctuationLevel;
+  // How each ASCII character is written, for the current language, punctuation
+  // level and SSML setting.  Rebuilt when replacementsValid is false.
+  swReplacement asciiReplacements[0x80];
+  char *replacementText;
+  bool replacementsValid;
+  // Punctuation names for punctTableLanguage, or NULL if there are none.
+  char *punctuationDir;
+  swPunctTable punctTable;
+  char punctTableLanguage[MAX_LANGUAGE_CODE_LEN];
+  // The user lexicon for this engine and language, reloaded when its file
+  // changes.  lexiconPaths are the files it may be in, for lexiconLanguage, and
+  // lexiconFile is the one loaded, if any.  The files are checked at most once
+  // a second, at lexiconChecked.
+  char *lexiconDir;
+  char lexiconLanguage[MAX_LANGUAGE_CODE_LEN];
+  char *lexiconPaths[2];
+  const char *lexiconFile;
+  swLexicon lexicon;
+  time_t lexiconModified;
+  off_t lexiconSize;
+  time_t lexiconChecked;
   float speed;
   float pitch;
+  char *voice;
+  char *variant;
+  // The engine's voices and variants, read when it starts, so swSetVoice and
+  // swSetVariant can reject unknown names without waiting for the engine.
+  char **voices;
+  uint32_t numVoices;
+  char **variants;
+  uint32_t numVariants;
+  // Settings are sent just before the next command that needs the engine.
+  // settingsSet has the settings the caller has set, and settingsSent those in
+  // sentSettings, which are what the engine has.  failedSettings has those the
+  // engine rejected since swApplySettings was last called.
+  swSettings sentSettings;
+  uint32_t settingsSet;
+  uint32_t settingsSent;
+  uint32_t failedSettings;
+  // With SW_VOICE_PROCESSES set above 1, up to that many engine processes are
+  // kept, each with its own voice and variant, so switching back to a recent
+  // voice costs nothing.  The pool has the ones not in use.
+  swProcess *pool;
+  uint32_t poolSize;
+  uint32_t maxProcesses;
+  uint64_t processUses;
+  char *enginePath;
+  char *enginesDir;
   int pid;
   char languageCode[MAX_LANGUAGE_CODE_LEN];
   bool useSSML;
+  bool normalize;
   bool useSonicPitch;
   bool useSonicSpeed;
   // Volatile because it could be set from a different thread.
   volatile bool cancel;
 };
 
-typedef struct {
-  uint32_t unicodeChar;
-  const char *name;
-  swPunctuationLevel punctuationLevel;
-} swCharName;
-
-typedef struct {
-  const char *languageCode;
-  const swCharName *charNames;
-  uint32_t numCharNames;
-} swPunctuationList;
-
-// These are the substitutions for reading puncutation.  Note that they must be
-// sorted, since we do lookup with binary search.
-swCharName swEnglishCharNames[] = {
-  {'!', "exclaim", SW_PUNCT_ALL},
-  {'"', "quote", SW_PUNCT_ALL},
-  {'#', "number", SW_PUNCT_SOME},
-  {'$', "dollar", SW_PUNCT_SOME},
-  {'%', "percent", SW_PUNCT_SOME},
-  {'&', "ampersand", SW_PUNCT_SOME},
-  {'\'', "apostophe", SW_PUNCT_ALL},
-  {'(', "openparen", SW_PUNCT_MOST},
-  {')', "closeparen", SW_PUNCT_MOST},
-  {'*', "star", SW_PUNCT_SOME},
-  {'+', "plus", SW_PUNCT_SOME},
-  {',', "comma", SW_PUNCT_ALL},
-  {'-', "dash", SW_PUNCT_MOST},
-  {'.', "dot", SW_PUNCT_ALL},
-  {'/', "slash", SW_PUNCT_SOME},
-  {':', "colon", SW_PUNCT_MOST},
-  {';', "semicolon", SW_PUNCT_MOST},
-  {'<', "less", SW_PUNCT_SOME},
-  {'=', "equals", SW_PUNCT_SOME},
-  {'>', "greather", SW_PUNCT_SOME},
-  {'?', "question", SW_PUNCT_ALL},
-  {'@', "at", SW_PUNCT_SOME},
-  {'[', "left bracket", SW_PUNCT_MOST},
-  {'\\', "backslash", SW_PUNCT_SOME},
-  {']', "right bracket", SW_PUNCT_MOST},
-  {'^', "caret", SW_PUNCT_SOME},
-  {'_', "underline", SW_PUNCT_SOME},
-  {'`', "backquote", SW_PUNCT_SOME},
-  {'{', "left brace", SW_PUNCT_MOST},
-  {'|', "vertical bar", SW_PUNCT_SOME},
-  {'}', "right brace", SW_PUNCT_MOST},
-  {'~', "tilde", SW_PUNCT_SOME}
-};
-swPunctuationList swPunctuation[] = {
-  {"en", swEnglishCharNames, sizeof(swEnglishCharNames)/sizeof(swCharName)}
+// English punctuation, used when no compiled English table is installed, such
+// as when running from the source tree.  punctuation/en.txt has the full list.
+static const swPunctEntry swBuiltinEnglish[] = {
+  {'!', SW_PUNCT_ALL, "exclaim"},
+  {'"', SW_PUNCT_ALL, "quote"},
+  {'#', SW_PUNCT_SOME, "number"},
+  {'$', SW_PUNCT_SOME, "dollar"},
+  {'%', SW_PUNCT_SOME, "percent"},
+  {'&', SW_PUNCT_SOME, "ampersand"},
+  {'\'', SW_PUNCT_ALL, "apostrophe"},
+  {'(', SW_PUNCT_MOST, "openparen"},
+  {')', SW_PUNCT_MOST, "closeparen"},
+  {'*', SW_PUNCT_SOME, "star"},
+  {'+', SW_PUNCT_SOME, "plus"},
+  {',', SW_PUNCT_ALL, "comma"},
+  {'-', SW_PUNCT_MOST, "dash"},
+  {'.', SW_PUNCT_ALL, "dot"},
+  {'/', SW_PUNCT_SOME, "slash"},
+  {':', SW_PUNCT_MOST, "colon"},
+  {';', SW_PUNCT_MOST, "semicolon"},
+  {'<', SW_PUNCT_SOME, "less"},
+  {'=', SW_PUNCT_SOME, "equals"},
+  {'>', SW_PUNCT_SOME, "greater"},
+  {'?', SW_PUNCT_ALL, "question"},
+  {'@', SW_PUNCT_SOME, "at"},
+  {'[', SW_PUNCT_MOST, "left bracket"},
+  {'\\', SW_PUNCT_SOME, "backslash"},
+  {']', SW_PUNCT_MOST, "right bracket"},
+  {'^', SW_PUNCT_SOME, "caret"},
+  {'_', SW_PUNCT_SOME, "underline"},
+  {'`', SW_PUNCT_SOME, "backquote"},
+  {'{', SW_PUNCT_MOST, "left brace"},
+  {'|', SW_PUNCT_SOME, "vertical bar"},
+  {'}', SW_PUNCT_MOST, "right brace"},
+  {'~', SW_PUNCT_SOME, "tilde"}
 };
 
-// Write a formatted string to the server.
+static void sendSettings(swEngine engine);
+
+// Write a formatted string to the server.  Changed settings are sent first, and
+// queued speech is finished, since the engine only replies once it is done.
 static void serverPrintf(swEngine engine, const char *format, ...) {
+  sendSettings(engine);
+  if (engine->numQueued != 0) {
+    swWaitForSpeech(engine, 0);
+  }
   va_list ap;
   char buf[MAX_TEXT_LENGTH];
   va_start(ap, format);
   vsnprintf(buf, MAX_TEXT_LENGTH - 1, format, ap);
   va_end(ap);
   buf[MAX_TEXT_LENGTH - 1] = '\0';
-  swLog("Writing to engine: %s", buf);
+  swLogDebug("Writing to engine: %s", buf);
   fputs(buf, engine->fin);
   fflush(engine->fin);
 }
 
-// Write a string to the server, without adding a newline.
-static void serverPuts(swEngine engine, const char *text) {
-  swLog("Writing to engine: %s", text);
-  fputs(text, engine->fin);
+// Write length bytes to the server.
+static void serverWrite(swEngine engine, const char *text, uint32_t length) {
+  swLogDebug("Writing to engine: %.*s", (int)length, text);
+  fwrite(text, sizeof(char), length, engine->fin);
   fflush(engine->fin);
 }
 
-// Write "true\n" or "false\n" to the server.
+// Write "true\n" or "false\n" to the server.  This replies to speech, so it
+// must not send settings first.
 static void writeBool(swEngine engine, bool value) {
   if(value) {
-    serverPrintf(engine, "true\n");
+    serverWrite(engine, "true\n", 5);
   } else {
-    serverPrintf(engine, "false\n");
-
+    serverWrite(engine, "false\n", 6);
   }
 }
 
@@ -139,21 +267,15 @@ static bool expectTrue(swEngine engine) {
 
 // Start the Sonic speed/pitch post-processor.
 static void startSonic(swEngine engine) {
-  if (engine->sonic == NULL) {
-    engine->sonic = sonicCreateStream(engine->sampleRate, 1);
-    if (engine->sonic == NULL) {
-      fprintf(stderr, "Out of memory");
-      exit(1);
-    }
+  if (engine->dsp != NULL) {
+    swDspSetSonic(engine->dsp, true);
   }
 }
 
 // Stop the Sonic speed/pitch post-processor.
 static void stopSonic(swEngine engine) {
-  if (engine->sonic != NULL) {
-    sonicDestroyStream(engine->sonic);
-    engine->useSonicSpeed = false;
-    engine->useSonicPitch = false;
+  if (engine->dsp != NULL) {
+    swDspSetSonic(engine->dsp, false);
   }
 }
 
@@ -165,293 +287,1000 @@ static uint32_t readUint32(swEngine engine) {
   return result;
 }
 
+// Ask the engine for its native encoding.
+static swEncoding queryEncoding(swEngine engine) {
+  serverPrintf(engine, "get encoding\n");
+  char *line = swReadLine(engine->fout);
+  swEncoding encoding = SW_UTF8;
+  if(!strcmp(line, "ANSI")) {
+    encoding = SW_ANSI;
+  }
+  swFree(line);
+  return encoding;
+}
+
+// Return the directory of compiled punctuation tables: SW_PUNCTUATION_DIR if
+// set, or else share/speechsw/punctuation beside libexec/speechsw.  With no
+// libDirectory, it is share/speechsw/punctuation in the source tree.
+static char *findPunctuationDir(const char *libDirectory) {
+  const char *dir = getenv("SW_PUNCTUATION_DIR");
+  if (dir != NULL && *dir != '\0') {
+    return swCopyString(dir);
+  }
+  if (libDirectory == NULL) {
+    return swCopyString("share/speechsw/punctuation");
+  }
+  return swSprintf("%s/../../share/speechsw/punctuation", libDirectory);
+}
+
+// Return the directory of user lexicons: SW_LEXICON_DIR if set, or else
+// ~/.config/speechsw/lexicon.
+static char *findLexiconDir(void) {
+  const char *dir = getenv("SW_LEXICON_DIR");
+  if (dir != NULL && *dir != '\0') {
+    return swCopyString(dir);
+  }
+  const char *home = getenv("HOME");
+  return swSprintf("%s/.config/speechsw/lexicon", home != NULL? home : "");
+}
+
+// Allocate an swEngine object with the client's defaults.
+static swEngine newEngine(const char *libDirectory, const char *engineName) {
+  swEngine engine = swCalloc(1, sizeof(struct swEngineSt));
+  engine->name = swCopyString(engineName);
+  engine->scratch = swArenaCreate(SCRATCH_BLOCK_SIZE);
+  engine->scratchLimit = DEFAULT_SCRATCH_LIMIT;
+  engine->punctuationDir = findPunctuationDir(libDirectory);
+  engine->lexiconDir = findLexiconDir();
+  engine->normalize = true;
+  engine->nextSpeechId = 1;
+  // Default to English.
+  strcpy(engine->languageCode, "en");
+  return engine;
+}
+
+static bool pluginAudio(void *context, int16_t *samples, uint32_t numSamples);
+
+// Load the engine's plugin, sw_<engine>.so, if there is one, and start it.
+// Return false if there is none, it is for another ABI version, or it fails
+// to start, so the caller can start the engine process instead.  Setting
+// SW_NO_PLUGINS disables plugins.
+static bool loadPlugin(swEngine engine, const char *enginesDir) {
+  if (getenv("SW_NO_PLUGINS") != NULL) {
+    return false;
+  }
+  char *fileName = swSprintf("%s/sw_%s.so", enginesDir, engine->name);
+  if (!swFileReadable(fileName)) {
+    swFree(fileName);
+    return false;
+  }
+  void *handle = dlopen(fileName, RTLD_NOW | RTLD_LOCAL);
+  if (handle == NULL) {
+    swLogWarn("Unable to load plugin %s: %s\n", fileName, dlerror());
+    swFree(fileName);
+    return false;
+  }
+  swFree(fileName);
+  swGetPluginFunc getPlugin = (swGetPluginFunc)dlsym(handle, SW_PLUGIN_SYMBOL);
+  const swPlugin *plugin = getPlugin != NULL? getPlugin() : NULL;
+  if (plugin == NULL || plugin->abiVersion != SW_PLUGIN_ABI_VERSION ||
+      plugin->size < sizeof(swPlugin)) {
+    swLogWarn("Plugin for %s does not match this library\n", engine->name);
+    dlclose(handle);
+    return false;
+  }
+  if (!plugin->initializeEngine(enginesDir, pluginAudio, engine)) {
+    swLogInfo("Plugin for %s did not start\n", engine->name);
+    dlclose(handle);
+    return false;
+  }
+  engine->pluginHandle = handle;
+  engine->plugin = plugin;
+  return true;
+}
+
+// Return the most engine processes to keep for different voices, from
+// SW_VOICE_PROCESSES.  The default is 1, which keeps no others.
+static uint32_t readMaxProcesses(void) {
+  const char *value = getenv("SW_VOICE_PROCESSES");
+  if (value == NULL || atoi(value) < 1) {
+    return 1;
+  }
+  return atoi(value) > MAX_PROCESSES? MAX_PROCESSES : atoi(value);
+}
+
 // Create and initialize a new swEngine object, and connect to the speech engine.
 swEngine swStart(const char *libDirectory, const char *engineName,
     swCallback callback, void *callbackContext) {
+  swTraceStart("speechsw", true);
   char *enginesDir =  swSprintf("%s/%s", libDirectory, engineName);
-  char *engineExeName = swSprintf("%s/sw_%s", enginesDir, engineName);
-  if(!swFileReadable(engineExeName)) {
-    fprintf(stderr, "Unable to execute %s\n", engineExeName);
-    swFree(enginesDir);
-    swFree(engineExeName);
-    return NULL;
-  }
-  swEngine engine = swCalloc(1, sizeof(struct swEngineSt));
-  engine->name = swCopyString(engineName);
+  swEngine engine = newEngine(libDirectory, engineName);
   engine->callback = callback;
   engine->callbackContext = callbackContext;
-  engine->sampleBufferSize = SAMPLE_BUFFER_SIZE;
-  engine->samples = swCalloc(engine->sampleBufferSize, sizeof(int16_t));
-  engine->textBufferSize = 42;
-  engine->textBuffer = swCalloc(engine->textBufferSize, sizeof(char));
-  engine->pid = swForkWithStdio(engineExeName, &engine->fin, &engine->fout,
-    enginesDir, NULL);
-  swFree(engineExeName);
-  swFree(enginesDir);
-  serverPrintf(engine, "get sonicpitch\n");
-  engine->useSonicPitch = expectTrue(engine);
-  serverPrintf(engine, "get sonicspeed\n");
-  engine->useSonicSpeed = expectTrue(engine);
-  serverPrintf(engine, "get samplerate\n");
-  engine->sampleRate = readUint32(engine);
+  if (loadPlugin(engine, enginesDir)) {
+    swFree(enginesDir);
+    const swPlugin *plugin = engine->plugin;
+    engine->useSonicPitch = plugin->useSonicPitch();
+    engine->useSonicSpeed = plugin->useSonicSpeed();
+    engine->sampleRate = plugin->getSampleRate();
+    engine->encoding = plugin->usesANSI()? SW_ANSI : SW_UTF8;
+  } else {
+    char *engineExeName = swSprintf("%s/sw_%s", enginesDir, engineName);
+    if(!swFileReadable(engineExeName)) {
+      fprintf(stderr, "Unable to execute %s\n", engineExeName);
+      swFree(enginesDir);
+      swFree(engineExeName);
+      swStop(engine);
+      return NULL;
+    }
+    engine->pid = swForkWithStdio(engineExeName, &engine->fin, &engine->fout,
+      enginesDir, NULL);
+    engine->enginePath = engineExeName;
+    engine->enginesDir = enginesDir;
+    engine->maxProcesses = readMaxProcesses();
+    serverPrintf(engine, "get sonicpitch\n");
+    engine->useSonicPitch = expectTrue(engine);
+    serverPrintf(engine, "get sonicspeed\n");
+    engine->useSonicSpeed = expectTrue(engine);
+    serverPrintf(engine, "get samplerate\n");
+    engine->sampleRate = readUint32(engine);
+    engine->encoding = queryEncoding(engine);
+  }
+  engine->voices = swListVoices(engine, &engine->numVoices);
+  engine->variants = swGetVariants(engine, &engine->numVariants);
+  engine->dsp = swDspCreate(engine->sampleRate);
   if (engine->useSonicSpeed || engine->useSonicPitch) {
     startSonic(engine);
   }
-  // Default to English.
-  strcpy(engine->languageCode, "en");
   return engine;
 }
 
-// Shut down the speech engine, and free the swEngine object.
-void swStop(swEngine engine) {
-  serverPrintf(engine, "quit\n");
-  fclose(engine->fout);
-  fclose(engine->fin);
-  swFree(engine->name);
-  stopSonic(engine);
-  swFree(engine->samples);
-  swFree(engine->textBuffer);
-  kill(engine->pid, SIGKILL);
-  swFree(engine);
+// Create an swEngine object with no engine process.  Only swPrepareText and
+// settings kept by the client, like punctuation, work with it.  It is for
+// measuring the text pipeline without a TTS library.  If libDirectory is NULL,
+// punctuation tables are read from the source tree.
+swEngine swStartOffline(const char *libDirectory, swEncoding encoding) {
+  swEngine engine = newEngine(libDirectory, "offline");
+  engine->encoding = encoding;
+  return engine;
 }
 
-// Convert a line of hex digits to int16_t.
-static uint32_t convertHexToInt16(int16_t *samples, char *line) {
-  uint32_t i = 0;
-  uint32_t numDigits = 0;
-  uint32_t numSamples = 0;
-  uint32_t value = 0;
-  char c = line[i++];
-  while(c != '\0') {
-    if(c > ' ') {
-      value <<= 4;
-      uint32_t digit = 0;
-      if(c >= '0' && c <= '9') {
-        digit = c - '0';
-      } else if(c >= 'A' && c <= 'F') {
-        digit = c - 'A' + 10;
-      } else if(c >= 'a' && c <= 'f') {
-        digit = c - 'a' + 10;
-      }
-      value += digit;
-      numDigits++;
-      if(numDigits == 4) {
-        samples[numSamples++] = value;
-        numDigits = 0;
-        value = 0;
-      }
+// Tell a parked engine process to quit, and free its settings.
+static void stopProcess(swProcess *process) {
+  fputs("quit\n", process->fin);
+  fclose(process->fin);
+  fclose(process->fout);
+  swStopChild(process->pid, 100);
+  swFree(process->sentSettings.voice);
+  swFree(process->sentSettings.variant);
+}
+
+// Shut down the speech engine, and free the swEngine object.
+void swStop(swEngine engine) {
+  if (engine->fin != NULL) {
+    if (engine->numQueued != 0) {
+      swCancelQueued(engine, 0);
+      swWaitForSpeech(engine, 0);
     }
-    c = line[i++];
+    // Settings not sent yet are dropped, rather than sent, or starting a
+    // process for a new voice, just before quitting.
+    serverWrite(engine, "quit\n", 5);
+    fclose(engine->fout);
+    fclose(engine->fin);
+  }
+  for (uint32_t i = 0; i < engine->poolSize; i++) {
+    stopProcess(engine->pool + i);
+  }
+  swFree(engine->pool);
+  swFree(engine->enginePath);
+  swFree(engine->enginesDir);
+  if (engine->plugin != NULL) {
+    engine->plugin->closeEngine();
+    dlclose(engine->pluginHandle);
+  }
+  swFree(engine->name);
+  swFree(engine->queued);
+  swFree(engine->voice);
+  swFree(engine->variant);
+  swFreeStringList(engine->voices, engine->numVoices);
+  swFreeStringList(engine->variants, engine->numVariants);
+  swFree(engine->sentSettings.voice);
+  swFree(engine->sentSettings.variant);
+  if (engine->dsp != NULL) {
+    swDspFree(engine->dsp);
+  }
+  swArenaDestroy(engine->scratch);
+  swFree(engine->replacementText);
+  swFree(engine->punctuationDir);
+  if (engine->punctTable != NULL) {
+    swPunctFree(engine->punctTable);
   }
-  if(numDigits != 0) {
-    fprintf(stderr, "Hex digits left over: %u\n", numDigits);
+  swFree(engine->lexiconDir);
+  swFree(engine->lexiconPaths[0]);
+  swFree(engine->lexiconPaths[1]);
+  if (engine->lexicon != NULL) {
+    swLexiconFree(engine->lexicon);
   }
-  return numSamples;
+  if (engine->pid != 0) {
+    // The engine exits on quit, but may be hung in the TTS library.
+    swStopChild(engine->pid, 100);
+  }
+  swFree(engine);
 }
 
-// Grow the engine's sample buffer to at least bufSize.
-static void growSampleBuffer(swEngine engine, uint32_t bufSize) {
-  if (engine->sampleBufferSize < bufSize) {
-    engine->sampleBufferSize = bufSize << 2;
-    engine->samples = swRealloc(engine->samples, engine->sampleBufferSize, sizeof(int16_t));
+// Read a line from the engine into scratch memory, without the newline.  Return
+// NULL at end of file.
+static char *readScratchLine(swEngine engine, uint32_t *length) {
+  uint32_t size = LINE_BUFFER_SIZE;
+  char *line = swArenaAlloc(engine->scratch, size);
+  uint32_t pos = 0;
+  while (fgets(line + pos, size - pos, engine->fout) != NULL) {
+    pos += strlen(line + pos);
+    if (line[pos - 1] == '\n') {
+      line[--pos] = '\0';
+      *length = pos;
+      return line;
+    }
+    line = swArenaGrow(engine->scratch, line, size, size << 1);
+    size <<= 1;
   }
+  line[pos] = '\0';
+  *length = pos;
+  return pos == 0? NULL : line;
 }
 
-// Run sonic to adjust speed and/or pitch.  Update numSamples to the new number
-// of samples.
-static void adjustSamples(swEngine engine, uint32_t *numSamples) {
-  sonicStream sonic = engine->sonic;
-  sonicWriteShortToStream(sonic, engine->samples, *numSamples);
-  *numSamples = sonicSamplesAvailable(sonic);
-  if (*numSamples == 0) {
-    return;
-  }
-  growSampleBuffer(engine, *numSamples);
-  if (sonicReadShortFromStream(sonic, engine->samples, *numSamples) != *numSamples) {
-    fprintf(stderr, "Error reading from sonic stream\n");
-    exit(1);
+// Run samples through the post-processing chain, if any stage is enabled.
+// Update numSamples to the new number of samples.
+static int16_t *adjustSamples(swEngine engine, int16_t *samples, uint32_t *numSamples) {
+  if (!swDspActive(engine->dsp)) {
+    return samples;
   }
+  return swDspProcess(engine->dsp, samples, numSamples);
 }
 
-// Read speech data in hexidecimal from the server until "true" is read.
-// Caller must free the samples.
-static int16_t *readSpeechData(swEngine engine, uint32_t *numSamples) {
-  char *line = swReadLine(engine->fout);
-  if(!strcmp(line, "true")) {
-    swFree(line);
-    *numSamples = 0;
+// Read speech data in hexidecimal from the server.  Set done when the engine
+// reports the end of synthesis with "true" or "false", and set *spoken to that
+// result.  The samples are in scratch memory.
+static int16_t *readSpeechData(swEngine engine, uint32_t *numSamples, bool *done,
+    bool *spoken) {
+  uint64_t start = swTraceNow();
+  *numSamples = 0;
+  uint32_t length;
+  char *line = readScratchLine(engine, &length);
+  if(line == NULL || !strcmp(line, "true") || !strcmp(line, "false")) {
     // We're done.
+    *done = true;
+    *spoken = line != NULL && !strcmp(line, "true");
     return NULL;
   }
-  uint32_t bufSize  = strlen(line)/4;
-  growSampleBuffer(engine, bufSize);
-  *numSamples = convertHexToInt16(engine->samples, line);
-  swFree(line);
-  if (engine->sonic != NULL) {
-    adjustSamples(engine, numSamples);
-  }
-  return engine->samples;
+  *done = false;
+  int16_t *samples = swArenaAlloc(engine->scratch, (length/4 + 1)*sizeof(int16_t));
+  *numSamples = swConvertHexToInt16(samples, line);
+  swTraceComplete("readChunk", start, "samples", *numSamples);
+  samples = adjustSamples(engine, samples, numSamples);
+  return samples;
 }
 
+// Release all scratch memory used by the utterance, and trim the arena back to
+// its limit.
+static void finishUtterance(swEngine engine) {
+  swArenaReset(engine->scratch);
+  swArenaTrim(engine->scratch, engine->scratchLimit);
+  engine->textBuffer = NULL;
+  engine->textBufferSize = 0;
+  engine->textBufferPos = 0;
+}
 
-// Process speech data from the synth engine untile cancelled or done.
-static bool processSpeechData(swEngine engine) {
+// Finish an utterance: flush the post-processing chain, and tell the callback
+// synthesis is over by passing it 0 samples.  Return false if cancelled.
+static bool finishSpeech(swEngine engine, bool cancelled) {
   uint32_t numSamples;
-  int16_t *samples = readSpeechData(engine, &numSamples);
-  bool cancelled = false;
-  while(samples != NULL && !cancelled) {
+  if (cancelled && swDspActive(engine->dsp)) {
+    swDspReset(engine->dsp);
+  } else if (swDspActive(engine->dsp)) {
+    int16_t *samples = swDspFlush(engine->dsp, &numSamples);
     if (numSamples != 0) {
       cancelled = engine->callback(engine, samples, numSamples, engine->cancel,
           engine->callbackContext);
     }
-    writeBool(engine, !cancelled);
-    samples = readSpeechData(engine, &numSamples);
-  }
-  if (!cancelled && engine->sonic != NULL) {
-    // When using Sonic, flush the stream.
-    sonicFlushStream(engine->sonic);
-    uint32_t numFinalSamples = sonicSamplesAvailable(engine->sonic);
-    if (numFinalSamples != 0) {
-      adjustSamples(engine, &numSamples);
+  }
+  // We're done, so signal end of synthesis by sending 0 samples.  A cancel from
+  // the flushed samples still counts.
+  cancelled |= engine->callback(engine, NULL, 0, engine->cancel, engine->callbackContext);
+  finishUtterance(engine);
+  return !cancelled;
+}
+
+// Process speech data from the synth engine untile cancelled or done.  After a
+// cancel, keep reading until the engine reports it has stopped, so the next
+// command's reply is not mistaken for speech data.  Set *spoken to the engine's
+// result, which is false if, for example, it cannot speak a character.
+static bool processSpeechData(swEngine engine, bool *spoken) {
+  swArenaMark mark = swArenaGetMark(engine->scratch);
+  uint32_t numSamples;
+  bool done;
+  int16_t *samples = readSpeechData(engine, &numSamples, &done, spoken);
+  bool cancelled = false;
+  while(!done) {
+    if (numSamples != 0 && !cancelled) {
+      uint64_t start = swTraceNow();
       cancelled = engine->callback(engine, samples, numSamples, engine->cancel,
           engine->callbackContext);
+      swTraceComplete("callback", start, "samples", numSamples);
     }
+    writeBool(engine, !cancelled);
+    swTraceInstant("ack");
+    swArenaRelease(engine->scratch, mark);
+    samples = readSpeechData(engine, &numSamples, &done, spoken);
+  }
+  return finishSpeech(engine, cancelled);
+}
+
+// Pass samples from a plugin engine to the callback.  Without post-processing,
+// the callback gets the engine's own buffer.  Return false to cancel.
+static bool pluginAudio(void *context, int16_t *samples, uint32_t numSamples) {
+  swEngine engine = context;
+  if (engine->pluginCancelled) {
+    return false;
   }
-  // We're done, so signal end of synthesis by sending 0 samples.
-  cancelled = engine->callback(engine, samples, 0, engine->cancel, engine->callbackContext);
+  swArenaMark mark = swArenaGetMark(engine->scratch);
+  samples = adjustSamples(engine, samples, &numSamples);
+  bool cancelled = false;
+  if (numSamples != 0) {
+    uint64_t start = swTraceNow();
+    cancelled = engine->callback(engine, samples, numSamples, engine->cancel,
+        engine->callbackContext);
+    swTraceComplete("callback", start, "samples", numSamples);
+  }
+  swArenaRelease(engine->scratch, mark);
+  engine->pluginCancelled = cancelled;
   return !cancelled;
 }
 
-// Grow the engine's text buffer to at least bufSize.
+// Grow the engine's text buffer to at least bufSize.  It is the most recent
+// scratch allocation, so this usually just extends it in place.
 static void growTextBuffer(swEngine engine, uint32_t bufSize) {
   if (engine->textBufferSize < bufSize) {
-    engine->textBufferSize = bufSize << 2;
-    engine->textBuffer = swRealloc(engine->textBuffer, engine->textBufferSize, sizeof(char));
+    uint32_t newSize = bufSize << 1;
+    engine->textBuffer = swArenaGrow(engine->scratch, engine->textBuffer,
+        engine->textBufferSize, newSize);
+    engine->textBufferSize = newSize;
   }
 }
 
-// Find the current language's punctuation lilst.  Return NULL if not found.
-static const swPunctuationList *findCurrentLanguagePunctuationList(swEngine engine) {
-  if (engine->languageCode[0] == 0) {
-    return NULL;
+// Return true if the character never needs any processing on its way to the
+// engine.  Only letters, digits and spaces are plain.
+static inline bool isPlainChar(uint8_t c) {
+  uint8_t lower = c | 0x20;
+  return (lower >= 'a' && lower <= 'z') || (c >= '0' && c <= '9') || c == ' ';
+}
+
+// Return how many of the next PLAIN_BLOCK_SIZE bytes are plain before the first
+// one that is not.  There must be at least PLAIN_BLOCK_SIZE bytes of input.
+static inline uint32_t countPlainChars(const char *text) {
+#ifdef __SSE2__
+  __m128i v = _mm_loadu_si128((const __m128i *)text);
+  // Bytes >= 0x80 are negative, so they fail every range check.
+  __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+  __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+      _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+  __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+      _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+  __m128i space = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+  uint32_t mask = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(alpha, digit), space));
+  return __builtin_ctz(~mask);
+#else
+  uint32_t i = 0;
+  while (i < PLAIN_BLOCK_SIZE && isPlainChar(text[i])) {
+    i++;
+  }
+  return i;
+#endif
+}
+
+// Load the punctuation table for the current language, if it has changed.
+static void loadPunctuationTable(swEngine engine) {
+  if (!strcmp(engine->punctTableLanguage, engine->languageCode)) {
+    return;
+  }
+  if (engine->punctTable != NULL) {
+    swPunctFree(engine->punctTable);
+    engine->punctTable = NULL;
+  }
+  strcpy(engine->punctTableLanguage, engine->languageCode);
+  if (engine->languageCode[0] == '\0') {
+    return;
   }
-  for (uint32_t i = 0; i < sizeof(swPunctuation)/sizeof(swPunctuationList); i++) {
-    swPunctuationList *punctuationList = swPunctuation + i;
-    if (!strcasecmp(punctuationList->languageCode, engine->languageCode)) {
-      return punctuationList;
+  char *fileName = swSprintf("%s/%s.swp", engine->punctuationDir, engine->languageCode);
+  engine->punctTable = swPunctLoad(fileName);
+  if (engine->punctTable == NULL) {
+    swLogInfo("No punctuation table %s\n", fileName);
+    if (!strcmp(engine->languageCode, "en")) {
+      size_t size;
+      void *image = swPunctBuildImage(swBuiltinEnglish,
+          sizeof(swBuiltinEnglish)/sizeof(swPunctEntry), &size);
+      engine->punctTable = swPunctOpenImage(image, size);
     }
   }
-  return NULL;
+  swFree(fileName);
 }
 
-// Find the character in the punctuation list.  Use binary search.  Return NULL
-// if not found.
-static const swCharName *findCharNameInList(const swPunctuationList *punctuationList,
-    uint32_t unicodeChar) {
-  uint32_t start = 0;
-  uint32_t end = punctuationList->numCharNames;
-  do {
-    uint32_t middle = (start + end) >> 1;
-    const swCharName *charName = punctuationList->charNames + middle;
-    if (unicodeChar < charName->unicodeChar) {
-      end = middle;
-    } else if (unicodeChar > charName->unicodeChar) {
-      start = middle + 1;
+// Drop the loaded lexicon.
+static void freeLexicon(swEngine engine) {
+  if (engine->lexicon != NULL) {
+    swLexiconFree(engine->lexicon);
+    engine->lexicon = NULL;
+  }
+  engine->lexiconFile = NULL;
+}
+
+// Build the paths of the user lexicon for this engine and the current language:
+// <engine>/<language>.txt in the lexicon directory, or else <language>.txt.
+static void setLexiconPaths(swEngine engine) {
+  freeLexicon(engine);
+  swFree(engine->lexiconPaths[0]);
+  swFree(engine->lexiconPaths[1]);
+  engine->lexiconPaths[0] = swSprintf("%s/%s/%s.txt", engine->lexiconDir, engine->name,
+      engine->languageCode);
+  engine->lexiconPaths[1] = swSprintf("%s/%s.txt", engine->lexiconDir, engine->languageCode);
+  strcpy(engine->lexiconLanguage, engine->languageCode);
+}
+
+// Find the user lexicon for this engine and language, and load it if it is not
+// the one loaded, or its file has changed since.  This runs before every speak,
+// so the paths are built only when the language changes, and the files are
+// checked at most once a second.
+static void updateLexicon(swEngine engine) {
+  time_t now = time(NULL);
+  if (engine->lexiconPaths[0] == NULL ||
+      strcmp(engine->lexiconLanguage, engine->languageCode)) {
+    setLexiconPaths(engine);
+  } else if (now == engine->lexiconChecked) {
+    return;
+  }
+  engine->lexiconChecked = now;
+  const char *fileName = engine->lexiconPaths[0];
+  struct stat status;
+  if (stat(fileName, &status) != 0) {
+    fileName = engine->lexiconPaths[1];
+    if (stat(fileName, &status) != 0) {
+      fileName = NULL;
+    }
+  }
+  if (fileName != NULL && fileName == engine->lexiconFile &&
+      status.st_mtime == engine->lexiconModified && status.st_size == engine->lexiconSize) {
+    return;
+  }
+  if (fileName == NULL && engine->lexiconFile == NULL) {
+    return;
+  }
+  freeLexicon(engine);
+  engine->lexiconFile = fileName;
+  if (fileName != NULL) {
+    engine->lexiconModified = status.st_mtime;
+    engine->lexiconSize = status.st_size;
+    uint64_t start = swTraceNow();
+    engine->lexicon = swLexiconLoad(fileName);
+    if (engine->lexicon == NULL) {
+      swLogWarn("Unable to load lexicon %s\n", fileName);
     } else {
-      return charName;
+      swLogInfo("Loaded %u lexicon entries from %s\n", swLexiconSize(engine->lexicon),
+          fileName);
+      swTraceComplete("loadLexicon", start, "keys", swLexiconSize(engine->lexicon));
+    }
+  }
+}
+
+// Write " name " to out in the engine's encoding.  Return the length, which is
+// at most SW_PUNCT_MAX_NAME_LEN + 2.
+static uint32_t encodeName(swEngine engine, char *out, const char *name, uint32_t length) {
+  char *p = out;
+  *p++ = ' ';
+  if (engine->encoding == SW_ANSI) {
+    const char *end = name + length;
+    while (name < end) {
+      bool valid;
+      uint32_t unicodeChar;
+      name += swFindUTF8LengthAndValidate(name, end - name, &valid, &unicodeChar);
+      uint8_t ansiChar = valid? swUnicodeToAnsi(unicodeChar) : 0;
+      *p++ = ansiChar != 0? ansiChar : ' ';
     }
-  } while (start < end);
-  return NULL;
+  } else {
+    memcpy(p, name, length);
+    p += length;
+  }
+  *p++ = ' ';
+  return p - out;
 }
 
-// Add len characters to the text buffer.  Return the new buffer position.
-static void addToTextBuffer(swEngine engine, const char *text, uint32_t len) {
+// Build the table of how each ASCII character is written to the engine, for
+// the current language, punctuation level, and SSML setting.
+static void buildReplacements(swEngine engine) {
+  loadPunctuationTable(engine);
+  swPunctTable punctTable = engine->useSSML? NULL : engine->punctTable;
+  if (engine->replacementText == NULL) {
+    engine->replacementText = swCalloc(0x80*(SW_PUNCT_MAX_NAME_LEN + 2), sizeof(char));
+  }
+  char *p = engine->replacementText;
+  for (uint32_t c = 0; c < 0x80; c++) {
+    swReplacement *replacement = engine->asciiReplacements + c;
+    const char *name = NULL;
+    uint8_t level;
+    uint32_t length;
+    if (punctTable != NULL) {
+      name = swPunctLookup(punctTable, c, &level, &length);
+    }
+    if (c < ' ' || c == 0x7f) {
+      // Control characters are dropped, except whitespace, which separates words.
+      bool isSpace = c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+      replacement->text = isSpace? " " : "";
+      replacement->length = isSpace? 1 : 0;
+    } else if (name == NULL) {
+      replacement->text = NULL;
+      replacement->length = 1;
+    } else if (level <= engine->punctuationLevel) {
+      // Read the name of the punctuation character.
+      replacement->text = p;
+      replacement->length = encodeName(engine, p, name, length);
+      p += replacement->length;
+    } else {
+      // Replace the punctuation with a space.
+      replacement->text = " ";
+      replacement->length = 1;
+    }
+  }
+  engine->replacementsValid = true;
+}
+
+// Append len bytes to the text buffer, which must have room for them plus a
+// stuffed dot and a line break.  A line starting with '.' gets a second one,
+// since "." alone ends the text.  Lines are broken after a space once they
+// reach SOFT_LINE_LENGTH, and between any two characters at HARD_LINE_LENGTH.
+// Text for a plugin is passed directly, so it is neither stuffed nor broken.
+static inline void writeText(swEngine engine, uint32_t *lineStart, const char *text,
+    uint32_t len) {
+  char *out = engine->textBuffer;
   uint32_t pos = engine->textBufferPos;
-  if (pos + len + 1 < pos) {
-    fprintf(stderr, "Integer overflow in text buffer resize.\n");
-    exit (1);
-  }
-  growTextBuffer(engine, pos + len + 1);
-  memcpy(engine->textBuffer + pos, text, len);
-  engine->textBuffer[pos + len] = '\0';
-  engine->textBufferPos += len;
-}
-
-// Process text to speak appropriate punctuation.  Write result to
-// engine->textBuffer.
-static void processPunctuation(swEngine engine, const char *text) {
-  const swPunctuationList *punctuationList = findCurrentLanguagePunctuationList(engine);
-  if (punctuationList == NULL) {
-    // Copy text verbatum.
-    growTextBuffer(engine, strlen(text) + 1);
-    strcpy(engine->textBuffer, text);
+  if (engine->plugin != NULL) {
+    memcpy(out + pos, text, len);
+    engine->textBufferPos = pos + len;
     return;
   }
-  engine->textBufferPos = 0;
+  if (pos == *lineStart && *text == '.') {
+    out[pos++] = '.';
+  }
+  memcpy(out + pos, text, len);
+  pos += len;
+  uint32_t lineLength = pos - *lineStart;
+  if (lineLength >= HARD_LINE_LENGTH ||
+      (lineLength >= SOFT_LINE_LENGTH && out[pos - 1] == ' ')) {
+    out[pos++] = '\n';
+    *lineStart = pos;
+  }
+  engine->textBufferPos = pos;
+}
+
+// Write the name of a non-ASCII punctuation character, or a space if its level
+// is above the current punctuation level.
+static void writeCharName(swEngine engine, uint32_t *lineStart, const char *name,
+    uint32_t length, uint8_t level) {
+  if (level > engine->punctuationLevel) {
+    writeText(engine, lineStart, " ", 1);
+    return;
+  }
+  char buf[SW_PUNCT_MAX_NAME_LEN + 2];
+  writeText(engine, lineStart, buf, encodeName(engine, buf, name, length));
+}
+
+// Convert text to the exact bytes of a speak command, in engine->textBuffer.
+// The text is UTF-8 if isUTF8 is set, and otherwise CP1252.  This is one pass
+// that drops invalid UTF-8 and control characters, expands punctuation,
+// transcodes to the engine's encoding, breaks lines before the engine's line
+// length limit, and dot-stuffs.  Runs of letters, digits and
+// spaces are copied PLAIN_BLOCK_SIZE bytes at a time.  Return the length.  For
+// a plugin, the result is just the converted text, zero-terminated.
+static uint32_t prepareSpeakCommand(swEngine engine, const char *text, size_t textLen,
+    bool isUTF8) {
+  if (!engine->replacementsValid) {
+    buildReplacements(engine);
+  }
+  swPunctTable punctTable = engine->useSSML? NULL : engine->punctTable;
+  growTextBuffer(engine, textLen + 64);
+  strcpy(engine->textBuffer, engine->plugin != NULL? "" : SPEAK_HEADER);
+  engine->textBufferPos = strlen(engine->textBuffer);
+  uint32_t lineStart = engine->textBufferPos;
   const char *p = text;
-  const char *end = text + strlen(text);
+  const char *end = text + textLen;
   while (p != end) {
-    bool valid;
+    growTextBuffer(engine, engine->textBufferPos + MAX_STEP_SIZE);
+    uint32_t lineLength = engine->textBufferPos - lineStart;
+    if (end - p >= PLAIN_BLOCK_SIZE && lineLength + PLAIN_BLOCK_SIZE < SOFT_LINE_LENGTH) {
+      uint32_t numPlain = countPlainChars(p);
+      // Copy the whole block, but only keep the plain prefix.
+      memcpy(engine->textBuffer + engine->textBufferPos, p, PLAIN_BLOCK_SIZE);
+      engine->textBufferPos += numPlain;
+      p += numPlain;
+      if (numPlain == PLAIN_BLOCK_SIZE) {
+        continue;
+      }
+    }
+    uint8_t c = *p;
+    if (c < 0x80) {
+      const swReplacement *replacement = engine->asciiReplacements + c;
+      if (replacement->text == NULL) {
+        writeText(engine, &lineStart, p, 1);
+      } else if (replacement->length != 0) {
+        writeText(engine, &lineStart, replacement->text, replacement->length);
+      }
+      p++;
+      continue;
+    }
+    bool valid = true;
     uint32_t unicodeChar;
-    uint8_t len = swFindUTF8LengthAndValidate(p, end - p, &valid, &unicodeChar);
-    if (valid) {
-      const swCharName *charName = findCharNameInList(punctuationList, unicodeChar);
-      if (charName == NULL) {
-        // Not punctuation.  Just copy it.
-        addToTextBuffer(engine, p, len);
-      } else if (charName->punctuationLevel <= engine->punctuationLevel) {
-        // Read the namem of the punctuation character.
-        addToTextBuffer(engine, " ", 1);
-        addToTextBuffer(engine, charName->name, strlen(charName->name));
-        addToTextBuffer(engine, " ", 1);
+    uint8_t len = 1;
+    if (isUTF8) {
+      len = swFindUTF8LengthAndValidate(p, end - p, &valid, &unicodeChar);
+    } else {
+      unicodeChar = swAnsiToUnicodeUnicodeToAnsi(c);
+    }
+    if (valid && unicodeChar >= 0xa0) {
+      // Invalid UTF-8, C1 control characters, and bytes undefined in CP1252 are
+      // dropped.
+      const char *name = NULL;
+      uint8_t level;
+      uint32_t nameLength;
+      if (punctTable != NULL) {
+        name = swPunctLookup(punctTable, unicodeChar, &level, &nameLength);
+      }
+      if (name != NULL) {
+        writeCharName(engine, &lineStart, name, nameLength, level);
+      } else if (engine->encoding == SW_ANSI) {
+        // Characters with no ANSI code become spaces so words stay apart.
+        char ansiChar = swUnicodeToAnsi(unicodeChar);
+        writeText(engine, &lineStart, ansiChar != 0? &ansiChar : " ", 1);
+      } else if (isUTF8) {
+        writeText(engine, &lineStart, p, len);
       } else {
-        // Replace the punctuation with a space.
-        addToTextBuffer(engine, " ", 1);
+        char utf8Char[SW_MAX_UTF8_CHAR_LEN];
+        writeText(engine, &lineStart, utf8Char, swEncodeUTF8(unicodeChar, utf8Char));
       }
     }
     p += len;
   }
+  growTextBuffer(engine, engine->textBufferPos + 5);
+  char *out = engine->textBuffer + engine->textBufferPos;
+  if (engine->plugin != NULL) {
+    *out = '\0';
+    return engine->textBufferPos;
+  }
+  if (engine->textBufferPos != lineStart) {
+    *out++ = '\n';
+  }
+  strcpy(out, ".\n");
+  engine->textBufferPos = out + 2 - engine->textBuffer;
+  return engine->textBufferPos;
+}
+
+// Normalize text, apply the lexicon, and convert it to a speak command in
+// engine->textBuffer.  Return its length.
+static uint32_t prepareSpeech(swEngine engine, const char *text, bool isUTF8) {
+  uint64_t start = swTraceNow();
+  size_t textLen = strlen(text);
+  if (isUTF8 && engine->normalize) {
+    // Composed characters are what engines and the punctuation tables expect.
+    text = swNormalizeNFC(engine->scratch, text, textLen, &textLen);
+    swTraceComplete("normalize", start, "bytes", textLen);
+    start = swTraceNow();
+  }
+  if (isUTF8) {
+    updateLexicon(engine);
+    if (engine->lexicon != NULL) {
+      text = swLexiconApply(engine->lexicon, engine->scratch, text, textLen, &textLen);
+      swTraceComplete("lexicon", start, "bytes", textLen);
+      start = swTraceNow();
+    }
+  }
+  uint32_t length = prepareSpeakCommand(engine, text, textLen, isUTF8);
+  swTraceComplete("prepareText", start, "bytes", length);
+  return length;
+}
+
+// Send a speak or char command, with changed settings just ahead of it so they
+// cost no extra round trip, and read the replies to the settings.
+static void sendSpeechCommand(swEngine engine, const char *command, uint32_t length) {
+  sendSettings(engine);
+  uint64_t start = swTraceNow();
+  serverWrite(engine, command, length);
+  swTraceComplete("sendText", start, "bytes", length);
+  if (engine->numQueued != 0) {
+    swWaitForSpeech(engine, 0);
+  }
 }
 
 // Synthesize speech samples.  Synthesized samples will be passed to the
 // callback function passed to swStart.  This function blocks until speech
 // synthesis is complete.
 bool swSpeak(swEngine engine, const char *text, bool isUTF8) {
-  // TODO: deal with isUTF8
-  // TODO: replace any \n. with \n..
-  if (engine->useSSML) {
-    // Copy text verbatum.
-    growTextBuffer(engine, strlen(text) + 1);
-    strcpy(engine->textBuffer, text);
+  if (engine->numQueued != 0) {
+    swWaitForSpeech(engine, 0);
+  }
+  engine->cancel = false;
+  swTraceBegin("swSpeak");
+  uint32_t length = prepareSpeech(engine, text, isUTF8);
+  if (engine->plugin != NULL) {
+    sendSettings(engine);
+    engine->pluginCancelled = false;
+    engine->plugin->speakText(engine->textBuffer);
+    bool result = finishSpeech(engine, engine->pluginCancelled);
+    swTraceEnd("swSpeak");
+    return result;
+  }
+  sendSpeechCommand(engine, engine->textBuffer, length);
+  bool spoken;
+  bool result = processSpeechData(engine, &spoken);
+  swTraceEnd("swSpeak");
+  return result;
+}
+
+// Cancel queued speech with the given id, or all of it if id is 0.
+void swCancelQueued(swEngine engine, uint32_t id) {
+  bool found = false;
+  for (uint32_t i = 0; i < engine->numQueued; i++) {
+    swQueuedSpeech *speech = engine->queued + i;
+    if (speech->setting == 0 && (id == 0 || speech->id == id) && !speech->cancelled) {
+      speech->cancelled = true;
+      found = true;
+    }
+  }
+  if (!found) {
+    return;
+  }
+  char command[32];
+  if (id == 0) {
+    strcpy(command, "cancel all\n");
   } else {
-    // Replace punctuation based on the punctuation level.
-    processPunctuation(engine, text);
+    sprintf(command, "cancel %u\n", id);
+  }
+  serverWrite(engine, command, strlen(command));
+}
+
+// If swCancel was called, cancel all queued speech.
+static void checkQueueCancel(swEngine engine) {
+  if (engine->cancel && engine->numQueued != 0) {
+    swQueuedSpeech *last = engine->queued + engine->numQueued - 1;
+    if (last->setting != 0 || !last->cancelled) {
+      swCancelQueued(engine, 0);
+    }
+  }
+}
+
+// Add an entry to the end of the queue of replies expected from the engine.
+static swQueuedSpeech *addQueued(swEngine engine, uint32_t id, swSetting setting) {
+  if (engine->numQueued == engine->queuedSize) {
+    engine->queuedSize = engine->queuedSize == 0? 8 : engine->queuedSize << 1;
+    engine->queued = swRealloc(engine->queued, engine->queuedSize, sizeof(swQueuedSpeech));
   }
+  swQueuedSpeech *speech = engine->queued + engine->numQueued++;
+  speech->id = id;
+  speech->setting = setting;
+  speech->cancelled = false;
+  return speech;
+}
+
+// Queue text to be spoken after any speech already queued, and return its id
+// without waiting for it.
+uint32_t swSpeakQueued(swEngine engine, const char *text, bool isUTF8) {
+  checkQueueCancel(engine);
   engine->cancel = false;
-  serverPuts(engine, "speak\n");
-  serverPuts(engine, engine->textBuffer);
-  serverPrintf(engine, "\n.\n");
-  return processSpeechData(engine);
+  uint32_t id = engine->nextSpeechId++;
+  if (engine->nextSpeechId == 0) {
+    engine->nextSpeechId = 1;
+  }
+  swTraceBegin("swSpeakQueued");
+  sendSettings(engine);
+  uint32_t length = prepareSpeech(engine, text, isUTF8);
+  if (engine->plugin != NULL) {
+    // A plugin has no queue, so speak it now.
+    engine->pluginCancelled = false;
+    engine->plugin->speakText(engine->textBuffer);
+    finishSpeech(engine, engine->pluginCancelled);
+    swTraceEnd("swSpeakQueued");
+    return id;
+  }
+  addQueued(engine, id, 0);
+  uint64_t start = swTraceNow();
+  fprintf(engine->fin, "speak %u\n", id);
+  uint32_t headerLength = strlen(SPEAK_HEADER);
+  serverWrite(engine, engine->textBuffer + headerLength, length - headerLength);
+  swTraceComplete("sendText", start, "bytes", length);
+  finishUtterance(engine);
+  swTraceEnd("swSpeakQueued");
+  return id;
+}
+
+// Return true if the speech with the given id is queued, or if any speech or
+// setting is when id is 0.
+static bool speechQueued(swEngine engine, uint32_t id) {
+  for (uint32_t i = 0; i < engine->numQueued; i++) {
+    if (id == 0 || (engine->queued[i].setting == 0 && engine->queued[i].id == id)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Read an id followed by a space from a line of queued speech.  Return a
+// pointer to the rest of the line, or NULL if the id is not the speech the
+// engine is working on, which is always the first one queued.
+static char *readQueuedId(swEngine engine, char *p) {
+  char *end;
+  unsigned long id = strtoul(p, &end, 10);
+  if (end == p || *end != ' ' || id != engine->queued[0].id) {
+    swLogWarn("Unexpected speech id in %s\n", p);
+    return NULL;
+  }
+  return end + 1;
+}
+
+static void settingFailed(swEngine engine, swSetting setting);
+
+// Remove the first entry from the queue.
+static void removeFirstQueued(swEngine engine) {
+  engine->numQueued--;
+  memmove(engine->queued, engine->queued + 1, engine->numQueued*sizeof(swQueuedSpeech));
+}
+
+// Give up on everything queued, when the engine has gone away or its replies no
+// longer match the queue.  Queued speech finishes as cancelled, and queued
+// settings fail.
+static void failQueued(swEngine engine, bool *result) {
+  uint32_t numQueued = engine->numQueued;
+  engine->numQueued = 0;
+  for (uint32_t i = 0; i < numQueued; i++) {
+    if (engine->queued[i].setting != 0) {
+      settingFailed(engine, engine->queued[i].setting);
+    } else {
+      finishSpeech(engine, true);
+    }
+  }
+  *result = false;
+  finishUtterance(engine);
+}
+
+// Read one line of queued speech from the engine.  Pass audio to the callback,
+// and when the first queued speech is done, remove it and tell the callback
+// with 0 samples.  Clear *result if it was cancelled.  If the first entry is a
+// setting, the line is its reply.  Return false if the engine has gone away, or
+// replied with the id of speech that is not first in the queue.
+static bool readQueuedSpeech(swEngine engine, bool *result) {
+  swArenaMark mark = swArenaGetMark(engine->scratch);
+  uint64_t start = swTraceNow();
+  uint32_t length;
+  char *line = readScratchLine(engine, &length);
+  if (line == NULL) {
+    swLogWarn("Engine closed with speech queued\n");
+    failQueued(engine, result);
+    return false;
+  }
+  swQueuedSpeech *speech = engine->queued;
+  if (speech->setting != 0) {
+    if (strcmp(line, "true")) {
+      settingFailed(engine, speech->setting);
+    }
+    removeFirstQueued(engine);
+    swArenaRelease(engine->scratch, mark);
+  } else if (!strncmp(line, "audio ", 6)) {
+    char *hex = readQueuedId(engine, line + 6);
+    if (hex == NULL) {
+      failQueued(engine, result);
+      return false;
+    }
+    if (!speech->cancelled) {
+      uint32_t numSamples;
+      int16_t *samples = swArenaAlloc(engine->scratch, (strlen(hex)/4 + 1)*sizeof(int16_t));
+      numSamples = swConvertHexToInt16(samples, hex);
+      swTraceComplete("readChunk", start, "samples", numSamples);
+      samples = adjustSamples(engine, samples, &numSamples);
+      if (numSamples != 0 && engine->callback(engine, samples, numSamples,
+          engine->cancel, engine->callbackContext)) {
+        swCancelQueued(engine, speech->id);
+      }
+    }
+    swArenaRelease(engine->scratch, mark);
+  } else if (!strncmp(line, "done ", 5)) {
+    char *value = readQueuedId(engine, line + 5);
+    if (value == NULL) {
+      failQueued(engine, result);
+      return false;
+    }
+    bool cancelled = speech->cancelled || strcmp(value, "true");
+    removeFirstQueued(engine);
+    swArenaRelease(engine->scratch, mark);
+    if (!finishSpeech(engine, cancelled) || cancelled) {
+      *result = false;
+    }
+  } else {
+    swLogWarn("Unexpected line from engine: %s\n", line);
+    swArenaRelease(engine->scratch, mark);
+  }
+  return true;
+}
+
+// Pass samples of queued speech to the callback until the speech with the given
+// id is done, or all queued speech is done if id is 0.  Return false if any
+// speech that finished was cancelled.
+bool swWaitForSpeech(swEngine engine, uint32_t id) {
+  bool result = true;
+  if (engine->numQueued == 0) {
+    return true;
+  }
+  swTraceBegin("swWaitForSpeech");
+  // Settings may have been written without flushing.
+  fflush(engine->fin);
+  while (speechQueued(engine, id)) {
+    checkQueueCancel(engine);
+    if (!readQueuedSpeech(engine, &result)) {
+      break;
+    }
+  }
+  swTraceEnd("swWaitForSpeech");
+  return result;
+}
+
+// Convert text to the speak command sent to the engine, and discard it.  Return
+// its length.  This is for measuring the text pipeline.
+uint32_t swPrepareText(swEngine engine, const char *text, bool isUTF8) {
+  uint32_t length = prepareSpeakCommand(engine, text, strlen(text), isUTF8);
+  finishUtterance(engine);
+  return length;
 }
 
 // Synthesize speech samples to speak a single character.  Synthesized samples
 // will be passed to the callback function passed to swStart.  This function
-// blocks until speech synthesis is complete.
+// blocks until speech synthesis is complete.  Return false if cancelled, or if
+// the engine cannot speak the character.
 bool swSpeakChar(swEngine engine, const char *utf8Char, size_t bytes) {
   if (utf8Char[bytes] != '\0') {
-    swLog("swSpeakChar: No terminating '\0'\n");
+    swLogWarn("swSpeakChar: No terminating NUL\n");
     return false;
   }
   bool valid = false;
   uint32_t unicodeChar;
   swFindUTF8LengthAndValidate(utf8Char, bytes, &valid, &unicodeChar);
   if (!valid) {
-    swLog("Tried to speak invalid UTF8 char %s\n", utf8Char);
+    swLogWarn("Tried to speak invalid UTF8 char %s\n", utf8Char);
     return false;
   }
+  if (engine->numQueued != 0) {
+    swWaitForSpeech(engine, 0);
+  }
   engine->cancel = false;
-  serverPrintf(engine, "char %s\n", utf8Char);
-  return processSpeechData(engine);
+  swTraceBegin("swSpeakChar");
+  bool result, spoken;
+  if (engine->plugin != NULL) {
+    sendSettings(engine);
+    engine->pluginCancelled = false;
+    spoken = engine->plugin->speakChar(unicodeChar);
+    result = finishSpeech(engine, engine->pluginCancelled);
+  } else {
+    char *command = swSprintf("char %s\n", utf8Char);
+    sendSpeechCommand(engine, command, strlen(command));
+    swFree(command);
+    result = processSpeechData(engine, &spoken);
+  }
+  swTraceEnd("swSpeakChar");
+  return result && spoken;
+}
+
+// Copy a string list returned by a plugin, and let the plugin free it.
+static char **copyPluginStringList(swEngine engine, char **strings, uint32_t *numStrings) {
+  if (strings == NULL) {
+    *numStrings = 0;
+    return swCalloc(1, sizeof(char *));
+  }
+  char **copy = swCopyStringList((const char **)strings, *numStrings);
+  engine->plugin->freeStringList(strings, *numStrings);
+  return copy;
 }
 
 // Read a count-prefixed string list from the server.
@@ -505,35 +1334,255 @@ bool swUsedForSonicSpeed(swEngine engine) {
 
 // Get the sample rate in Hertz.
 uint32_t swGetSampleRate(swEngine engine) {
+  if (engine->dsp != NULL) {
+    return swDspGetOutputRate(engine->dsp);
+  }
   return engine->sampleRate;
 }
 
 // Get a list of supported voices.  The caller can call swFreeStrings
 char **swListVoices(swEngine engine, uint32_t *numVoices) {
+  if (engine->voices != NULL) {
+    *numVoices = engine->numVoices;
+    return swCopyStringList((const char **)engine->voices, engine->numVoices);
+  }
+  if (engine->plugin != NULL) {
+    return copyPluginStringList(engine, engine->plugin->getVoices(numVoices), numVoices);
+  }
   serverPrintf(engine, "get voices\n");
   return readStringList(engine, numVoices);
 }
 
-// Set the speech speed.  Speed is from -100.0 to 100.0, and 0 is the default.
+// Return true if a setting has been set, and the engine does not have it yet.
+static bool settingChanged(swEngine engine, swSetting setting) {
+  if (!(engine->settingsSet & setting)) {
+    return false;
+  }
+  if (!(engine->settingsSent & setting)) {
+    return true;
+  }
+  swSettings *sent = &engine->sentSettings;
+  switch (setting) {
+  case SW_SETTING_VOICE:
+    return strcmp(engine->voice, sent->voice);
+  case SW_SETTING_VARIANT:
+    return strcmp(engine->variant, sent->variant);
+  case SW_SETTING_SPEED:
+    return engine->speed != sent->speed;
+  case SW_SETTING_PITCH:
+    return engine->pitch != sent->pitch;
+  case SW_SETTING_SSML:
+    return engine->useSSML != sent->ssml;
+  }
+  return false;
+}
+
+// Return the name of a setting, as used in set commands.
+static const char *settingName(swSetting setting) {
+  switch (setting) {
+  case SW_SETTING_VOICE: return "voice";
+  case SW_SETTING_VARIANT: return "variant";
+  case SW_SETTING_SPEED: return "speed";
+  case SW_SETTING_PITCH: return "pitch";
+  case SW_SETTING_SSML: return "ssml";
+  }
+  return "";
+}
+
+// Remember that the engine rejected a setting, for swApplySettings.
+static void settingFailed(swEngine engine, swSetting setting) {
+  swLogWarn("The engine rejected the %s setting\n", settingName(setting));
+  engine->failedSettings |= setting;
+}
+
+// Send one setting.  A plugin applies it now.  Otherwise, write its command
+// without flushing, and queue its reply.
+static void sendSetting(swEngine engine, swSetting setting) {
+  swSettings *sent = &engine->sentSettings;
+  const swPlugin *plugin = engine->plugin;
+  bool result = true;
+  switch (setting) {
+  case SW_SETTING_VOICE:
+    swFree(sent->voice);
+    sent->voice = swCopyString(engine->voice);
+    if (plugin != NULL) {
+      result = plugin->setVoice(engine->voice);
+    } else {
+      fprintf(engine->fin, "set voice %s\n", engine->voice);
+    }
+    break;
+  case SW_SETTING_VARIANT:
+    swFree(sent->variant);
+    sent->variant = swCopyString(engine->variant);
+    if (plugin != NULL) {
+      result = plugin->setVoiceVariant(engine->variant);
+    } else {
+      fprintf(engine->fin, "set variant %s\n", engine->variant);
+    }
+    break;
+  case SW_SETTING_SPEED:
+    sent->speed = engine->speed;
+    if (plugin != NULL) {
+      result = plugin->setSpeed(engine->speed);
+    } else {
+      fprintf(engine->fin, "set speed %f\n", engine->speed);
+    }
+    break;
+  case SW_SETTING_PITCH:
+    sent->pitch = engine->pitch;
+    if (plugin != NULL) {
+      result = plugin->setPitch(engine->pitch);
+    } else {
+      fprintf(engine->fin, "set pitch %f\n", engine->pitch);
+    }
+    break;
+  case SW_SETTING_SSML:
+    sent->ssml = engine->useSSML;
+    if (plugin != NULL) {
+      result = plugin->setSSML(engine->useSSML);
+    } else {
+      fprintf(engine->fin, "set ssml %s\n", engine->useSSML? "true" : "false");
+    }
+    break;
+  }
+  engine->settingsSent |= setting;
+  if (plugin != NULL) {
+    if (!result) {
+      settingFailed(engine, setting);
+    }
+  } else {
+    addQueued(engine, 0, setting);
+  }
+}
+
+// Return true if a string setting is what the process was sent, where NULL
+// means it was never set.
+static bool sameSetting(const char *value, const char *sent) {
+  if (value == NULL || sent == NULL) {
+    return value == sent;
+  }
+  return !strcmp(value, sent);
+}
+
+// Swap the engine process in use with a parked one.
+static void swapProcess(swEngine engine, swProcess *process) {
+  swProcess current = {engine->fin, engine->fout, engine->pid, engine->sentSettings,
+      engine->settingsSent, ++engine->processUses};
+  engine->fin = process->fin;
+  engine->fout = process->fout;
+  engine->pid = process->pid;
+  engine->sentSettings = process->sentSettings;
+  engine->settingsSent = process->settingsSent;
+  *process = current;
+}
+
+// Return true if a parked process was sent the voice and variant the caller
+// wants.
+static bool processHasVoice(swEngine engine, const swProcess *process) {
+  return (process->settingsSent & SW_SETTING_VOICE) &&
+      sameSetting(engine->voice, process->sentSettings.voice) &&
+      sameSetting(engine->variant, process->sentSettings.variant);
+}
+
+// Switch to the engine process that already has the voice and variant.  If
+// none does, start a new one while the pool has room, and otherwise reuse the
+// least recently used one, which is then sent the new voice.  Replies pending
+// from the current process are read first.
+static void selectProcess(swEngine engine) {
+  if (!(engine->settingsSent & SW_SETTING_VOICE)) {
+    // The current process has never been sent a voice, so it is free.
+    return;
+  }
+  swProcess *best = NULL;
+  bool found = false;
+  for (uint32_t i = 0; i < engine->poolSize && !found; i++) {
+    swProcess *process = engine->pool + i;
+    found = processHasVoice(engine, process);
+    if (found || best == NULL || process->lastUsed < best->lastUsed) {
+      best = process;
+    }
+  }
+  if (!found && engine->poolSize + 1 < engine->maxProcesses) {
+    if (engine->pool == NULL) {
+      engine->pool = swCalloc(engine->maxProcesses - 1, sizeof(swProcess));
+    }
+    best = engine->pool + engine->poolSize++;
+    best->pid = swForkWithStdio(engine->enginePath, &best->fin, &best->fout,
+        engine->enginesDir, NULL);
+  }
+  if (engine->numQueued != 0) {
+    swWaitForSpeech(engine, 0);
+  }
+  swapProcess(engine, best);
+}
+
+// Send the settings that changed since they were last sent, in one batch, and
+// without waiting for replies.  Setting something back to the value the engine
+// has sends nothing.  Speed and pitch are not sent while Sonic adjusts them.
+static void sendSettings(swEngine engine) {
+  if (engine->fin == NULL && engine->plugin == NULL) {
+    return;
+  }
+  if (engine->maxProcesses > 1 && (settingChanged(engine, SW_SETTING_VOICE) ||
+      settingChanged(engine, SW_SETTING_VARIANT))) {
+    selectProcess(engine);
+  }
+  if (settingChanged(engine, SW_SETTING_VOICE)) {
+    // The engine may reset speed and pitch for the new voice.
+    engine->settingsSent &= ~(SW_SETTING_SPEED | SW_SETTING_PITCH);
+    sendSetting(engine, SW_SETTING_VOICE);
+  }
+  if (settingChanged(engine, SW_SETTING_VARIANT)) {
+    sendSetting(engine, SW_SETTING_VARIANT);
+  }
+  if (!engine->useSonicSpeed && settingChanged(engine, SW_SETTING_SPEED)) {
+    sendSetting(engine, SW_SETTING_SPEED);
+  }
+  if (!engine->useSonicPitch && settingChanged(engine, SW_SETTING_PITCH)) {
+    sendSetting(engine, SW_SETTING_PITCH);
+  }
+  if (settingChanged(engine, SW_SETTING_SSML)) {
+    sendSetting(engine, SW_SETTING_SSML);
+  }
+}
+
+// Send changed settings to the engine, and wait for its replies, after any
+// queued speech.  Return false if the engine rejected a setting since the last
+// call.
+bool swApplySettings(swEngine engine) {
+  sendSettings(engine);
+  swWaitForSpeech(engine, 0);
+  bool result = engine->failedSettings == 0;
+  engine->failedSettings = 0;
+  return result;
+}
+
+// Set the speech speed, as a factor of the default speed.  Return false unless
+// it is positive.
 bool swSetSpeed(swEngine engine, float speed) {
+  if (!(speed > 0.0f)) {
+    return false;
+  }
   engine->speed = speed;  // Remember it in case sonic is enabled/disabled.
+  engine->settingsSet |= SW_SETTING_SPEED;
   if (engine->useSonicSpeed) {
-    sonicSetSpeed(engine->sonic, speed);
-    return true;
+    swDspSetSpeed(engine->dsp, speed);
   }
-  serverPrintf(engine, "set speed %f\n", speed);
-  return expectTrue(engine);
+  return true;
 }
 
-// Set the pitch.  0 means default, -100 is min pitch, and 100 is max pitch.
+// Set the pitch, as a factor of the default pitch.  Return false unless it is
+// positive.
 bool swSetPitch(swEngine engine, float pitch) {
+  if (!(pitch > 0.0f)) {
+    return false;
+  }
   engine->pitch = pitch;  // Remember it in case sonic is enabled/disabled.
+  engine->settingsSet |= SW_SETTING_PITCH;
   if (engine->useSonicPitch) {
-    sonicSetPitch(engine->sonic, pitch);
-    return true;
+    swDspSetPitch(engine->dsp, pitch);
   }
-  serverPrintf(engine, "set pitch %f\n", pitch);
-  return expectTrue(engine);
+  return true;
 }
 
 // The local should be appended to the voice name, e.g. "American
@@ -552,27 +1601,45 @@ static void updateLanguage(swEngine engine, const char *voice) {
   if (q - p > MAX_LANGUAGE_CODE_LEN - 1) {
     return;  // Language code is too long.
   }
-  strncpy(engine->languageCode, p, q - p);
+  for (uint32_t i = 0; i < q - p; i++) {
+    // Punctuation tables are named by lower case codes.
+    engine->languageCode[i] = tolower((uint8_t)p[i]);
+  }
   engine->languageCode[q - p] = '\0';
+  engine->replacementsValid = false;
 }
 
-// Select a voice by it's identifier
-bool swSetVoice(swEngine engine, const char *voice) {
-  updateLanguage(engine, voice);
-  serverPrintf(engine, "set voice %s\n", voice);
-  return expectTrue(engine);
+// Return true if the engine lists the voice, by its full name, its name before
+// the comma, or its language after it.  Any name is allowed if the engine
+// lists no voices.
+static bool voiceListed(swEngine engine, const char *voice) {
+  if (engine->numVoices == 0) {
+    return true;
+  }
+  size_t length = strlen(voice);
+  for (uint32_t i = 0; i < engine->numVoices; i++) {
+    const char *listed = engine->voices[i];
+    const char *comma = strrchr(listed, ',');
+    if (!strcasecmp(listed, voice) || (comma != NULL && (!strcasecmp(comma + 1, voice) ||
+        (comma - listed == length && !strncasecmp(listed, voice, length))))) {
+      return true;
+    }
+  }
+  return false;
 }
 
-// Return the engine's native encoding.
-swEncoding swGetEncoding(swEngine engine) {
-  serverPrintf(engine, "get encoding\n");
-  char *line = swReadLine(engine->fout);
-  swEncoding encoding = SW_UTF8;
-  if(!strcmp(line, "ANSI")) {
-    encoding = SW_ANSI;
+// Select a voice by it's identifier.  Return false if the engine does not list
+// it.
+bool swSetVoice(swEngine engine, const char *voice) {
+  if (!voiceListed(engine, voice)) {
+    swLogWarn("Unknown voice %s\n", voice);
+    return false;
   }
-  swFree(line);
-  return encoding;
+  updateLanguage(engine, voice);
+  swFree(engine->voice);
+  engine->voice = swCopyString(voice);
+  engine->settingsSet |= SW_SETTING_VOICE;
+  return true;
 }
 
 // Interrupt speech while being synthesized.
@@ -587,14 +1654,30 @@ bool swSpeechCanceled(swEngine engine) {
 
 // List available variations on voices.
 char **swGetVariants(swEngine engine, uint32_t *numVariants) {
+  if (engine->plugin != NULL) {
+    sendSettings(engine);
+    return copyPluginStringList(engine, engine->plugin->getVoiceVariants(numVariants),
+        numVariants);
+  }
   serverPrintf(engine, "get variants\n");
   return readStringList(engine, numVariants);
 }
 
-// Select a voice variant by it's identifier
+// Select a voice variant by it's identifier.  Return false if the engine does
+// not list it.
 bool swSetVariant(swEngine engine, const char *variant) {
-  serverPrintf(engine, "set variant %s\n", variant);
-  return expectTrue(engine);
+  bool listed = engine->numVariants == 0;
+  for (uint32_t i = 0; i < engine->numVariants && !listed; i++) {
+    listed = !strcasecmp(engine->variants[i], variant);
+  }
+  if (!listed) {
+    swLogWarn("Unknown variant %s\n", variant);
+    return false;
+  }
+  swFree(engine->variant);
+  engine->variant = swCopyString(variant);
+  engine->settingsSet |= SW_SETTING_VARIANT;
+  return true;
 }
 
 // Set the punctuation level: none, some, most, or all.
@@ -603,18 +1686,100 @@ bool swSetPunctuation(swEngine engine, swPunctuationLevel level) {
     return false;
   }
   engine->punctuationLevel = level;
+  engine->replacementsValid = false;
   return true;
 }
 
+// Enable or disable NFC normalization of UTF-8 text passed to swSpeak.  It is
+// enabled by default.
+void swSetNormalization(swEngine engine, bool enable) {
+  engine->normalize = enable;
+}
+
+// Scale samples by a factor, up to SW_DSP_MAX_GAIN.
+void swSetGain(swEngine engine, float gain) {
+  if (engine->dsp != NULL) {
+    swDspSetGain(engine->dsp, gain);
+  }
+}
+
+// Enable or disable repairing int16 overflow from the engine.
+void swEnableOverflowRepair(swEngine engine, bool enable) {
+  if (engine->dsp != NULL) {
+    swDspSetRepair(engine->dsp, enable);
+  }
+}
+
+// Enable or disable trimming silence at the start and end of each utterance.
+void swEnableSilenceTrim(swEngine engine, bool enable) {
+  if (engine->dsp != NULL) {
+    swDspSetTrim(engine->dsp, enable);
+  }
+}
+
+// Resample speech to the given rate.
+void swSetOutputSampleRate(swEngine engine, uint32_t sampleRate) {
+  if (engine->dsp != NULL) {
+    swDspSetOutputRate(engine->dsp, sampleRate);
+  }
+}
+
+// Add a post-processing stage after Sonic.
+bool swAddAudioStage(swEngine engine, const swDspStage *stage, void *context) {
+  return engine->dsp != NULL && swDspAddStage(engine->dsp, stage, context);
+}
+
 // Enable or disable ssml support.
 bool swSetSSML(swEngine engine, bool enable) {
   engine->useSSML = enable;
-  serverPrintf(engine, "set ssml %s\n", enable? "true" : "false");
-  return expectTrue(engine);
+  engine->replacementsValid = false;
+  engine->settingsSet |= SW_SETTING_SSML;
+  return true;
 }
 
 // Return the protocol version, Currently 1 for all engines.
 uint32_t swGetVersion(swEngine engine) {
+  if (engine->plugin != NULL) {
+    return 1;
+  }
   serverPrintf(engine, "get version\n");
   return readUint32(engine);
 }
+
+// Read statistics about the client and its engine process.
+bool swGetStats(swEngine engine, swStats *stats) {
+  swGetAllocStats(&stats->clientAllocs);
+  if (engine->plugin != NULL) {
+    engine->plugin->getAllocStats(&stats->engineAllocs);
+    return true;
+  }
+  serverPrintf(engine, "get allocstats\n");
+  char *line = swReadLine(engine->fout);
+  swAllocStats *engineAllocs = &stats->engineAllocs;
+  unsigned long long liveBytes, peakBytes, allocations, frees, bytesAllocated;
+  int numValues = sscanf(line, "%llu %llu %llu %llu %llu %lf", &liveBytes, &peakBytes,
+      &allocations, &frees, &bytesAllocated, &engineAllocs->allocationsPerSecond);
+  swFree(line);
+  if (numValues != 6) {
+    memset(engineAllocs, 0, sizeof(swAllocStats));
+    return false;
+  }
+  engineAllocs->liveBytes = liveBytes;
+  engineAllocs->peakBytes = peakBytes;
+  engineAllocs->allocations = allocations;
+  engineAllocs->frees = frees;
+  engineAllocs->bytesAllocated = bytesAllocated;
+  return true;
+}
+
+// Set how much scratch memory is kept between utterances.  The arena may be in
+// use, so it is trimmed when the current utterance finishes.
+void swSetScratchLimit(swEngine engine, size_t bytes) {
+  engine->scratchLimit = bytes;
+}
+
+// Return the engine's native encoding.  Text passed to swSpeak is converted to
+// it.
+swEncoding swGetEncoding(swEngine engine) {
+  return engine->encoding;
+}
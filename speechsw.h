@@ -1,9 +1,15 @@
 // This interface provides a light weight C interface for talking to the
 // supported voice engines.
 
+#ifndef SW_SPEECHSW_H
+#define SW_SPEECHSW_H
+
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "dsp.h"
+#include "util.h"
+
 #define SW_API_VERSION 1
 
 typedef enum {
@@ -37,20 +43,57 @@ typedef bool (*swCallback)(swEngine engine, int16_t *samples, uint32_t numSample
 // List available engines.
 char **swListEngines(const char *libDirectory, uint32_t *numEngines);
 // Create and initialize a new swEngine object, and connect to the speech engine.
+// If SW_VOICE_PROCESSES is set to more than 1, up to that many engine processes
+// are started as needed, each kept with its own voice and variant, and speech
+// goes to the one with the voice selected.  This makes switching between a few
+// voices cheap for engines that are slow to change voice.
 swEngine swStart(const char *libDirectory, const char *engineName,
     swCallback callback, void *callbackContext);
+// Create an swEngine object with no engine process.  Only swPrepareText and
+// settings kept by the client, like punctuation, work with it.  It is for
+// measuring the text pipeline without a TTS library.  If libDirectory is NULL,
+// punctuation tables are read from the source tree.
+swEngine swStartOffline(const char *libDirectory, swEncoding encoding);
 // Shut down the speech engine, and free the swEngine object.
 void swStop(swEngine engine);
 // Synthesize speech samples.  Synthesized samples will be passed to the 
 // callback function passed to swStart.  This function blocks until speech
-// synthesis is complete.
+// synthesis is complete.  The text is UTF-8 if isUTF8 is set, and otherwise
+// ANSI (CP1252).  Either way, it is converted to the engine's encoding.  UTF-8
+// text is first normalized to NFC unless swSetNormalization disables it, and
+// then the user lexicon for the engine and language is applied.  Lexicons are
+// read from SW_LEXICON_DIR, or ~/.config/speechsw/lexicon, as
+// <engine>/<language>.txt or <language>.txt, and reloaded when they change.
 bool swSpeak(swEngine engine, const char *text, bool isUTF8);
 // Synthesize speech samples to speak a single character.  Synthesized samples
 // will be passed to the callback function passed to swStart.
-// This function blocks until speech synthesis is complete.
+// This function blocks until speech synthesis is complete.  Return false if
+// cancelled, or if the engine cannot speak the character, like pico.
 bool swSpeakChar(swEngine engine, const char *utf8Char, size_t bytes);
+// Queue text to be spoken after any speech already queued, and return its id
+// without waiting.  The engine starts each queued utterance as soon as the
+// previous one is done, so there is no gap between them.  Samples are only
+// passed to the callback from swWaitForSpeech, which must be called from the
+// same thread, and the callback gets 0 samples at the end of each utterance.
+// Other calls that talk to the engine first wait for all queued speech.
+uint32_t swSpeakQueued(swEngine engine, const char *text, bool isUTF8);
+// Pass samples of queued speech to the callback until the utterance with the
+// given id is done, or all queued speech is done if id is 0.  Return false if
+// any utterance that finished was cancelled.
+bool swWaitForSpeech(swEngine engine, uint32_t id);
+// Cancel one queued utterance, or all queued speech if id is 0.  Calling
+// swCancel cancels all queued speech too.
+void swCancelQueued(swEngine engine, uint32_t id);
+// Convert text to the speak command sent to the engine, and discard it.  Return
+// its length.  This is for measuring the text pipeline.
+uint32_t swPrepareText(swEngine engine, const char *text, bool isUTF8);
 
-// These functions control speech synthesis parameters.
+// These functions control speech synthesis parameters.  Voice, variant,
+// speed, pitch and SSML are kept by the client, and the ones that changed are
+// sent together just ahead of the next command to the engine, usually the next
+// speech, so they cost no extra round trip.  Their setters return false for
+// voices and variants the engine does not list, and speeds and pitches that are
+// not positive.  swApplySettings reports whether the engine accepted the rest.
 
 // Interrupt speech while being synthesized.
 void swCancel(swEngine engine);
@@ -73,17 +116,61 @@ char **swListVoices(swEngine engine, uint32_t *numVoices);
 char **swGetVariants(swEngine engine, uint32_t *numVariants);
 // Return the native encoding of the engine.
 swEncoding swGetEncoding(swEngine engine);
-// Select a voice by it's identifier
+// Select a voice by it's identifier, like "German,de", or its name or language
+// alone.  Return false if the engine does not list it.
 bool swSetVoice(swEngine engine, const char *voice);
-// Select a voice variant by it's identifier
+// Send changed settings to the engine now, and wait for its replies, after any
+// queued speech.  Return false if the engine rejected a setting since the last
+// call.
+bool swApplySettings(swEngine engine);
+// Select a voice variant by it's identifier.  Return false if the engine does
+// not list it.
 bool swSetVariant(swEngine engine, const char *variant);
-// Set the pitch.  0 means default, -100 is min pitch, and 100 is max pitch.
+// Set the pitch, as a factor of the default pitch.
 bool swSetPitch(swEngine engine, float pitch);
 // Set the punctuation level: none, some, most, or all.
 bool swSetPunctuation(swEngine engine, swPunctuationLevel level);
-// Set the speech speed.  Speed is from -100.0 to 100.0, and 0 is the default.
+// Set the speech speed, as a factor of the default speed.
 bool swSetSpeed(swEngine engine, float speed);
+// Enable or disable NFC normalization of UTF-8 text passed to swSpeak.  It is
+// enabled by default.
+void swSetNormalization(swEngine engine, bool enable);
 // Enable or disable ssml support.
 bool swSetSSML(swEngine engine, bool enable);
+
+// These functions control post-processing of the engine's samples, before they
+// reach the callback.  See dsp.h.  All are off by default, except Sonic when the
+// engine asks for it.
+
+// Scale samples by a factor, up to SW_DSP_MAX_GAIN, clipping at the int16
+// limits.
+void swSetGain(swEngine engine, float gain);
+// Enable or disable undoing int16 wrap-around from engines, like ibmtts, that
+// overflow when speaking very fast.  This turns harsh pops into clipping.
+void swEnableOverflowRepair(swEngine engine, bool enable);
+// Enable or disable dropping silence at the start and end of each utterance,
+// which lowers latency and shortens gaps between utterances.
+void swEnableSilenceTrim(swEngine engine, bool enable);
+// Resample speech to the given rate.  swGetSampleRate then returns it.
+void swSetOutputSampleRate(swEngine engine, uint32_t sampleRate);
+// Add a post-processing stage, run after Sonic and before resampling.  Return
+// false if SW_DSP_MAX_STAGES stages have been added.
+bool swAddAudioStage(swEngine engine, const swDspStage *stage, void *context);
 // Return the protocol version, Currently 1 for all engines.
 uint32_t swGetVersion(swEngine engine);
+
+// Statistics about the client and its engine process.
+typedef struct {
+  swAllocStats clientAllocs;
+  swAllocStats engineAllocs;
+} swStats;
+
+// Read statistics.  Allocation counts are zero unless SW_ALLOC_STATS was set in
+// the environment when the engine was started.
+bool swGetStats(swEngine engine, swStats *stats);
+// Set how many bytes of scratch memory are kept between utterances.  Larger
+// utterances still work, but their extra memory is freed when they finish.  The
+// new limit takes effect when the next utterance finishes.
+void swSetScratchLimit(swEngine engine, size_t bytes);
+
+#endif  // SW_SPEECHSW_H
@@ -5,8 +5,10 @@
 #include <stdio.h>
 #include <string.h>
 #include <getopt.h>
+#include "ansi2ascii.h"
 #include "speechsw.h"
 #include "util.h"
+#include "utf8.h"
 #include "wave.h"
 
 #define MAX_PARAGRAPH 2048
@@ -16,8 +18,14 @@ static char *swLibDir;
 
 static char *swText;
 static uint32_t swTextLen, swTextPos;
-static char swParagraph[MAX_PARAGRAPH + SW_MAX_WORD_SIZE];
+static char swParagraph[MAX_PARAGRAPH + 1];
+static char swASCIIParagraph[MAX_PARAGRAPH*SW_ANSI_MAX_EXPANSION + 1];
 static bool swConvertToASCII;
+static swANSIState swANSIConversion;
+static bool swReportStats;
+static float swGain = 1.0f;
+static uint32_t swOutputRate;
+static bool swTrimSilence;
 
 struct swContextSt {
   swWaveFile outWaveFile;
@@ -36,12 +44,16 @@ static void usage(void) {
     "-c       -- Read the text character by character.\n"
     "-e engine    -- Name of supported engine, like espeak picotts or ibmtts.\n"
     "-f textFile  -- Text file to be spoken.\n"
+    "-g gain      -- Scale the volume (1.0 is normal).\n"
     "-l       -- List engines.\n"
     "-L       -- List variants available for a given voice.  Use with -v.\n"
+    "-m       -- Report memory allocation statistics.  Set SW_ALLOC_STATS=1.\n"
     "-p pitch     -- Speech pitch (1.0 is normal).\n"
     "-P       -- Use sonic to adjust pitch rather than the speech engine.\n"
+    "-r rate      -- Resample speech to this sample rate.\n"
     "-s speed     -- Speech speed (1.0 is normal).\n"
     "-S       -- Use sonic to adjust speed rather than the speech engine.\n"
+    "-t       -- Trim silence at the start and end of speech.\n"
     "-u <0-3> -- Set punctuation level.  0 = none, 1 = some (defauilt, 2 = moset, 3 = all.\n"
     "-v voice     -- Name of voice to use.\n"
     "-V variant   -- List variants available for a given voice.\n"
@@ -80,7 +92,7 @@ static void setDirectories(char *exeName) {
 // Add text to be spoken to the text buffer.
 static void addText(char *p) {
   uint32_t len = strlen(p);
-  if (swTextPos + len + 1 >= swTextLen) {
+  while (swTextPos + len + 1 >= swTextLen) {
     swTextLen <<= 1;
     swText = swRealloc(swText, swTextLen, sizeof(char));
   }
@@ -88,39 +100,20 @@ static void addText(char *p) {
   swTextPos += len;
 }
 
-// Read text, repacing character sequences < space with a single space.
-// Continue until we see a period and space between MIN_PARAGRAPH and
-// MAX_PARAGRAPH.  If there is no period in this range, then return
-// MAX_PARAGRAPH characters.
+// Read a paragraph, ending at a period between MIN_PARAGRAPH and MAX_PARAGRAPH
+// bytes, or at MAX_PARAGRAPH.  With -a, the paragraph is converted to ASCII.
 static char *readParagraph(FILE *file) {
-  uint32_t pos = 0;
-  int c = getc(file);
-  while(c != EOF && pos < MAX_PARAGRAPH) {
-    if (c <= ' ') {
-      while(c <= ' ' && c != EOF) {
-        c = getc(file);
-      }
-      if (c != EOF) {
-        ungetc(c, file);
-      }
-      c = ' ';
-    }
-    if (!swConvertToASCII) {
-      swParagraph[pos++] = c;
-    } else {
-      char *word = swConvertANSIToASCII(c);
-      strcpy(swParagraph + pos, word);
-      pos += strlen(word);
-    }
-    if (c == '.' && pos >= MIN_PARAGRAPH) {
-      break;
-    }
-    c = getc(file);
-  }
-  if (pos == 0 && c == EOF) {
+  uint32_t length;
+  if (!swReadParagraph(file, swParagraph, MIN_PARAGRAPH, MAX_PARAGRAPH, &length)) {
     return NULL;
   }
-  swParagraph[pos] = '\0';
+  if (swConvertToASCII) {
+    // Word spacing carries over from the previous paragraph.
+    size_t len = swConvertANSIBufferToASCII(&swANSIConversion, swASCIIParagraph,
+        swParagraph, length);
+    swASCIIParagraph[len] = '\0';
+    return swASCIIParagraph;
+  }
   return swParagraph;
 }
 
@@ -151,24 +144,32 @@ static bool speechCallback(swEngine engine, int16_t *samples, uint32_t numSample
   return cancelled;
 }
 
+// Return the length of a UTF-8 character from its first byte.  The character
+// must already be validated.
+static size_t utf8CharLength(uint8_t c) {
+  if (c < 0xc0) {
+    return 1;
+  }
+  if (c < 0xe0) {
+    return 2;
+  }
+  return c < 0xf0? 3 : 4;
+}
+
 // Speak the text, either normally, or character-by-character if speakChar is set.
 static void speak(swEngine engine, const char *text, bool speakChar) {
   if (!speakChar) {
     swSpeak(engine, text, true);
   } else {
     size_t textLen = strlen(text);
+    char *validText = swCalloc(textLen + 1, sizeof(char));
+    if (swCompactUTF8(validText, text, textLen) != textLen) {
+      fprintf(stderr, "Invalid UTF-8 in %s\n", text);
+      exit(1);
+    }
+    swFree(validText);
     while (textLen != 0) {
-      bool valid = false;
-      uint32_t unicodeChar;
-      size_t charLen = swFindUTF8LengthAndValidate(text, textLen, &valid, &unicodeChar);
-      if (!valid) {
-        fprintf(stderr, "Invalid UTF-8 char %s\n", text);
-        exit(1);
-      }
-      if (charLen > SW_MAX_UTF8_CHAR_LEN) {
-        fprintf(stderr, "Internal error in swFindUTF8Length\n");
-        exit(1);
-      }
+      size_t charLen = utf8CharLength(*text);
       char buf[SW_MAX_UTF8_CHAR_LEN + 1];
       memcpy(buf, text, charLen);
       buf[charLen] = '\0';
@@ -179,6 +180,29 @@ static void speak(swEngine engine, const char *text, bool speakChar) {
   }
 }
 
+// Print allocation statistics for one process.
+static void printAllocStats(const char *processName, const swAllocStats *stats) {
+  fprintf(stderr, "%s: %llu live bytes, %llu peak, %llu allocations, %llu frees, "
+      "%.1f allocations/second\n", processName, (unsigned long long)stats->liveBytes,
+      (unsigned long long)stats->peakBytes, (unsigned long long)stats->allocations,
+      (unsigned long long)stats->frees, stats->allocationsPerSecond);
+}
+
+// Report allocation statistics for sw-say and the engine.
+static void reportStats(swEngine engine) {
+  if (!swAllocStatsEnabled()) {
+    fprintf(stderr, "Set SW_ALLOC_STATS=1 to collect allocation statistics\n");
+    return;
+  }
+  swStats stats;
+  if (!swGetStats(engine, &stats)) {
+    fprintf(stderr, "Unable to read statistics from the engine\n");
+    return;
+  }
+  printAllocStats("client", &stats.clientAllocs);
+  printAllocStats("engine", &stats.engineAllocs);
+}
+
 // Speak the text.  Do this in a stream oriented way.
 static void speakText(const char *waveFileName, char *text, const char *textFileName,
     const char *engineName, const char *voice, const char *variant, float speed,
@@ -190,6 +214,11 @@ static void speakText(const char *waveFileName, char *text, const char *textFile
   if (engine == NULL) {
     exit(1);
   }
+  swSetGain(engine, swGain);
+  swEnableSilenceTrim(engine, swTrimSilence);
+  if (swOutputRate != 0) {
+    swSetOutputSampleRate(engine, swOutputRate);
+  }
   uint32_t sampleRate = swGetSampleRate(engine);
   if (waveFileName != NULL) {
     // Open the output wave file.
@@ -198,12 +227,18 @@ static void speakText(const char *waveFileName, char *text, const char *textFile
     // Play to speaker
     openDefaultSoundDevice(sampleRate, &context.outStream, &context.inStream);
   }
-  if (voice != NULL && !  swSetVoice(engine, voice)) {
+  if (voice != NULL && !swSetVoice(engine, voice)) {
     fprintf(stderr, "Could not set voice to %s\n", voice);
   }
   if (variant != NULL && !swSetVariant(engine, variant)) {
     fprintf(stderr, "Could not set voice variant to %s\n", variant);
   }
+  // Settings are sent lazily, so check them now to report a voice the engine
+  // lists but cannot load.
+  if ((voice != NULL || variant != NULL) && !swApplySettings(engine)) {
+    fprintf(stderr, "Could not set voice to %s, variant %s\n", voice != NULL? voice : "default",
+        variant != NULL? variant : "default");
+  }
   if (useSonicSpeed) {
     swEnableSonicSpeed(engine, true);
   }
@@ -225,14 +260,29 @@ static void speakText(const char *waveFileName, char *text, const char *textFile
       exit(1);
     }
     char *paragraph = readParagraph(file);
+    uint32_t previousId = 0;
     while(paragraph != NULL) {
       // TODO: deal with character encoding
-      speak(engine, paragraph, speakChar);
+      if (speakChar) {
+        speak(engine, paragraph, speakChar);
+      } else {
+        // Queue the next paragraph before waiting for this one, so the engine
+        // never waits for us between paragraphs.
+        uint32_t id = swSpeakQueued(engine, paragraph, true);
+        if (previousId != 0) {
+          swWaitForSpeech(engine, previousId);
+        }
+        previousId = id;
+      }
       paragraph = readParagraph(file);
     }
+    swWaitForSpeech(engine, 0);
   } else {
     speak(engine, text, speakChar);
   }
+  if (swReportStats) {
+    reportStats(engine);
+  }
   if (waveFileName != NULL) {
     swCloseWaveFile(context.outWaveFile);
   } else {
@@ -261,10 +311,11 @@ int main(int argc, char *argv[]) {
   bool speakChar = false;
   int32_t punctuationLevel = 1;
   int opt;
-  while ((opt = getopt(argc, argv, "ace:f:lLnp:Ps:Su:v:V:w:")) != -1) {
+  while ((opt = getopt(argc, argv, "ace:f:g:lLmnp:Pr:s:Stu:v:V:w:")) != -1) {
     switch (opt) {
     case 'a':
       swConvertToASCII = true;
+      swInitANSIState(&swANSIConversion);
       break;
     case 'c':
       speakChar = true;
@@ -275,6 +326,13 @@ int main(int argc, char *argv[]) {
     case 'f':
       textFileName = optarg;
       break;
+    case 'g':
+      swGain = atof(optarg);
+      if (swGain < 0.0 || swGain > SW_DSP_MAX_GAIN) {
+        fprintf(stderr, "Gain must be a floating point value from 0 to %g.\n", SW_DSP_MAX_GAIN);
+        usage();
+      }
+      break;
     case 'l': {
       uint32_t numEngines;
       char **engines = swListEngines(swLibDir, &numEngines);
@@ -298,6 +356,9 @@ int main(int argc, char *argv[]) {
     case 'L':
       listVariants = true;
       break;
+    case 'm':
+      swReportStats = true;
+      break;
     case 'p':
       pitch = atof(optarg);
       if (pitch > 100.0 || pitch < -100.0) {
@@ -308,6 +369,13 @@ int main(int argc, char *argv[]) {
     case 'P':
       useSonicPitch = true;
       break;
+    case 'r':
+      swOutputRate = atoi(optarg);
+      if (swOutputRate < 1000 || swOutputRate > 192000) {
+        fprintf(stderr, "Sample rate must be from 1000 to 192000.\n");
+        usage();
+      }
+      break;
     case 's':
       speed = atof(optarg);
       if (speed > 100.0 || speed < -100.0) {
@@ -318,6 +386,9 @@ int main(int argc, char *argv[]) {
     case 'S':
       useSonicSpeed = true;
       break;
+    case 't':
+      swTrimSilence = true;
+      break;
     case 'u':
       punctuationLevel = atoi(optarg);
       break;
@@ -0,0 +1,173 @@
+// Trace-event export.  Events are written in the JSON array format described in
+// Google's "Trace Event Format" document.  The closing ']' is optional in that
+// format, which lets several processes append to one file.
+
+// For clock_gettime.
+#define _POSIX_C_SOURCE 200112L
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "trace.h"
+
+#define SW_TRACE_BUFFER_SIZE (1 << 16)
+// Flush when the buffer has less room than the largest event needs.
+#define SW_TRACE_MAX_EVENT_LEN 512
+
+int swTraceActive = 0;
+static int swTraceFd = -1;
+static int swTracePid;
+static char swTraceBuffer[SW_TRACE_BUFFER_SIZE];
+static uint32_t swTraceBufferPos;
+static pthread_mutex_t swTraceMutex = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t swTraceNextThreadId;
+static __thread uint32_t swTraceThreadId;
+
+// Write the buffer to the trace file.  Each write holds only whole events, and
+// the file is opened with O_APPEND, so events from different processes do not
+// interleave.  The caller must hold swTraceMutex.
+static void flushBuffer(void) {
+  uint32_t pos = 0;
+  while (pos < swTraceBufferPos) {
+    ssize_t written = write(swTraceFd, swTraceBuffer + pos, swTraceBufferPos - pos);
+    if (written <= 0) {
+      break;
+    }
+    pos += written;
+  }
+  swTraceBufferPos = 0;
+}
+
+// Write any buffered events to the trace file.
+void swTraceFlush(void) {
+  if (!swTraceActive) {
+    return;
+  }
+  pthread_mutex_lock(&swTraceMutex);
+  flushBuffer();
+  pthread_mutex_unlock(&swTraceMutex);
+}
+
+// Return the current time in microseconds, or 0 if not tracing.
+// CLOCK_MONOTONIC is shared by all processes, so client and engine events line
+// up.
+uint64_t swTraceNow(void) {
+  if (!swTraceActive) {
+    return 0;
+  }
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec*1000000 + now.tv_nsec/1000;
+}
+
+// Return a small id for the calling thread.  Perfetto draws one track per id.
+static uint32_t threadId(void) {
+  if (swTraceThreadId == 0) {
+    swTraceThreadId = __atomic_add_fetch(&swTraceNextThreadId, 1, __ATOMIC_RELAXED);
+  }
+  return swTraceThreadId;
+}
+
+// Append a formatted event to the buffer.  The event should be a JSON object
+// without the trailing comma.
+static void addEvent(const char *format, ...) __attribute__((format(printf, 1, 2)));
+static void addEvent(const char *format, ...) {
+  pthread_mutex_lock(&swTraceMutex);
+  if (SW_TRACE_BUFFER_SIZE - swTraceBufferPos < SW_TRACE_MAX_EVENT_LEN) {
+    flushBuffer();
+  }
+  va_list ap;
+  va_start(ap, format);
+  int length = vsnprintf(swTraceBuffer + swTraceBufferPos, SW_TRACE_MAX_EVENT_LEN - 2,
+      format, ap);
+  va_end(ap);
+  if (length > 0 && length < SW_TRACE_MAX_EVENT_LEN - 2) {
+    swTraceBufferPos += length;
+    swTraceBuffer[swTraceBufferPos++] = ',';
+    swTraceBuffer[swTraceBufferPos++] = '\n';
+  }
+  pthread_mutex_unlock(&swTraceMutex);
+}
+
+// Start tracing if SW_TRACE is set.
+void swTraceStart(const char *processName, bool truncate) {
+  const char *fileName = getenv("SW_TRACE");
+  if (swTraceActive || fileName == NULL || *fileName == '\0') {
+    return;
+  }
+  int flags = O_WRONLY | O_CREAT | O_APPEND;
+  if (truncate) {
+    flags |= O_TRUNC;
+  }
+  swTraceFd = open(fileName, flags, 0644);
+  if (swTraceFd < 0) {
+    fprintf(stderr, "Unable to open trace file %s\n", fileName);
+    return;
+  }
+  swTracePid = getpid();
+  struct stat status;
+  if (fstat(swTraceFd, &status) == 0 && status.st_size == 0) {
+    if (write(swTraceFd, "[\n", 2) != 2) {
+      close(swTraceFd);
+      return;
+    }
+  }
+  swTraceActive = 1;
+  addEvent("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"%s\"}}",
+      swTracePid, processName);
+  atexit(swTraceFlush);
+}
+
+// Record the start of a span on the current thread.
+void swTraceBegin(const char *name) {
+  if (!swTraceActive) {
+    return;
+  }
+  addEvent("{\"name\":\"%s\",\"ph\":\"B\",\"pid\":%d,\"tid\":%u,\"ts\":%llu}",
+      name, swTracePid, threadId(), (unsigned long long)swTraceNow());
+}
+
+// Record the end of a span on the current thread.
+void swTraceEnd(const char *name) {
+  if (!swTraceActive) {
+    return;
+  }
+  addEvent("{\"name\":\"%s\",\"ph\":\"E\",\"pid\":%d,\"tid\":%u,\"ts\":%llu}",
+      name, swTracePid, threadId(), (unsigned long long)swTraceNow());
+}
+
+// Record a span that started at startTime.
+void swTraceComplete(const char *name, uint64_t startTime, const char *argName,
+    int64_t argValue) {
+  if (!swTraceActive) {
+    return;
+  }
+  uint64_t duration = swTraceNow() - startTime;
+  if (argName == NULL) {
+    addEvent("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,\"ts\":%llu,\"dur\":%llu}",
+        name, swTracePid, threadId(), (unsigned long long)startTime,
+        (unsigned long long)duration);
+  } else {
+    addEvent("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,\"ts\":%llu,\"dur\":%llu,"
+        "\"args\":{\"%s\":%lld}}", name, swTracePid, threadId(),
+        (unsigned long long)startTime, (unsigned long long)duration, argName,
+        (long long)argValue);
+  }
+}
+
+// Record a point event.
+void swTraceInstant(const char *name) {
+  if (!swTraceActive) {
+    return;
+  }
+  addEvent("{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":%d,\"tid\":%u,\"ts\":%llu}",
+      name, swTracePid, threadId(), (unsigned long long)swTraceNow());
+}
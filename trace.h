@@ -0,0 +1,36 @@
+// Trace-event export for viewing in Perfetto or chrome://tracing.
+//
+// Set SW_TRACE=file.json in the environment to record a trace.  libspeechsw and
+// the engine processes it starts all append to the same file, using process ids
+// and the system-wide monotonic clock, so one file shows the whole pipeline.
+
+#ifndef SW_TRACE_H
+#define SW_TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Non-zero when tracing.  Check this before computing trace arguments.
+extern int swTraceActive;
+
+// Start tracing if SW_TRACE is set.  The client truncates the file and writes
+// the header.  Engines append to whatever the client started.  Calling this
+// more than once has no effect.
+void swTraceStart(const char *processName, bool truncate);
+// Write any buffered events to the trace file.  This is called at exit, but
+// engines also call it at the end of each utterance, in case they are killed.
+void swTraceFlush(void);
+// Return the current time in microseconds, for swTraceComplete.  Returns 0 when
+// not tracing, to avoid reading the clock.
+uint64_t swTraceNow(void);
+// Record the start and end of a span on the current thread.
+void swTraceBegin(const char *name);
+void swTraceEnd(const char *name);
+// Record a span that started at startTime.  If argName is not NULL, argValue is
+// attached to the event.
+void swTraceComplete(const char *name, uint64_t startTime, const char *argName,
+    int64_t argValue);
+// Record a point event.
+void swTraceInstant(const char *name);
+
+#endif  // SW_TRACE_H
@@ -0,0 +1,257 @@
+// Bulk UTF-8 validation.  The SIMD paths use the lookup algorithm from Keiser
+// and Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte": three
+// 16-entry tables, indexed by the nibbles of each byte and the byte before it,
+// flag every bad two-byte pattern, and saturating subtracts find the bytes that
+// must be the third or fourth of a character.  A block that passes, and has no
+// control characters, is kept whole.  Anything else is handled a character at a
+// time by swFindUTF8LengthAndValidate, so the result is always exactly what the
+// scalar rules give.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SW_UTF8_SIMD
+#endif
+
+#include "utf8.h"
+#include "util.h"
+
+// Copy the character at text to *dest if it is valid, and advance *dest.
+// Return the number of bytes consumed.
+static inline size_t copyChar(char **dest, const char *text, size_t length) {
+  uint8_t c = *text;
+  if (c >= ' ' && c < 0x80) {
+    *(*dest)++ = c;
+    return 1;
+  }
+  bool valid;
+  size_t charLen = swFindUTF8LengthAndValidate(text, length, &valid, NULL);
+  if (valid) {
+    memmove(*dest, text, charLen);
+    *dest += charLen;
+  }
+  return charLen;
+}
+
+// Compact a character at a time.
+static size_t compactScalar(char *dest, const char *text, size_t length) {
+  char *out = dest;
+  const char *p = text;
+  const char *end = text + length;
+  while (p < end) {
+    p += copyChar(&out, p, end - p);
+  }
+  return out - dest;
+}
+
+#ifdef SW_UTF8_SIMD
+
+// Error bits set by the lookup tables.
+#define TOO_SHORT (1 << 0)  // A lead byte not followed by a continuation byte.
+#define TOO_LONG (1 << 1)  // A continuation byte after ASCII.
+#define OVERLONG_3 (1 << 2)
+#define TOO_LARGE (1 << 3)
+#define SURROGATE (1 << 4)
+#define OVERLONG_2 (1 << 5)
+#define TOO_LARGE_1000 (1 << 6)
+#define OVERLONG_4 (1 << 6)
+#define TWO_CONTS (1 << 7)  // Two continuation bytes, unless 3-byte or 4-byte.
+#define CARRY (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+// Indexed by the high nibble of the previous byte.
+static const uint8_t byte1HighTable[16] = {
+  TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+  TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+  TOO_SHORT | OVERLONG_2,
+  TOO_SHORT,
+  TOO_SHORT | OVERLONG_3 | SURROGATE,
+  TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+};
+
+// Indexed by the low nibble of the previous byte.
+static const uint8_t byte1LowTable[16] = {
+  CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+  CARRY | OVERLONG_2,
+  CARRY,
+  CARRY,
+  CARRY | TOO_LARGE,
+  CARRY | TOO_LARGE | TOO_LARGE_1000,
+  CARRY | TOO_LARGE | TOO_LARGE_1000,
+  CARRY | TOO_LARGE | TOO_LARGE_1000,
+  CARRY | TOO_LARGE | TOO_LARGE_1000,
+  CARRY | TOO_LARGE | TOO_LARGE_1000,
+  CARRY | TOO_LARGE | TOO_LARGE_1000,
+  CARRY | TOO_LARGE | TOO_LARGE_1000,
+  CARRY | TOO_LARGE | TOO_LARGE_1000,
+  CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+  CARRY | TOO_LARGE | TOO_LARGE_1000,
+  CARRY | TOO_LARGE | TOO_LARGE_1000
+};
+
+// Indexed by the high nibble of the current byte.
+static const uint8_t byte2HighTable[16] = {
+  TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+  TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+  TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+  TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+  TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+  TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+};
+
+// Return how many bytes of a block that passed the SIMD check can be kept.  The
+// block starts on a character boundary, but its last character may be cut off,
+// or followed by continuation bytes that make the whole sequence invalid.  In
+// either case, stop before that character, so the next block starts with it.
+static inline size_t completeLength(const char *block, size_t size, const char *end) {
+  const uint8_t *p = (const uint8_t *)block;
+  if (p[size - 1] >= 0xc0) {
+    return size - 1;
+  }
+  if (p[size - 2] >= 0xe0) {
+    return size - 2;
+  }
+  if (p[size - 3] >= 0xf0) {
+    return size - 3;
+  }
+  if (block + size < end && (p[size] & 0xc0) == 0x80) {
+    size--;
+    while ((p[size] & 0xc0) == 0x80) {
+      size--;
+    }
+  }
+  return size;
+}
+
+// Keep size bytes of a checked block.  Nothing moves until something is dropped.
+static inline void keepBlock(char *out, const char *p, size_t size) {
+  if (out != p) {
+    memmove(out, p, size);
+  }
+}
+
+// Return true if 16 bytes are valid UTF-8 with no control characters, assuming
+// they start on a character boundary and ignoring a cut-off final character.
+__attribute__((target("sse4.1")))
+static inline bool checkBlockSSE4(const char *p) {
+  __m128i input = _mm_loadu_si128((const __m128i *)p);
+  __m128i controls = _mm_cmpeq_epi8(_mm_min_epu8(input, _mm_set1_epi8(0x1f)), input);
+  if (_mm_movemask_epi8(input) == 0) {
+    return _mm_movemask_epi8(controls) == 0;
+  }
+  __m128i prev1 = _mm_slli_si128(input, 1);
+  __m128i prev2 = _mm_slli_si128(input, 2);
+  __m128i prev3 = _mm_slli_si128(input, 3);
+  __m128i nibbleMask = _mm_set1_epi8(0x0f);
+  __m128i byte1High = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)byte1HighTable),
+      _mm_and_si128(_mm_srli_epi16(prev1, 4), nibbleMask));
+  __m128i byte1Low = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)byte1LowTable),
+      _mm_and_si128(prev1, nibbleMask));
+  __m128i byte2High = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)byte2HighTable),
+      _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask));
+  __m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+  // Only 111_____ and 1111____ have the high bit set after these subtracts.
+  __m128i isThird = _mm_subs_epu8(prev2, _mm_set1_epi8(0xe0 - 0x80));
+  __m128i isFourth = _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0 - 0x80));
+  __m128i mustBeCont = _mm_and_si128(_mm_or_si128(isThird, isFourth), _mm_set1_epi8(0x80));
+  __m128i error = _mm_or_si128(_mm_xor_si128(mustBeCont, special), controls);
+  return _mm_testz_si128(error, error);
+}
+
+// Compact 16 bytes at a time.
+__attribute__((target("sse4.1")))
+static size_t compactSSE4(char *dest, const char *text, size_t length) {
+  char *out = dest;
+  const char *p = text;
+  const char *end = text + length;
+  while (end - p >= 16) {
+    if (checkBlockSSE4(p)) {
+      size_t size = completeLength(p, 16, end);
+      keepBlock(out, p, size);
+      out += size;
+      p += size;
+    } else {
+      // Something in the block is dropped.
+      const char *blockEnd = p + 16;
+      while (p < blockEnd) {
+        p += copyChar(&out, p, end - p);
+      }
+    }
+  }
+  return out - dest + compactScalar(out, p, end - p);
+}
+
+// Return true if 32 bytes are valid UTF-8 with no control characters, assuming
+// they start on a character boundary and ignoring a cut-off final character.
+__attribute__((target("avx2")))
+static inline bool checkBlockAVX2(const char *p) {
+  __m256i input = _mm256_loadu_si256((const __m256i *)p);
+  __m256i controls = _mm256_cmpeq_epi8(_mm256_min_epu8(input, _mm256_set1_epi8(0x1f)), input);
+  if (_mm256_movemask_epi8(input) == 0) {
+    return _mm256_movemask_epi8(controls) == 0;
+  }
+  // Shifting bytes across the two 128-bit lanes takes a permute and alignr.
+  __m256i lowLaneUp = _mm256_permute2x128_si256(input, input, 0x08);
+  __m256i prev1 = _mm256_alignr_epi8(input, lowLaneUp, 15);
+  __m256i prev2 = _mm256_alignr_epi8(input, lowLaneUp, 14);
+  __m256i prev3 = _mm256_alignr_epi8(input, lowLaneUp, 13);
+  __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+  __m256i byte1High = _mm256_shuffle_epi8(
+      _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)byte1HighTable)),
+      _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibbleMask));
+  __m256i byte1Low = _mm256_shuffle_epi8(
+      _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)byte1LowTable)),
+      _mm256_and_si256(prev1, nibbleMask));
+  __m256i byte2High = _mm256_shuffle_epi8(
+      _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)byte2HighTable)),
+      _mm256_and_si256(_mm256_srli_epi16(input, 4), nibbleMask));
+  __m256i special = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+  __m256i isThird = _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xe0 - 0x80));
+  __m256i isFourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xf0 - 0x80));
+  __m256i mustBeCont = _mm256_and_si256(_mm256_or_si256(isThird, isFourth),
+      _mm256_set1_epi8(0x80));
+  __m256i error = _mm256_or_si256(_mm256_xor_si256(mustBeCont, special), controls);
+  return _mm256_testz_si256(error, error);
+}
+
+// Compact 32 bytes at a time.
+__attribute__((target("avx2")))
+static size_t compactAVX2(char *dest, const char *text, size_t length) {
+  char *out = dest;
+  const char *p = text;
+  const char *end = text + length;
+  while (end - p >= 32) {
+    if (checkBlockAVX2(p)) {
+      size_t size = completeLength(p, 32, end);
+      keepBlock(out, p, size);
+      out += size;
+      p += size;
+    } else {
+      // Something in the block is dropped.
+      const char *blockEnd = p + 32;
+      while (p < blockEnd) {
+        p += copyChar(&out, p, end - p);
+      }
+    }
+  }
+  return out - dest + compactSSE4(out, p, end - p);
+}
+
+#endif  // SW_UTF8_SIMD
+
+// Copy length bytes of text to dest, dropping invalid UTF-8 and control
+// characters.  Return the number of bytes written.
+size_t swCompactUTF8(char *dest, const char *text, size_t length) {
+#ifdef SW_UTF8_SIMD
+  switch (swGetSimdLevel()) {
+  case SW_SIMD_AVX2:
+    return compactAVX2(dest, text, length);
+  case SW_SIMD_SSE4:
+    return compactSSE4(dest, text, length);
+  case SW_SIMD_NONE:
+    break;
+  }
+#endif
+  return compactScalar(dest, text, length);
+}
@@ -0,0 +1,21 @@
+// Bulk UTF-8 validation.
+//
+// swCompactUTF8 applies the same rules as swFindUTF8LengthAndValidate to a
+// whole buffer at once: overlong encodings, surrogates, values above 0x10ffff,
+// stray continuation bytes, truncated sequences, and ASCII control characters
+// are all dropped.  Blocks of 32 or 16 bytes are checked with AVX2 or SSE4 when
+// the CPU has them, and only blocks containing something to drop are handled a
+// character at a time.
+
+#ifndef SW_UTF8_H
+#define SW_UTF8_H
+
+#include <stddef.h>
+
+// Copy length bytes of text to dest, dropping invalid UTF-8 and control
+// characters.  dest may be the same as text, to compact in place, but the
+// buffers must not otherwise overlap.  Return the number of bytes written.  No
+// terminating NUL is added.
+size_t swCompactUTF8(char *dest, const char *text, size_t length);
+
+#endif  // SW_UTF8_H
@@ -1,37 +1,210 @@
+// For nanosleep and clock_gettime.
+#define _POSIX_C_SOURCE 200112L
+
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <dirent.h>
-#include <stdarg.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "util.h"
 
-static FILE *swLogFile = NULL;
+// Logging is asynchronous.  Callers format their message into a slot of a
+// lock-free ring, and a background thread writes the ring to the log file.  If
+// the ring is full, the message is dropped and counted rather than blocking the
+// caller.  The ring is the bounded MPMC queue described by Dmitry Vyukov: each
+// slot's sequence number tells producers and the consumer whose turn it is.
+#define SW_LOG_RING_SIZE 512  // Must be a power of 2.
+#define SW_LOG_MESSAGE_LEN 256
+#define SW_LOG_FLUSH_NANOSECONDS 20000000
+
+typedef struct {
+  uint64_t sequence;
+  uint32_t length;
+  char text[SW_LOG_MESSAGE_LEN];
+} swLogSlot;
 
-#ifdef SW_DEBUG
+int swLogThreshold = SW_LOG_DEBUG;  // Lowered by initLog on first use.
+static swLogSlot swLogRing[SW_LOG_RING_SIZE];
+static uint64_t swLogEnqueuePos, swLogDequeuePos;
+static uint64_t swLogDropped, swLogDroppedReported;
+static pthread_once_t swLogOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t swLogFileMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t swLogThread;
+static bool swLogThreadRunning;
+static bool swLogStopping;
+static FILE *swLogFile;
+static char *swLogFileName;
+
+// Parse the SW_LOG_LEVEL environment variable.
+static int readLogLevel(void) {
+  static const char *names[] = {"none", "error", "warn", "info", "debug"};
+  const char *value = getenv("SW_LOG_LEVEL");
+  if (value == NULL || *value == '\0') {
+    return SW_LOG_WARN;
+  }
+  for (int i = SW_LOG_NONE; i <= SW_LOG_DEBUG; i++) {
+    if (!strcasecmp(value, names[i])) {
+      return i;
+    }
+  }
+  int level = atoi(value);
+  if (level < SW_LOG_NONE) {
+    return SW_LOG_NONE;
+  }
+  return level > SW_LOG_DEBUG? SW_LOG_DEBUG : level;
+}
+
+// Write all queued messages to the log file.  Only one thread at a time may
+// drain the ring: the log thread, or the caller if there is no log thread.
+static void drainLogRing(void) {
+  pthread_mutex_lock(&swLogFileMutex);
+  bool wrote = false;
+  for (;;) {
+    uint64_t pos = swLogDequeuePos;
+    swLogSlot *slot = swLogRing + (pos & (SW_LOG_RING_SIZE - 1));
+    if (__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) != pos + 1) {
+      break;
+    }
+    if (swLogFile == NULL) {
+      swLogFile = fopen(swLogFileName != NULL? swLogFileName : "/tmp/speechsw.log", "w");
+    }
+    if (swLogFile != NULL) {
+      fwrite(slot->text, sizeof(char), slot->length, swLogFile);
+      wrote = true;
+    }
+    __atomic_store_n(&slot->sequence, pos + SW_LOG_RING_SIZE, __ATOMIC_RELEASE);
+    swLogDequeuePos = pos + 1;
+  }
+  uint64_t dropped = __atomic_load_n(&swLogDropped, __ATOMIC_RELAXED);
+  if (dropped != swLogDroppedReported && swLogFile != NULL) {
+    fprintf(swLogFile, "Log ring full: dropped %llu messages\n",
+        (unsigned long long)(dropped - swLogDroppedReported));
+    swLogDroppedReported = dropped;
+    wrote = true;
+  }
+  if (wrote) {
+    fflush(swLogFile);
+  }
+  pthread_mutex_unlock(&swLogFileMutex);
+}
+
+// The log thread wakes up periodically and writes whatever has been queued.
+static void *logThreadMain(void *arg) {
+  struct timespec delay = {0, SW_LOG_FLUSH_NANOSECONDS};
+  while (!__atomic_load_n(&swLogStopping, __ATOMIC_ACQUIRE)) {
+    drainLogRing();
+    nanosleep(&delay, NULL);
+  }
+  drainLogRing();
+  return NULL;
+}
+
+// Stop the log thread and write any remaining messages.  Registered with atexit.
+static void stopLog(void) {
+  if (swLogThreadRunning) {
+    __atomic_store_n(&swLogStopping, true, __ATOMIC_RELEASE);
+    pthread_join(swLogThread, NULL);
+    swLogThreadRunning = false;
+  }
+  drainLogRing();
+  if (swLogFile != NULL) {
+    fclose(swLogFile);
+    swLogFile = NULL;
+  }
+}
+
+// Read the log level and start the log thread.  Called once, on first use.
+static void initLog(void) {
+  for (uint32_t i = 0; i < SW_LOG_RING_SIZE; i++) {
+    swLogRing[i].sequence = i;
+  }
+  int threshold = readLogLevel();
+  // Other threads may be checking it in swLogAt.
+  __atomic_store_n(&swLogThreshold, threshold, __ATOMIC_RELAXED);
+  if (threshold == SW_LOG_NONE) {
+    return;
+  }
+  // If the thread cannot be started, callers drain the ring themselves.
+  swLogThreadRunning = pthread_create(&swLogThread, NULL, logThreadMain, NULL) == 0;
+  atexit(stopLog);
+}
+
+// Format a message into the next free slot of the log ring.
+static void logMessage(swLogLevel level, const char *format, va_list ap) {
+  pthread_once(&swLogOnce, initLog);
+  if ((int)level > swLogThreshold) {
+    return;
+  }
+  uint64_t pos = __atomic_load_n(&swLogEnqueuePos, __ATOMIC_RELAXED);
+  swLogSlot *slot;
+  for (;;) {
+    slot = swLogRing + (pos & (SW_LOG_RING_SIZE - 1));
+    uint64_t sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+    int64_t diff = (int64_t)(sequence - pos);
+    if (diff == 0) {
+      if (__atomic_compare_exchange_n(&swLogEnqueuePos, &pos, pos + 1, true,
+          __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // The ring is full.
+      __atomic_add_fetch(&swLogDropped, 1, __ATOMIC_RELAXED);
+      return;
+    } else {
+      pos = __atomic_load_n(&swLogEnqueuePos, __ATOMIC_RELAXED);
+    }
+  }
+  int length = vsnprintf(slot->text, SW_LOG_MESSAGE_LEN, format, ap);
+  if (length < 0) {
+    length = 0;
+  } else if (length >= SW_LOG_MESSAGE_LEN) {
+    // Mark truncated messages, such as long lines of hex samples.
+    length = SW_LOG_MESSAGE_LEN - 1;
+    memcpy(slot->text + length - 4, "...\n", 4);
+  }
+  slot->length = length;
+  __atomic_store_n(&slot->sequence, pos + 1, __ATOMIC_RELEASE);
+  if (!swLogThreadRunning) {
+    drainLogRing();
+  }
+}
 
 // Call at program initialization to set the name of the log file.
 void swSetLogFileName(const char *logFileName) {
+  pthread_mutex_lock(&swLogFileMutex);
   if (swLogFile != NULL) {
     fclose(swLogFile);
+    swLogFile = NULL;
   }
-  swLogFile = fopen(logFileName, "w");
+  swFree(swLogFileName);
+  swLogFileName = swCopyString(logFileName);
+  pthread_mutex_unlock(&swLogFileMutex);
+}
+
+// Queue a formatted message for the log file.
+void swLogWrite(swLogLevel level, const char *format, ...) {
+  va_list ap;
+  va_start(ap, format);
+  logMessage(level, format, ap);
+  va_end(ap);
 }
 
 // Write a formatted string to the log file.
 void swLog(const char *format, ...) {
-  if (swLogFile == NULL) {
-    swLogFile = fopen("/tmp/speechsw.log", "w");
-  }
   va_list ap;
   va_start(ap, format);
-  vfprintf(swLogFile, format, ap);
+  logMessage(SW_LOG_INFO, format, ap);
   va_end(ap);
-  fflush(swLogFile);
 }
-#endif
 
 // Just make a copy of a string.
 char *swCopyString(const char *string) {
@@ -93,9 +266,9 @@ char **swListDirectory(const char *dirName, uint32_t *numFiles) {
 // This function, frees a voice list created with getVoices.
 void swFreeStringList(char **stringList, uint32_t numStrings) {
   for (int i = 0; i < numStrings; i++) {
-    free(stringList[i]);
+    swFree(stringList[i]);
   }
-  free(stringList);
+  swFree(stringList);
 }
 
 // Make a copy of a string list.
@@ -142,7 +315,7 @@ char *swReadLine(FILE *file) {
     c = getc(file);
   }
   buf[pos] = '\0';
-  swLog("swReadLine: %s\n", buf);
+  swLogDebug("swReadLine: %s\n", buf);
   return buf;
 }
 
@@ -201,33 +374,204 @@ int swForkWithStdio(const char *exePath, FILE **fin, FILE **fout, ...) {
   return pid;
 }
 
+// Give a child process up to graceMilliseconds to exit on its own, so it can
+// flush its logs, and then kill it.  The child is reaped either way.
+void swStopChild(int pid, uint32_t graceMilliseconds) {
+  struct timespec delay = {0, 5000000};
+  for (uint32_t waited = 0; waited < graceMilliseconds; waited += 5) {
+    if (waitpid(pid, NULL, WNOHANG) != 0) {
+      return;
+    }
+    nanosleep(&delay, NULL);
+  }
+  kill(pid, SIGKILL);
+  waitpid(pid, NULL, 0);
+}
+
+// Allocation statistics are kept with atomic counters, so any thread may
+// allocate.  Live bytes are measured with malloc_usable_size, so no header is
+// needed and swFree does not need to know the call site.
+#define SW_ALLOC_SITES 512  // Must be a power of 2.
+
+typedef struct {
+  const char *file;
+  int line;
+  volatile bool used;
+  uint64_t allocations;
+  uint64_t bytes;
+} swAllocSite;
+
+static int swAllocStatsMode = -1;  // -1 until SW_ALLOC_STATS is read.
+static uint64_t swAllocLive, swAllocPeak, swAllocCount, swAllocFrees, swAllocBytes;
+static uint64_t swAllocStartTime;
+static swAllocSite swAllocSites[SW_ALLOC_SITES];
+static pthread_mutex_t swAllocSiteMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Return the monotonic time in microseconds.
+static uint64_t microseconds(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec*1000000 + now.tv_nsec/1000;
+}
+
+// Write the allocation report to stderr.  Registered with atexit.
+static void reportAllocs(void) {
+  swWriteAllocReport(stderr);
+}
+
+// Read SW_ALLOC_STATS.  This happens on the first allocation, so every block
+// freed with swFree was counted when allocated.
+static bool allocStatsEnabled(void) {
+  int mode = swAllocStatsMode;
+  if (mode < 0) {
+    const char *value = getenv("SW_ALLOC_STATS");
+    mode = value != NULL && *value != '\0' && strcmp(value, "0");
+    if (mode && !strcmp(value, "report")) {
+      atexit(reportAllocs);
+    }
+    swAllocStartTime = microseconds();
+    swAllocStatsMode = mode;
+  }
+  return mode;
+}
+
+// Find or create the statistics for a call site.
+static swAllocSite *findAllocSite(const char *file, int line) {
+  uint32_t hash = (((uintptr_t)file >> 3) * 31 + line) * 2654435761u;
+  uint32_t start = hash & (SW_ALLOC_SITES - 1);
+  uint32_t i = start;
+  do {
+    swAllocSite *site = swAllocSites + i;
+    if (!site->used) {
+      // Claim the slot, unless another thread just claimed it for this site.
+      pthread_mutex_lock(&swAllocSiteMutex);
+      if (!site->used) {
+        site->file = file;
+        site->line = line;
+        __atomic_store_n(&site->used, true, __ATOMIC_RELEASE);
+        pthread_mutex_unlock(&swAllocSiteMutex);
+        return site;
+      }
+      pthread_mutex_unlock(&swAllocSiteMutex);
+    }
+    if (site->line == line && site->file == file) {
+      return site;
+    }
+    i = (i + 1) & (SW_ALLOC_SITES - 1);
+  } while (i != start);
+  return NULL;  // The table is full.  Only the totals are counted.
+}
+
+// Count an allocation of size bytes, replacing oldSize bytes.
+static void countAlloc(size_t size, size_t oldSize, const char *file, int line) {
+  __atomic_add_fetch(&swAllocCount, 1, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&swAllocBytes, size, __ATOMIC_RELAXED);
+  uint64_t live = __atomic_add_fetch(&swAllocLive, size - oldSize, __ATOMIC_RELAXED);
+  uint64_t peak = __atomic_load_n(&swAllocPeak, __ATOMIC_RELAXED);
+  while (live > peak && !__atomic_compare_exchange_n(&swAllocPeak, &peak, live, true,
+      __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+  swAllocSite *site = findAllocSite(file, line);
+  if (site != NULL) {
+    __atomic_add_fetch(&site->allocations, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&site->bytes, size, __ATOMIC_RELAXED);
+  }
+}
+
 // Call calloc, and exit on failure with an error message to stderr.
-void *swCalloc(size_t numElements, size_t elementSize) {
+void *swCallocAt(size_t numElements, size_t elementSize, const char *file, int line) {
   void *mem = calloc(numElements, elementSize);
   if (mem == NULL) {
     fprintf(stderr, "Out of memory\n");
     exit(1);
   }
+  if (allocStatsEnabled()) {
+    countAlloc(malloc_usable_size(mem), 0, file, line);
+  }
   return mem;
 }
 
 // Call recalloc, and exit on failure with an error message to stderr.
-void *swRealloc(void *mem, size_t numElements, size_t elementSize) {
+void *swReallocAt(void *mem, size_t numElements, size_t elementSize, const char *file,
+    int line) {
+  size_t oldSize = 0;
+  if (mem != NULL && allocStatsEnabled()) {
+    oldSize = malloc_usable_size(mem);
+  }
   mem = realloc(mem, numElements*elementSize);
   if (mem == NULL) {
     fprintf(stderr, "Out of memory\n");
     exit(1);
   }
+  if (allocStatsEnabled()) {
+    countAlloc(malloc_usable_size(mem), oldSize, file, line);
+  }
   return mem;
 }
 
 // Free memory.  Do nothing if mem is NULL.
 void swFree(void *mem) {
   if (mem != NULL) {
+    if (allocStatsEnabled()) {
+      __atomic_sub_fetch(&swAllocLive, malloc_usable_size(mem), __ATOMIC_RELAXED);
+      __atomic_add_fetch(&swAllocFrees, 1, __ATOMIC_RELAXED);
+    }
     free(mem);
   }
 }
 
+// Return true if allocation statistics are being collected.
+bool swAllocStatsEnabled(void) {
+  return allocStatsEnabled();
+}
+
+// Read the allocation statistics of this process.
+void swGetAllocStats(swAllocStats *stats) {
+  memset(stats, 0, sizeof(swAllocStats));
+  if (!allocStatsEnabled()) {
+    return;
+  }
+  stats->liveBytes = __atomic_load_n(&swAllocLive, __ATOMIC_RELAXED);
+  stats->peakBytes = __atomic_load_n(&swAllocPeak, __ATOMIC_RELAXED);
+  stats->allocations = __atomic_load_n(&swAllocCount, __ATOMIC_RELAXED);
+  stats->frees = __atomic_load_n(&swAllocFrees, __ATOMIC_RELAXED);
+  stats->bytesAllocated = __atomic_load_n(&swAllocBytes, __ATOMIC_RELAXED);
+  uint64_t elapsed = microseconds() - swAllocStartTime;
+  if (elapsed != 0) {
+    stats->allocationsPerSecond = stats->allocations*1000000.0/elapsed;
+  }
+}
+
+// Compare call sites by number of allocations, for qsort.
+static int compareAllocSites(const void *a, const void *b) {
+  uint64_t countA = (*(const swAllocSite **)a)->allocations;
+  uint64_t countB = (*(const swAllocSite **)b)->allocations;
+  return countA < countB? 1 : countA > countB? -1 : 0;
+}
+
+// Write allocation counts per call site, busiest first.
+void swWriteAllocReport(FILE *file) {
+  swAllocStats stats;
+  swGetAllocStats(&stats);
+  fprintf(file, "Allocations for process %d: %llu live bytes, %llu peak, "
+      "%llu allocations, %llu frees, %.1f allocations/second\n", (int)getpid(),
+      (unsigned long long)stats.liveBytes, (unsigned long long)stats.peakBytes,
+      (unsigned long long)stats.allocations, (unsigned long long)stats.frees,
+      stats.allocationsPerSecond);
+  const swAllocSite *sites[SW_ALLOC_SITES];
+  uint32_t numSites = 0;
+  for (uint32_t i = 0; i < SW_ALLOC_SITES; i++) {
+    if (swAllocSites[i].used) {
+      sites[numSites++] = swAllocSites + i;
+    }
+  }
+  qsort(sites, numSites, sizeof(swAllocSite *), compareAllocSites);
+  for (uint32_t i = 0; i < numSites; i++) {
+    fprintf(file, "  %s:%d: %llu allocations, %llu bytes\n", sites[i]->file,
+        sites[i]->line, (unsigned long long)sites[i]->allocations,
+        (unsigned long long)sites[i]->bytes);
+  }
+}
+
 // Return the length of the UTF-8 character pointed to by p.  Check that the
 // encoding seems valid. We do the full check as defined on Wikipedia because
 // so many applications, likely including commercial TTS engines, leave security
@@ -269,20 +613,10 @@ uint8_t swFindUTF8LengthAndValidate(const char *text, size_t textLen,
     *valid = false;
   }
   size_t length = 1;
-  if (length >= textLen) {
-    *valid = false;
-    return textLen;
-  }
-  c = *++text;
-  while((c & 0xc0) == 0x80) {
-    unicodeCharacter = (unicodeCharacter << 6) | (c & 0x3f);
+  while(length < textLen && ((uint8_t)text[length] & 0xc0) == 0x80) {
+    unicodeCharacter = (unicodeCharacter << 6) | ((uint8_t)text[length] & 0x3f);
     bits += 6;
     length++;
-    if (length >= textLen) {
-      *valid = false;
-      return textLen;
-    }
-    c = *++text;
   }
   if (length != expectedLength || unicodeCharacter > 0x10ffff ||
       (unicodeCharacter >= 0xd800 && unicodeCharacter <= 0xdfff)) {
@@ -296,9 +630,8 @@ uint8_t swFindUTF8LengthAndValidate(const char *text, size_t textLen,
     *valid = false;
   }
   if (unicodeChar != NULL) {
-    *unicodeChar = 0;
-   }
-  *unicodeChar = unicodeCharacter;
+    *unicodeChar = unicodeCharacter;
+  }
   return length;
 }
 
@@ -313,105 +646,207 @@ uint32_t swEncodeUTF8(uint32_t unicodeChar, char *out) {
   if (unicodeChar <= 0x7ff) {
     // Second code point.
     out[0] = 0xc0 | (unicodeChar >> 6);
-    out[1] = 0x8 | (unicodeChar & 0x3f);
+    out[1] = 0x80 | (unicodeChar & 0x3f);
     return 2;
   }
   if (unicodeChar <= 0xffff) {
     // Third code point.
     out[0] = 0xe0 | (unicodeChar >> 12);
-    out[1] = 0x8 | ((unicodeChar >> 6) & 0x3f);
-    out[2] = 0x8 | (unicodeChar & 0x3f);
-    return 2;
+    out[1] = 0x80 | ((unicodeChar >> 6) & 0x3f);
+    out[2] = 0x80 | (unicodeChar & 0x3f);
+    return 3;
   }
   if (unicodeChar <= 0x10ffff) {
     // Fourth code point.
     out[0] = 0xf0 | (unicodeChar >> 18);
-    out[1] = 0x8 | ((unicodeChar >> 12) & 0x3f);
-    out[2] = 0x8 | ((unicodeChar >> 6) & 0x3f);
-    out[3] = 0x8 | (unicodeChar & 0x3f);
-    return 2;
+    out[1] = 0x80 | ((unicodeChar >> 12) & 0x3f);
+    out[2] = 0x80 | ((unicodeChar >> 6) & 0x3f);
+    out[3] = 0x80 | (unicodeChar & 0x3f);
+    return 4;
   }
   // Too large.
   return 0;
 }
 
+// CP1252 is Latin-1, except that 0x80 through 0x9f hold typographic characters
+// instead of C1 controls.  These are the code points of 0x80 through 0x9f.  The
+// five bytes CP1252 leaves undefined map to the C1 control of the same value.
+static const uint16_t swAnsiHighToUnicode[0x20] = {
+  0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+  0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+  0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+  0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+};
+
+// The inverse, for the pages of Unicode outside Latin-1 that CP1252 uses.
+static const uint8_t swAnsiPage01[256] = {
+  [0x52] = 0x8C, [0x53] = 0x9C, [0x60] = 0x8A, [0x61] = 0x9A, [0x78] = 0x9F,
+  [0x7D] = 0x8E, [0x7E] = 0x9E, [0x92] = 0x83
+};
+static const uint8_t swAnsiPage02[256] = {
+  [0xC6] = 0x88, [0xDC] = 0x98
+};
+static const uint8_t swAnsiPage20[256] = {
+  [0x13] = 0x96, [0x14] = 0x97, [0x18] = 0x91, [0x19] = 0x92, [0x1A] = 0x82,
+  [0x1C] = 0x93, [0x1D] = 0x94, [0x1E] = 0x84, [0x20] = 0x86, [0x21] = 0x87,
+  [0x22] = 0x95, [0x26] = 0x85, [0x30] = 0x89, [0x39] = 0x8B, [0x3A] = 0x9B,
+  [0xAC] = 0x80
+};
+static const uint8_t swAnsiPage21[256] = {
+  [0x22] = 0x99
+};
+static const uint8_t *const swAnsiPages[0x22] = {
+  [0x01] = swAnsiPage01, [0x02] = swAnsiPage02, [0x20] = swAnsiPage20, [0x21] = swAnsiPage21
+};
+
 // Convert a unicode character to ANSI.  Return 0 if it cannot be converted.
 uint8_t swUnicodeToAnsi(uint32_t unicodeChar) {
-  if (unicodeChar <= 0x7f) {
-    // ASCII is the same in both.
+  if (unicodeChar < 0x80 || (unicodeChar >= 0xa0 && unicodeChar <= 0xff)) {
+    // ASCII and the upper half of Latin-1 are the same in both.
     return unicodeChar;
   }
-  switch (unicodeChar) {
-  case 0x20AC: return 0x80;
-  case 0x201A: return 0x82;
-  case 0x0192: return 0x83;
-  case 0x201E: return 0x84;
-  case 0x2026: return 0x85;
-  case 0x2020: return 0x86;
-  case 0x2021: return 0x87;
-  case 0x02C6: return 0x88;
-  case 0x2030: return 0x89;
-  case 0x0160: return 0x8A;
-  case 0x2039: return 0x8B;
-  case 0x0152: return 0x8C;
-  case 0x017D: return 0x8E;
-  case 0x2018: return 0x91;
-  case 0x2019: return 0x92;
-  case 0x201C: return 0x93;
-  case 0x201D: return 0x94;
-  case 0x2022: return 0x95;
-  case 0x2013: return 0x96;
-  case 0x2014: return 0x97;
-  case 0x02DC: return 0x98;
-  case 0x2122: return 0x99;
-  case 0x0161: return 0x9A;
-  case 0x203A: return 0x9B;
-  case 0x0153: return 0x9C;
-  case 0x017E: return 0x9E;
-  case 0x0178: return 0x9F;
-  }
-  if (unicodeChar > 0xff) {
-    return 0;  // Not an ANSI character.
-  }
-  return unicodeChar;  // Encoded the same in both.
+  uint32_t page = unicodeChar >> 8;
+  if (page >= 0x22 || swAnsiPages[page] == NULL) {
+    // This includes C1 controls, whose bytes mean something else in CP1252.
+    return 0;
+  }
+  return swAnsiPages[page][unicodeChar & 0xff];
 }
 
 // Convert an ANSI character to unicode.
 uint32_t swAnsiToUnicodeUnicodeToAnsi(uint8_t ansiChar) {
-  if (ansiChar <= 0x7f) {
-    // ASCII is the same in both.
-    return ansiChar;
-  }
-  switch (ansiChar) {
-  case 0x80: return 0x20AC;
-  case 0x82: return 0x201A;
-  case 0x83: return 0x0192;
-  case 0x84: return 0x201E;
-  case 0x85: return 0x2026;
-  case 0x86: return 0x2020;
-  case 0x87: return 0x2021;
-  case 0x88: return 0x02C6;
-  case 0x89: return 0x2030;
-  case 0x8A: return 0x0160;
-  case 0x8B: return 0x2039;
-  case 0x8C: return 0x0152;
-  case 0x8E: return 0x017D;
-  case 0x91: return 0x2018;
-  case 0x92: return 0x2019;
-  case 0x93: return 0x201C;
-  case 0x94: return 0x201D;
-  case 0x95: return 0x2022;
-  case 0x96: return 0x2013;
-  case 0x97: return 0x2014;
-  case 0x98: return 0x02DC;
-  case 0x99: return 0x2122;
-  case 0x9A: return 0x0161;
-  case 0x9B: return 0x203A;
-  case 0x9C: return 0x0153;
-  case 0x9E: return 0x017E;
-  case 0x9F: return 0x0178;
-  default:
-    break;
+  if (ansiChar >= 0x80 && ansiChar < 0xa0) {
+    return swAnsiHighToUnicode[ansiChar - 0x80];
   }
   return ansiChar;  // Encoded the same in both.
 }
+
+static swSimdLevel swMaxSimdLevel = SW_SIMD_AVX2;
+
+// Return the best SIMD level the CPU supports, limited by swSetMaxSimdLevel.
+swSimdLevel swGetSimdLevel(void) {
+  swSimdLevel level = SW_SIMD_NONE;
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    level = SW_SIMD_AVX2;
+  } else if (__builtin_cpu_supports("sse4.1")) {
+    level = SW_SIMD_SSE4;
+  }
+#endif
+  return level < swMaxSimdLevel? level : swMaxSimdLevel;
+}
+
+// Limit the SIMD level used, to test or benchmark the slower paths.
+void swSetMaxSimdLevel(swSimdLevel level) {
+  swMaxSimdLevel = level;
+}
+
+// Write samples as hex, 4 big-endian digits each, followed by a NUL.  out must
+// have room for numSamples*4 + 1 bytes.
+void swConvertInt16ToHex(char *out, const int16_t *samples, uint32_t numSamples) {
+  char *p = out;
+  for (uint32_t i = 0; i < numSamples; i++) {
+    int16_t sample = samples[i];
+    for (uint32_t j = 0; j < 4; j++) {
+      char value = (sample >> 12) & 0xf;
+      *p++ = value <= 9? '0' + value : 'A' + value - 10;
+      sample <<= 4;
+    }
+  }
+  *p = '\0';
+}
+
+// Convert a factor that changes pitch or speed, to minRange .. maxRange.
+int swFactorToRange(float factor, float minFactor, float maxFactor, int32_t minRange,
+    int32_t defaultRange, int maxRange) {
+  if (factor > maxFactor) {
+    factor = maxFactor;
+  }
+  if (factor < minFactor) {
+    factor = minFactor;
+  }
+  if (factor >= 1.0f) {
+    return defaultRange + (int)((maxRange - defaultRange)*
+        ((factor - 1.0f)/(maxFactor - 1.0f)) + 0.5f);
+  }
+  return defaultRange - (int)((defaultRange - minRange)*
+      (1.0f/factor - 1.0f)/(1.0f/minFactor - 1.0f) + 0.5f);
+}
+
+// Convert a line of hex digits to int16_t.  Return the number of samples.
+uint32_t swConvertHexToInt16(int16_t *samples, const char *line) {
+  uint32_t i = 0;
+  uint32_t numDigits = 0;
+  uint32_t numSamples = 0;
+  uint32_t value = 0;
+  char c = line[i++];
+  while(c != '\0') {
+    if(c > ' ') {
+      value <<= 4;
+      uint32_t digit = 0;
+      if(c >= '0' && c <= '9') {
+        digit = c - '0';
+      } else if(c >= 'A' && c <= 'F') {
+        digit = c - 'A' + 10;
+      } else if(c >= 'a' && c <= 'f') {
+        digit = c - 'a' + 10;
+      }
+      value += digit;
+      numDigits++;
+      if(numDigits == 4) {
+        samples[numSamples++] = value;
+        numDigits = 0;
+        value = 0;
+      }
+    }
+    c = line[i++];
+  }
+  if(numDigits != 0) {
+    fprintf(stderr, "Hex digits left over: %u\n", numDigits);
+  }
+  return numSamples;
+}
+
+// Read text into paragraph, replacing runs of characters <= space with a
+// single space.  Continue until a period once minLength bytes are read, or
+// until maxLength bytes.  paragraph must have room for maxLength + 1 bytes.
+// Return false at end of file.
+bool swReadParagraph(FILE *file, char *paragraph, uint32_t minLength, uint32_t maxLength,
+    uint32_t *length) {
+  uint32_t pos = 0;
+  int c;
+  // Check the length first, so a character is never read and then dropped.
+  while(pos < maxLength && (c = getc(file)) != EOF) {
+    if (c <= ' ') {
+      while(c <= ' ' && c != EOF) {
+        c = getc(file);
+      }
+      if (c != EOF) {
+        ungetc(c, file);
+      }
+      c = ' ';
+    }
+    paragraph[pos++] = c;
+    if (c == '.' && pos >= minLength) {
+      break;
+    }
+  }
+  paragraph[pos] = '\0';
+  *length = pos;
+  return pos != 0;
+}
+
+// These are for callers compiled without the macros in util.h.
+#undef swCalloc
+#undef swRealloc
+
+// Call calloc, and exit on failure with an error message to stderr.
+void *swCalloc(size_t numElements, size_t elementSize) {
+  return swCallocAt(numElements, elementSize, "unknown", 0);
+}
+
+// Call recalloc, and exit on failure with an error message to stderr.
+void *swRealloc(void *mem, size_t numElements, size_t elementSize) {
+  return swReallocAt(mem, numElements, elementSize, "unknown", 0);
+}
@@ -1,17 +1,61 @@
+#ifndef SW_UTIL_H
+#define SW_UTIL_H
+
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 
-#define SW_DEBUG 1
+// Log levels, from least to most verbose.  The runtime level is read from the
+// SW_LOG_LEVEL environment variable, as a name (none, error, warn, info, debug)
+// or a number, and defaults to warn.
+typedef enum {
+  SW_LOG_NONE = 0,
+  SW_LOG_ERROR = 1,
+  SW_LOG_WARN = 2,
+  SW_LOG_INFO = 3,
+  SW_LOG_DEBUG = 4
+} swLogLevel;
+
+// Messages more verbose than SW_LOG_MAX_LEVEL are compiled out entirely,
+// including evaluation of their arguments.  Build with -DSW_LOG_MAX_LEVEL=4 to
+// enable debug logging.
+#ifndef SW_LOG_MAX_LEVEL
+#define SW_LOG_MAX_LEVEL 3
+#endif
 
-#ifdef SW_DEBUG
-// Write a formatted string to the log file.
+// Messages more verbose than this are discarded.  Do not set it directly.
+extern int swLogThreshold;
+// Queue a formatted message for the log file.  Messages are written by a
+// background thread, so this never blocks on I/O.  Use the swLogError ..
+// swLogDebug macros instead, so that disabled levels cost only a compare.
+void swLogWrite(swLogLevel level, const char *format, ...);
+// Write a formatted string to the log file at SW_LOG_INFO level.
 void swLog(const char *format, ...);
-// Call at program initialization to set the name of the log file.
+// Call at program initialization to set the name of the log file.  The file is
+// created when the first message is written.
 void swSetLogFileName(const char *logFileName);
+
+#define swLogAt(level, ...) do { \
+  if ((int)(level) <= __atomic_load_n(&swLogThreshold, __ATOMIC_RELAXED)) { \
+    swLogWrite((level), __VA_ARGS__); \
+  } \
+} while (0)
+
+#define swLogError(...) swLogAt(SW_LOG_ERROR, __VA_ARGS__)
+#if SW_LOG_MAX_LEVEL >= 2
+#define swLogWarn(...) swLogAt(SW_LOG_WARN, __VA_ARGS__)
+#else
+#define swLogWarn(...) ((void)0)
+#endif
+#if SW_LOG_MAX_LEVEL >= 3
+#define swLogInfo(...) swLogAt(SW_LOG_INFO, __VA_ARGS__)
 #else
-static inline void swLog(const char *format, ...) {}
-static inline void swSetLogFileName(const char *logFileName) {}
+#define swLogInfo(...) ((void)0)
+#endif
+#if SW_LOG_MAX_LEVEL >= 4
+#define swLogDebug(...) swLogAt(SW_LOG_DEBUG, __VA_ARGS__)
+#else
+#define swLogDebug(...) ((void)0)
 #endif
 
 void swUtilStart(void);
@@ -41,18 +85,70 @@ void *swCalloc(size_t numElements, size_t elementSize);
 void *swRealloc(void *mem, size_t numElements, size_t elementSize);
 // Free memory.
 void swFree(void *mem);
+// These record the call site, for allocation statistics.
+void *swCallocAt(size_t numElements, size_t elementSize, const char *file, int line);
+void *swReallocAt(void *mem, size_t numElements, size_t elementSize, const char *file,
+    int line);
+#define swCalloc(numElements, elementSize) \
+    swCallocAt((numElements), (elementSize), __FILE__, __LINE__)
+#define swRealloc(mem, numElements, elementSize) \
+    swReallocAt((mem), (numElements), (elementSize), __FILE__, __LINE__)
+
+// Allocation statistics.  These are only collected when SW_ALLOC_STATS is set
+// in the environment, since they cost an atomic add or two per allocation.  If
+// SW_ALLOC_STATS is "report", a per-call-site report is written to stderr at
+// exit.  Memory from swCalloc and swRealloc must be freed with swFree.
+typedef struct {
+  uint64_t liveBytes;
+  uint64_t peakBytes;
+  uint64_t allocations;  // Calls to swCalloc and swRealloc.
+  uint64_t frees;
+  uint64_t bytesAllocated;
+  double allocationsPerSecond;  // Averaged since the first allocation.
+} swAllocStats;
+
+// Return true if allocation statistics are being collected.
+bool swAllocStatsEnabled(void);
+// Read the allocation statistics of this process.
+void swGetAllocStats(swAllocStats *stats);
+// Write allocation counts per call site, busiest first.
+void swWriteAllocReport(FILE *file);
 
 // Create a child process and return two FILE objects for communication.  The
 // child process simply uses stdin/stdout for communication.  The arguments to
 // the child process should be passed as additional parameters, ending with a
 // NULL.  Return the child PID.
 int swForkWithStdio(const char *exePath, FILE **fin, FILE **fout, ...);
+// Give a child process up to graceMilliseconds to exit on its own, and then
+// kill it.  The child is reaped either way.
+void swStopChild(int pid, uint32_t graceMilliseconds);
 
-// Convert an ANSI character to ASCII.  The returned string is zero-terminated.
-// This returns a static buffer and is not thread safe.
-char *swConvertANSIToASCII(char c);
-// The returned word will be at most this long
-#define SW_MAX_WORD_SIZE 16
+// Write samples as hex, 4 big-endian digits each, followed by a NUL.  out must
+// have room for numSamples*4 + 1 bytes.
+void swConvertInt16ToHex(char *out, const int16_t *samples, uint32_t numSamples);
+// Convert a line of hex digits to int16_t.  Return the number of samples.
+uint32_t swConvertHexToInt16(int16_t *samples, const char *line);
+// Convert a factor that changes pitch or speed, to minRange .. maxRange.
+int swFactorToRange(float factor, float minFactor, float maxFactor, int32_t minRange,
+    int32_t defaultRange, int maxRange);
+// Read text into paragraph, replacing runs of characters <= space with a
+// single space.  Continue until a period once minLength bytes are read, or
+// until maxLength bytes.  paragraph must have room for maxLength + 1 bytes.
+// Return false at end of file.
+bool swReadParagraph(FILE *file, char *paragraph, uint32_t minLength, uint32_t maxLength,
+    uint32_t *length);
+
+// SIMD instruction sets used by the bulk text routines.
+typedef enum {
+  SW_SIMD_NONE,
+  SW_SIMD_SSE4,
+  SW_SIMD_AVX2
+} swSimdLevel;
+
+// Return the best SIMD level the CPU supports, limited by swSetMaxSimdLevel.
+swSimdLevel swGetSimdLevel(void);
+// Limit the SIMD level used, to test or benchmark the slower paths.
+void swSetMaxSimdLevel(swSimdLevel level);
 
 // No character takes more than 4 bytes to encode as UTF-8.
 #define SW_MAX_UTF8_CHAR_LEN 4
@@ -70,3 +166,5 @@ uint32_t swEncodeUTF8(uint32_t unicodeChar, char *out);
 uint8_t swUnicodeToAnsi(uint32_t unicodeChar);
 // Convert an ANSI character to unicode.
 uint32_t swAnsiToUnicodeUnicodeToAnsi(uint8_t ansiChar);
+
+#endif  // SW_UTIL_H